@@ -31,6 +31,30 @@
    SetKeyInt and
    SetKeyString are missing */
 
+/* the internal functions use the given line buffer (IFX_INI_LINE_LENGTH byte),
+   taken from the stack or an arena - no heap allocation per lookup */
+static IFX_int32_t IFX_INI_GetKeyString(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   const IFX_char_t  *pKeyName,
+   const IFX_char_t  *pDefault,
+   IFX_char_t        *pRetString,
+   IFX_int32_t       nSize,
+   const IFX_char_t  *pFile);
+
+static IFX_int32_t IFX_INI_GetKeyInt(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   const IFX_char_t  *pKeyName,
+   IFX_int32_t       nDefault,
+   const IFX_char_t  *pFile);
+
+static IFX_int32_t IFX_INI_GetSection(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   IFX_char_t        *pBuffer,
+   IFX_int32_t       nBufferSize,
+   const IFX_char_t  *pFile);
 
 /**
    The GetKeyInt function retrieves an integer associated with a key in the
@@ -45,13 +69,168 @@ IFX_int32_t GetKeyInt(
    const IFX_char_t* pKeyName,      /**< key name */
    IFX_int32_t nDefault,      /**< return value if key name not found */
    const IFX_char_t* pFile          /**< pointer to file data (array with \0 at end) */)
+{
+   IFX_char_t line[IFX_INI_LINE_LENGTH];
+
+   return IFX_INI_GetKeyInt(line, pSectionName, pKeyName, nDefault, pFile);
+}
+
+/**
+   The GetKeyString function retrieves a string from the specified section in
+   an initialization file (buffered in array at pFile).
+
+\return
+   The return value is the number of characters copied to the buffer, not
+   including the terminating null character.
+*/
+IFX_int32_t GetKeyString(
+   const IFX_char_t* pSectionName,  /**< section name */
+   const IFX_char_t* pKeyName,      /**< key name */
+   const IFX_char_t* pDefault,      /**< return value if key name not found */
+   IFX_char_t* pRetString,    /**< destination buffer */
+   IFX_int32_t nSize,           /**< size of destination buffer */
+   const IFX_char_t* pFile          /**< pointer to file data (array with \0 at end) */
+)
+{
+   IFX_char_t line[IFX_INI_LINE_LENGTH];
+
+   return IFX_INI_GetKeyString(line, pSectionName, pKeyName, pDefault,
+                               pRetString, nSize, pFile);
+}
+
+/**
+   Fill the whole desired section into the given buffer.
+
+\return
+   number of characters copied
+*/
+IFX_int32_t GetSection(
+   const IFX_char_t *pSectionName,  /**< Name of the section to retrieve */
+   IFX_char_t *pBuffer,       /**< pointer to put copy the data to */
+   IFX_int32_t nBufferSize,   /**< size of the given buffer */
+   const IFX_char_t* pFile          /**< \0 terminated array to search the section in */
+)
+{
+   IFX_char_t line[IFX_INI_LINE_LENGTH];
+
+   return IFX_INI_GetSection(line, pSectionName, pBuffer, nBufferSize, pFile);
+}
+
+#if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) )
+/**
+   Same as GetKeyInt, the line buffer is taken from the given arena and
+   released by a rewind (no heap allocation per lookup).
+
+\return
+   the value of the desired key if found, otherwise (also if no arena is
+   given or the arena is exhausted) the value of nDefault.
+*/
+IFX_int32_t GetKeyIntArena(
+   IFXOS_Arena_t *pArena,           /**< arena for the temporary line buffer */
+   const IFX_char_t* pSectionName,  /**< section name */
+   const IFX_char_t* pKeyName,      /**< key name */
+   IFX_int32_t nDefault,      /**< return value if key name not found */
+   const IFX_char_t* pFile          /**< pointer to file data (array with \0 at end) */)
+{
+   IFXOS_ArenaMark_t lineMark;
+   IFX_char_t        *pLine;
+   IFX_int32_t       ret;
+
+   if (pArena == IFX_NULL)
+      return nDefault;
+
+   IFXOS_ArenaMarkGet(pArena, &lineMark);
+   pLine = (IFX_char_t *)IFXOS_ArenaAlloc(pArena, IFX_INI_LINE_LENGTH);
+   if (pLine == IFX_NULL)
+      return nDefault;
+
+   ret = IFX_INI_GetKeyInt(pLine, pSectionName, pKeyName, nDefault, pFile);
+   IFXOS_ArenaRewind(pArena, &lineMark);
+
+   return ret;
+}
+
+/**
+   Same as GetKeyString, the line buffer is taken from the given arena and
+   released by a rewind (no heap allocation per lookup).
+*/
+IFX_int32_t GetKeyStringArena(
+   IFXOS_Arena_t *pArena,           /**< arena for the temporary line buffer */
+   const IFX_char_t* pSectionName,  /**< section name */
+   const IFX_char_t* pKeyName,      /**< key name */
+   const IFX_char_t* pDefault,      /**< return value if key name not found */
+   IFX_char_t* pRetString,    /**< destination buffer */
+   IFX_int32_t nSize,           /**< size of destination buffer */
+   const IFX_char_t* pFile          /**< pointer to file data (array with \0 at end) */
+)
+{
+   IFXOS_ArenaMark_t lineMark;
+   IFX_char_t        *pLine;
+   IFX_int32_t       ret;
+
+   if (pArena == IFX_NULL)
+      return IFX_ERROR;
+
+   IFXOS_ArenaMarkGet(pArena, &lineMark);
+   pLine = (IFX_char_t *)IFXOS_ArenaAlloc(pArena, IFX_INI_LINE_LENGTH);
+   if (pLine == IFX_NULL)
+      return IFX_ERROR;
+
+   ret = IFX_INI_GetKeyString(pLine, pSectionName, pKeyName, pDefault,
+                              pRetString, nSize, pFile);
+   IFXOS_ArenaRewind(pArena, &lineMark);
+
+   return ret;
+}
+
+/**
+   Same as GetSection, the line buffer is taken from the given arena and
+   released by a rewind (no heap allocation per lookup).
+*/
+IFX_int32_t GetSectionArena(
+   IFXOS_Arena_t *pArena,           /**< arena for the temporary line buffer */
+   const IFX_char_t *pSectionName,  /**< Name of the section to retrieve */
+   IFX_char_t *pBuffer,       /**< pointer to put copy the data to */
+   IFX_int32_t nBufferSize,   /**< size of the given buffer */
+   const IFX_char_t* pFile          /**< \0 terminated array to search the section in */
+)
+{
+   IFXOS_ArenaMark_t lineMark;
+   IFX_char_t        *pLine;
+   IFX_int32_t       ret;
+
+   if (pArena == IFX_NULL)
+      return IFX_ERROR;
+
+   IFXOS_ArenaMarkGet(pArena, &lineMark);
+   pLine = (IFX_char_t *)IFXOS_ArenaAlloc(pArena, IFX_INI_LINE_LENGTH);
+   if (pLine == IFX_NULL)
+      return IFX_ERROR;
+
+   ret = IFX_INI_GetSection(pLine, pSectionName, pBuffer, nBufferSize, pFile);
+   IFXOS_ArenaRewind(pArena, &lineMark);
+
+   return ret;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) ) */
+
+
+/**
+   Retrieves an integer associated with a key, see GetKeyInt.
+*/
+static IFX_int32_t IFX_INI_GetKeyInt(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   const IFX_char_t  *pKeyName,
+   IFX_int32_t       nDefault,
+   const IFX_char_t  *pFile)
 {
    IFX_char_t  RetString[15], sDefault[15], *pRetStr = RetString;
    IFX_int32_t ret = nDefault;
 
    snprintf(sDefault, sizeof(sDefault), "%d", nDefault);
 
-   if ( GetKeyString(pSectionName, pKeyName, sDefault, &RetString[0],
+   if ( IFX_INI_GetKeyString(pLine, pSectionName, pKeyName, sDefault, &RetString[0],
       sizeof(RetString), pFile) > 0 )
    {
       /* remove leading blanks */
@@ -82,23 +261,17 @@ IFX_int32_t GetKeyInt(
 
 
 /**
-   The GetKeyString function retrieves a string from the specified section in
-   an initialization file (buffered in array at pFile).
-
-\return
-   The return value is the number of characters copied to the buffer, not
-   including the terminating null character.
+   Retrieves a string from the specified section, see GetKeyString.
 */
-IFX_int32_t GetKeyString(
-   const IFX_char_t* pSectionName,  /**< section name */
-   const IFX_char_t* pKeyName,      /**< key name */
-   const IFX_char_t* pDefault,      /**< return value if key name not found */
-   IFX_char_t* pRetString,    /**< destination buffer */
-   IFX_int32_t nSize,           /**< size of destination buffer */
-   const IFX_char_t* pFile          /**< pointer to file data (array with \0 at end) */
-)
+static IFX_int32_t IFX_INI_GetKeyString(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   const IFX_char_t  *pKeyName,
+   const IFX_char_t  *pDefault,
+   IFX_char_t        *pRetString,
+   IFX_int32_t       nSize,
+   const IFX_char_t  *pFile)
 {
-   IFX_char_t  *pLine=IFX_NULL;
    IFX_int32_t ret = 0;
    IFX_char_t *pTok,
         *pSectEnd;
@@ -119,11 +292,6 @@ IFX_int32_t GetKeyString(
 
    pInput = pFile;
 
-   pLine = (IFX_char_t *)IFXOS_MemAlloc(IFX_INI_LINE_LENGTH);
-   if (pLine == IFX_NULL) {
-      return IFX_ERROR;
-   }
-
    do
    {
       /* get a line from the "file" */
@@ -197,26 +365,20 @@ IFX_int32_t GetKeyString(
       }
    }
 
-   IFXOS_MemFree(pLine);
-
    return ret;
 }
 
 
 /**
-   Fill the whole desired section into the given buffer.
-
-\return
-   number of characters copied
+   Fill the whole desired section into the given buffer, see GetSection.
 */
-IFX_int32_t GetSection(
-   const IFX_char_t *pSectionName,  /**< Name of the section to retrieve */
-   IFX_char_t *pBuffer,       /**< pointer to put copy the data to */
-   IFX_int32_t nBufferSize,   /**< size of the given buffer */
-   const IFX_char_t* pFile          /**< \0 terminated array to search the section in */
-)
+static IFX_int32_t IFX_INI_GetSection(
+   IFX_char_t        *pLine,
+   const IFX_char_t  *pSectionName,
+   IFX_char_t        *pBuffer,
+   IFX_int32_t       nBufferSize,
+   const IFX_char_t  *pFile)
 {
-   IFX_char_t  *pLine=IFX_NULL;
    IFX_int32_t nSectLen;
    IFX_char_t *pSectNameEnd;
    const IFX_char_t *pInput,
@@ -230,12 +392,6 @@ IFX_int32_t GetSection(
 
    pInput = pFile;
 
-   pLine = (IFX_char_t *)IFXOS_MemAlloc(IFX_INI_LINE_LENGTH);
-   if(pLine == IFX_NULL)
-   {
-      return IFX_ERROR;
-   }
-
    do
    {
       /* search the section start */
@@ -270,7 +426,6 @@ IFX_int32_t GetSection(
    while ( *pInput != '\0');
 
 	if (bSectionFound == IFX_FALSE) {
-		IFXOS_MemFree(pLine);
       return 0;
 	}
 
@@ -303,8 +458,6 @@ IFX_int32_t GetSection(
    memcpy (pBuffer, pSectStart, nSectLen);
    pBuffer[nSectLen] = '\0';
 
-   IFXOS_MemFree(pLine);
-
    return nSectLen+1;
 }
 
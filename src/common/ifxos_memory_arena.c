@@ -0,0 +1,293 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS memory arena - bump pointer allocation of
+   temporary blocks which are released all at once.
+
+\par Implementation
+   The arena memory consists of a list of chunks allocated via
+   \ref IFXOS_BlockAlloc. A block is taken from the current chunk by moving
+   its "used" offset, a mark saves the current chunk and offset.
+   A rewind / reset only resets the current chunk, the following chunks stay
+   within the list and are reused by the next allocations, so an arena which
+   is used in a loop reaches a steady state without any further
+   \ref IFXOS_BlockAlloc call.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  endif
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_memory_alloc.h"
+
+#if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - memory arena, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/** round up to the arena alignment */
+#define IFXOS_ARENA_ALIGN_UP(val) \
+            (((val) + (IFXOS_ARENA_ALIGN - 1)) & ~((IFX_size_t)IFXOS_ARENA_ALIGN - 1))
+
+/** size of the chunk header, the chunk data starts aligned behind */
+#define IFXOS_ARENA_CHUNK_HDR_SIZE        IFXOS_ARENA_ALIGN_UP(sizeof(IFXOS_ArenaChunk_t))
+
+/** start of the chunk data */
+#define IFXOS_ARENA_CHUNK_DATA(pChunk)    ((IFX_uint8_t *)(pChunk) + IFXOS_ARENA_CHUNK_HDR_SIZE)
+
+/* ============================================================================
+   IFX OS adaptation - memory arena, functions
+   ========================================================================= */
+
+/**
+   Initialize a memory arena, no memory is allocated up to the first
+   \ref IFXOS_ArenaAlloc.
+
+\param
+   pArena      Points to the arena object.
+\param
+   chunkSize   Size of the chunks [byte], 0 selects the default.
+
+\return
+   IFX_SUCCESS if the arena has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_ArenaInit(
+               IFXOS_Arena_t  *pArena,
+               IFX_size_t     chunkSize)
+{
+   if (pArena == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Arena Init, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   pArena->pFirst      = IFX_NULL;
+   pArena->pCurr       = IFX_NULL;
+   pArena->chunkSize   = (chunkSize != 0) ?
+                           IFXOS_ARENA_ALIGN_UP(chunkSize) : IFXOS_ARENA_DEFAULT_CHUNK_SIZE;
+   pArena->numOfChunks = 0;
+   pArena->bValid      = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Delete a memory arena and free all chunks.
+
+\param
+   pArena      Points to the arena object.
+
+\return
+   IFX_SUCCESS if the arena has been deleted, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_ArenaDelete(
+               IFXOS_Arena_t  *pArena)
+{
+   IFXOS_ArenaChunk_t *pChunk;
+
+   if ((pArena == IFX_NULL) || (pArena->bValid != IFX_TRUE))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Arena Delete, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   while (pArena->pFirst != IFX_NULL)
+   {
+      pChunk = pArena->pFirst;
+      pArena->pFirst = pChunk->pNext;
+      IFXOS_BlockFree(pChunk);
+   }
+
+   pArena->pCurr       = IFX_NULL;
+   pArena->numOfChunks = 0;
+   pArena->bValid      = IFX_FALSE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Allocate a block from a memory arena (bump pointer).
+
+\param
+   pArena         Points to the arena object.
+\param
+   memSize_byte   Size of the requested block [byte].
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the block.
+*/
+IFX_void_t *IFXOS_ArenaAlloc(
+               IFXOS_Arena_t  *pArena,
+               IFX_size_t     memSize_byte)
+{
+   IFXOS_ArenaChunk_t   *pChunk, *pNext;
+   IFX_size_t           size;
+   IFX_void_t           *pBlock;
+
+   if ((pArena == IFX_NULL) || (pArena->bValid != IFX_TRUE) || (memSize_byte == 0))
+   {
+      return IFX_NULL;
+   }
+
+   size   = IFXOS_ARENA_ALIGN_UP(memSize_byte);
+   pChunk = pArena->pCurr;
+
+   if ((pChunk == IFX_NULL) || (pChunk->size - pChunk->used < size))
+   {
+      /* continue with the next (kept) chunk if it fits, else insert a new one */
+      pNext = (pChunk != IFX_NULL) ? pChunk->pNext : pArena->pFirst;
+
+      if ((pNext == IFX_NULL) || (pNext->size < size))
+      {
+         IFX_size_t chunkSize = (size > pArena->chunkSize) ? size : pArena->chunkSize;
+
+         pNext = (IFXOS_ArenaChunk_t *)IFXOS_BlockAlloc(
+                                 IFXOS_ARENA_CHUNK_HDR_SIZE + chunkSize);
+         if (pNext == IFX_NULL)
+         {
+            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+               ("IFXOS ERROR - Arena Alloc, no memory for a chunk of %lu byte" IFXOS_CRLF,
+                 (IFX_ulong_t)chunkSize));
+
+            return IFX_NULL;
+         }
+         pNext->size = chunkSize;
+
+         if (pChunk != IFX_NULL)
+         {
+            pNext->pNext  = pChunk->pNext;
+            pChunk->pNext = pNext;
+         }
+         else
+         {
+            pNext->pNext   = pArena->pFirst;
+            pArena->pFirst = pNext;
+         }
+         pArena->numOfChunks++;
+      }
+
+      pNext->used   = 0;
+      pArena->pCurr = pNext;
+      pChunk        = pNext;
+   }
+
+   pBlock = (IFX_void_t *)(IFXOS_ARENA_CHUNK_DATA(pChunk) + pChunk->used);
+   pChunk->used += size;
+
+   return pBlock;
+}
+
+/**
+   Get the current allocation state of a memory arena.
+
+\param
+   pArena      Points to the arena object.
+\param
+   pMark       Returns the allocation state.
+*/
+IFX_void_t IFXOS_ArenaMarkGet(
+               IFXOS_Arena_t     *pArena,
+               IFXOS_ArenaMark_t *pMark)
+{
+   if ((pArena == IFX_NULL) || (pMark == IFX_NULL))
+   {
+      return;
+   }
+
+   pMark->pChunk = pArena->pCurr;
+   pMark->used   = (pArena->pCurr != IFX_NULL) ? pArena->pCurr->used : 0;
+
+   return;
+}
+
+/**
+   Release all blocks which have been allocated after the given mark - O(1).
+
+\param
+   pArena      Points to the arena object.
+\param
+   pMark       Allocation state, see \ref IFXOS_ArenaMarkGet.
+*/
+IFX_void_t IFXOS_ArenaRewind(
+               IFXOS_Arena_t     *pArena,
+               const IFXOS_ArenaMark_t *pMark)
+{
+   if ((pArena == IFX_NULL) || (pMark == IFX_NULL))
+   {
+      return;
+   }
+
+   pArena->pCurr = pMark->pChunk;
+   if (pArena->pCurr != IFX_NULL)
+   {
+      pArena->pCurr->used = pMark->used;
+   }
+
+   return;
+}
+
+/**
+   Release all blocks of a memory arena - O(1).
+
+\param
+   pArena      Points to the arena object.
+*/
+IFX_void_t IFXOS_ArenaReset(
+               IFXOS_Arena_t  *pArena)
+{
+   if (pArena == IFX_NULL)
+   {
+      return;
+   }
+
+   pArena->pCurr = IFX_NULL;
+
+   return;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_ArenaInit);
+EXPORT_SYMBOL(IFXOS_ArenaDelete);
+EXPORT_SYMBOL(IFXOS_ArenaAlloc);
+EXPORT_SYMBOL(IFXOS_ArenaMarkGet);
+EXPORT_SYMBOL(IFXOS_ArenaRewind);
+EXPORT_SYMBOL(IFXOS_ArenaReset);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) ) */
+
@@ -0,0 +1,196 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS batched register access - read / write of a
+   register table within a mapped address range.
+
+\par Implementation
+   The registers are accessed without a barrier per access. Subsequent table
+   entries with the same offset are combined to a single access (one read
+   and / or one write). A barrier is placed only where the order matters:
+   in front of a read which follows a write (read-modify-write, read-back
+   verification) and at the end of the write batch.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  endif
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_memory_map.h"
+
+#if ( defined(IFXOS_HAVE_REG_BATCH) && (IFXOS_HAVE_REG_BATCH == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - register batch, local defines
+   ========================================================================= */
+
+/** mask of a table entry, 0 selects the whole register */
+#define IFXOS_REG_MASK_GET(mask)          (((mask) == 0) ? IFXOS_REG_MASK_ALL : (mask))
+
+/* ============================================================================
+   IFX OS adaptation - register batch, functions
+   ========================================================================= */
+
+/**
+   Write a table of registers of a mapped address range.
+
+\param
+   pBase       Base address, see \ref IFXOS_Phy2VirtMap [I]
+\param
+   pRegs       Points to the register table [I]
+\param
+   numOfRegs   Number of table entries [I]
+\param
+   flags       Write flags, see IFXOS_REG_BATCH_FLAG_xxx [I]
+
+\return
+   IFX_SUCCESS if all registers have been written (and verified), else
+   IFX_ERROR   if something was wrong.
+*/
+IFX_int32_t IFXOS_RegWriteBatch(
+               IFX_uint8_t             *pBase,
+               const IFXOS_RegAccess_t *pRegs,
+               IFX_uint32_t            numOfRegs,
+               IFX_uint32_t            flags)
+{
+   IFX_uint32_t   i, j, offset, mask, value, readValue;
+   IFX_boolean_t  bWritePending = IFX_FALSE;
+   IFX_int32_t    retVal = IFX_SUCCESS;
+
+   if ((pBase == IFX_NULL) || (pRegs == IFX_NULL))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Reg Write Batch, missing base or table" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   for (i = 0; i < numOfRegs; i = j)
+   {
+      offset = pRegs[i].offset;
+      mask   = IFXOS_REG_MASK_GET(pRegs[i].mask);
+      value  = pRegs[i].value & mask;
+
+      /* combine the subsequent entries of the same register */
+      for (j = i + 1; (j < numOfRegs) && (pRegs[j].offset == offset); j++)
+      {
+         IFX_uint32_t nextMask = IFXOS_REG_MASK_GET(pRegs[j].mask);
+
+         value = (value & ~nextMask) | (pRegs[j].value & nextMask);
+         mask |= nextMask;
+      }
+
+      if (mask != IFXOS_REG_MASK_ALL)
+      {
+         if (bWritePending == IFX_TRUE)
+         {
+            IFXOS_REG_BARRIER();
+            bWritePending = IFX_FALSE;
+         }
+         value |= IFXOS_REG_RAW_READ32(pBase + offset) & ~mask;
+      }
+
+      IFXOS_REG_RAW_WRITE32(pBase + offset, value);
+      bWritePending = IFX_TRUE;
+
+      if (flags & (IFXOS_REG_BATCH_FLAG_ORDERED | IFXOS_REG_BATCH_FLAG_VERIFY))
+      {
+         IFXOS_REG_BARRIER();
+         bWritePending = IFX_FALSE;
+      }
+
+      if (flags & IFXOS_REG_BATCH_FLAG_VERIFY)
+      {
+         readValue = IFXOS_REG_RAW_READ32(pBase + offset);
+         if ((readValue ^ value) & mask)
+         {
+            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+               ("IFXOS ERROR - Reg Write Batch, verify offset 0x%04X: "
+                "wrote 0x%08X, read 0x%08X (mask 0x%08X)" IFXOS_CRLF,
+                 offset, value, readValue, mask));
+
+            retVal = IFX_ERROR;
+            break;
+         }
+      }
+   }
+
+   if (bWritePending == IFX_TRUE)
+   {
+      IFXOS_REG_BARRIER();
+   }
+
+   return retVal;
+}
+
+/**
+   Read a table of registers of a mapped address range.
+
+\param
+   pBase       Base address, see \ref IFXOS_Phy2VirtMap [I]
+\param
+   pRegs       Points to the register table, returns the masked values [IO]
+\param
+   numOfRegs   Number of table entries [I]
+
+\return
+   IFX_SUCCESS if all registers have been read, else
+   IFX_ERROR   if something was wrong.
+
+\remark
+   Subsequent entries with the same offset are served by a single read.
+*/
+IFX_int32_t IFXOS_RegReadBatch(
+               IFX_uint8_t             *pBase,
+               IFXOS_RegAccess_t       *pRegs,
+               IFX_uint32_t            numOfRegs)
+{
+   IFX_uint32_t   i, readValue = 0;
+
+   if ((pBase == IFX_NULL) || (pRegs == IFX_NULL))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Reg Read Batch, missing base or table" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   /* order against the previous writes of the caller */
+   IFXOS_REG_BARRIER();
+
+   for (i = 0; i < numOfRegs; i++)
+   {
+      if ((i == 0) || (pRegs[i].offset != pRegs[i - 1].offset))
+      {
+         readValue = IFXOS_REG_RAW_READ32(pBase + pRegs[i].offset);
+      }
+      pRegs[i].value = readValue & IFXOS_REG_MASK_GET(pRegs[i].mask);
+   }
+
+   return IFX_SUCCESS;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_RegWriteBatch);
+EXPORT_SYMBOL(IFXOS_RegReadBatch);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_REG_BATCH) && (IFXOS_HAVE_REG_BATCH == 1) ) */
+
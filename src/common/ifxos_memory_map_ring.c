@@ -0,0 +1,415 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS shared ring - single producer / single
+   consumer ring of variable size records within a memory shared between
+   driver and user space.
+
+\par Implementation
+   The header contains the free running producer (head) and consumer (tail)
+   index, each written by one side only, so no lock is required. A record
+   consists of a record header (payload length) and the payload, both
+   aligned to IFXOS_SHM_RING_REC_ALIGN. A record is never split, if it does
+   not fit up to the end of the data area a padding record is placed in
+   front of it.
+   The consumer announces a sleep via the "waiting" flag, the producer
+   checks the flag after the publication of a record (both separated by a
+   full barrier), so a wakeup is only signaled if the consumer sleeps and is
+   never lost.
+   Data written by the other side is not trusted: the indices and record
+   lengths are checked against the size taken on init.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  endif
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_memory_map.h"
+
+#if ( defined(IFXOS_HAVE_SHM_RING) && (IFXOS_HAVE_SHM_RING == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - shared ring, local defines
+   ========================================================================= */
+
+/** record size (header and payload, aligned) */
+#define IFXOS_SHM_RING_REC_SIZE(len) \
+            ((IFXOS_SHM_RING_REC_ALIGN + (len) + (IFXOS_SHM_RING_REC_ALIGN - 1)) & \
+             ~(IFX_uint32_t)(IFXOS_SHM_RING_REC_ALIGN - 1))
+
+/** max payload size of a ring (a padding and a record fit into an empty ring) */
+#define IFXOS_SHM_RING_MAX_LEN(pRing)     (((pRing)->size >> 1) - IFXOS_SHM_RING_REC_ALIGN)
+
+/** own index not yet taken (indices are record aligned) */
+#define IFXOS_SHM_RING_IDX_UNKNOWN        0xFFFFFFFF
+
+/** record header within the data area */
+#define IFXOS_SHM_RING_REC_HDR(pRing, idx) \
+            ((volatile IFX_uint32_t *)&(pRing)->pData[(idx) & ((pRing)->size - 1)])
+
+/* ============================================================================
+   IFX OS adaptation - shared ring, functions
+   ========================================================================= */
+
+/**
+   Shared ring - attach a handle to the shared memory.
+
+\param
+   pRing          Points to the ring handle [O]
+\param
+   pMem           Shared memory, header followed by the data area [I]
+\param
+   memSize_byte   Size of the shared memory [I]
+\param
+   bFormat        IFX_TRUE: initialize the header, else the header is
+                  checked [I]
+
+\return
+   IFX_SUCCESS if the handle is attached, else
+   IFX_ERROR   invalid memory or header.
+*/
+IFX_int32_t IFXOS_ShmRingInit(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_void_t        *pMem,
+               IFX_uint32_t      memSize_byte,
+               IFX_boolean_t     bFormat)
+{
+   IFXOS_ShmRingHdr_t   *pHdr = (IFXOS_ShmRingHdr_t *)pMem;
+   IFX_uint32_t         size;
+
+   if ((pRing == IFX_NULL) || (pMem == IFX_NULL) ||
+       (memSize_byte < sizeof(IFXOS_ShmRingHdr_t) + 4 * IFXOS_SHM_RING_REC_ALIGN))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Shm Ring Init, missing handle or memory" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   if (bFormat == IFX_TRUE)
+   {
+      for (size = 4 * IFXOS_SHM_RING_REC_ALIGN;
+           (size << 1) != 0 && (size << 1) <= memSize_byte - sizeof(IFXOS_ShmRingHdr_t);
+           size <<= 1)
+         ;
+
+      pRing->idx    = 0;
+      pHdr->magic   = IFXOS_SHM_RING_MAGIC;
+      pHdr->size    = size;
+      pHdr->head    = 0;
+      pHdr->tail    = 0;
+      pHdr->waiting = 0;
+      IFXOS_SHM_RING_MB();
+   }
+   else
+   {
+      /* not used as producer and consumer at once, the index of the
+         corresponding side is taken by the first access */
+      pRing->idx = IFXOS_SHM_RING_IDX_UNKNOWN;
+      size = pHdr->size;
+      if ((pHdr->magic != IFXOS_SHM_RING_MAGIC) ||
+          (size < 4 * IFXOS_SHM_RING_REC_ALIGN) || ((size & (size - 1)) != 0) ||
+          (size > memSize_byte - sizeof(IFXOS_ShmRingHdr_t)))
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Shm Ring Init, invalid header (size %u)" IFXOS_CRLF,
+              (unsigned int)size));
+
+         return IFX_ERROR;
+      }
+   }
+
+   pRing->pHdr         = pHdr;
+   pRing->pData        = (IFX_uint8_t *)pMem + sizeof(IFXOS_ShmRingHdr_t);
+   pRing->size         = size;
+   pRing->pos          = 0;
+   pRing->len          = 0;
+   pRing->next         = 0;
+   pRing->memSize_byte = memSize_byte;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Shared ring - producer, reserve a record within the ring.
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   size_byte   Payload size [I]
+
+\return
+   Payload of the reserved record, else
+   IFX_NULL    ring full or invalid size.
+*/
+IFX_void_t *IFXOS_ShmRingReserve(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      size_byte)
+{
+   IFX_uint32_t head, tail, recSize, pad, offset;
+
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL) ||
+       (size_byte == 0) || (size_byte > IFXOS_SHM_RING_MAX_LEN(pRing)))
+   {
+      return IFX_NULL;
+   }
+
+   if (pRing->idx == IFXOS_SHM_RING_IDX_UNKNOWN)
+   {
+      pRing->idx = pRing->pHdr->head;
+   }
+   head = pRing->idx;
+   tail = pRing->pHdr->tail;
+   /* the consumer has finished the access to the freed records */
+   IFXOS_SHM_RING_MB();
+
+   if (head - tail > pRing->size)
+   {
+      /* corrupted consumer index */
+      return IFX_NULL;
+   }
+
+   recSize = IFXOS_SHM_RING_REC_SIZE(size_byte);
+   offset  = head & (pRing->size - 1);
+   pad     = (pRing->size - offset < recSize) ? (pRing->size - offset) : 0;
+
+   if ((head - tail) + pad + recSize > pRing->size)
+   {
+      return IFX_NULL;
+   }
+
+   if (pad != 0)
+   {
+      /* published together with the record */
+      *IFXOS_SHM_RING_REC_HDR(pRing, head) = IFXOS_SHM_RING_REC_PAD;
+      head += pad;
+   }
+
+   pRing->pos = head;
+   pRing->len = size_byte;
+
+   return (IFX_void_t *)&pRing->pData[(head & (pRing->size - 1)) + IFXOS_SHM_RING_REC_ALIGN];
+}
+
+/**
+   Shared ring - producer, publish the reserved record.
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   size_byte   Written payload size, up to the reserved size [I]
+
+\return
+   IFX_TRUE if the consumer waits and has to be waked up, else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_ShmRingCommit(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      size_byte)
+{
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL) ||
+       (pRing->len == 0) || (size_byte == 0) || (size_byte > pRing->len))
+   {
+      return IFX_FALSE;
+   }
+
+   *IFXOS_SHM_RING_REC_HDR(pRing, pRing->pos) = size_byte;
+   pRing->len = 0;
+
+   /* record (and padding) before the index */
+   IFXOS_SHM_RING_WMB();
+   pRing->idx = pRing->pos + IFXOS_SHM_RING_REC_SIZE(size_byte);
+   pRing->pHdr->head = pRing->idx;
+
+   /* index before the check of the waiting flag */
+   IFXOS_SHM_RING_MB();
+
+   return (pRing->pHdr->waiting != 0) ? IFX_TRUE : IFX_FALSE;
+}
+
+/**
+   Shared ring - consumer, get the next record (in place).
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   pSize_byte  Returns the payload size [O]
+
+\return
+   Payload of the next record, else
+   IFX_NULL    ring empty (or corrupted).
+*/
+IFX_void_t *IFXOS_ShmRingPeek(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      *pSize_byte)
+{
+   IFX_uint32_t head, tail, len;
+
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL) || (pSize_byte == IFX_NULL))
+   {
+      return IFX_NULL;
+   }
+
+   if (pRing->idx == IFXOS_SHM_RING_IDX_UNKNOWN)
+   {
+      pRing->idx = pRing->pHdr->tail;
+   }
+   tail = pRing->idx;
+   head = pRing->pHdr->head;
+   /* index before the record */
+   IFXOS_SHM_RING_RMB();
+
+   if ((head == tail) || (head - tail > pRing->size))
+   {
+      return IFX_NULL;
+   }
+
+   len = *IFXOS_SHM_RING_REC_HDR(pRing, tail);
+   if (len == IFXOS_SHM_RING_REC_PAD)
+   {
+      tail += pRing->size - (tail & (pRing->size - 1));
+      if ((head == tail) || (head - tail > pRing->size))
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Shm Ring Peek, padding without record" IFXOS_CRLF));
+
+         return IFX_NULL;
+      }
+      len = *IFXOS_SHM_RING_REC_HDR(pRing, tail);
+   }
+
+   if ((len == 0) || (len > IFXOS_SHM_RING_MAX_LEN(pRing)) ||
+       (IFXOS_SHM_RING_REC_SIZE(len) > head - tail))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Shm Ring Peek, invalid record length %u" IFXOS_CRLF,
+           (unsigned int)len));
+
+      return IFX_NULL;
+   }
+
+   pRing->pos  = tail;
+   pRing->len  = len;
+   pRing->next = tail + IFXOS_SHM_RING_REC_SIZE(len);
+   *pSize_byte = len;
+
+   return (IFX_void_t *)&pRing->pData[(tail & (pRing->size - 1)) + IFXOS_SHM_RING_REC_ALIGN];
+}
+
+/**
+   Shared ring - consumer, free the record returned by IFXOS_ShmRingPeek.
+
+\param
+   pRing       Points to the ring handle [I]
+*/
+IFX_void_t IFXOS_ShmRingRelease(
+               IFXOS_ShmRing_t   *pRing)
+{
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL) || (pRing->len == 0))
+   {
+      return;
+   }
+   pRing->len = 0;
+
+   /* access to the record before the index */
+   IFXOS_SHM_RING_MB();
+   pRing->idx = pRing->next;
+   pRing->pHdr->tail = pRing->idx;
+}
+
+/**
+   Shared ring - check if the ring contains a record.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_TRUE if the ring is empty, else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_ShmRingIsEmpty(
+               IFXOS_ShmRing_t   *pRing)
+{
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL))
+   {
+      return IFX_TRUE;
+   }
+
+   return (pRing->pHdr->head == pRing->pHdr->tail) ? IFX_TRUE : IFX_FALSE;
+}
+
+/**
+   Shared ring - consumer, announce a wait for the next record.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_TRUE if the ring is still empty and the consumer has to sleep, else
+   IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_ShmRingWaitPrepare(
+               IFXOS_ShmRing_t   *pRing)
+{
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL))
+   {
+      return IFX_FALSE;
+   }
+
+   pRing->pHdr->waiting = 1;
+   /* flag before the check of the index */
+   IFXOS_SHM_RING_MB();
+
+   if (pRing->pHdr->head != pRing->pHdr->tail)
+   {
+      pRing->pHdr->waiting = 0;
+      return IFX_FALSE;
+   }
+
+   return IFX_TRUE;
+}
+
+/**
+   Shared ring - consumer, finish a wait announced by IFXOS_ShmRingWaitPrepare.
+
+\param
+   pRing       Points to the ring handle [I]
+*/
+IFX_void_t IFXOS_ShmRingWaitDone(
+               IFXOS_ShmRing_t   *pRing)
+{
+   if ((pRing == IFX_NULL) || (pRing->pHdr == IFX_NULL))
+   {
+      return;
+   }
+
+   pRing->pHdr->waiting = 0;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_ShmRingInit);
+EXPORT_SYMBOL(IFXOS_ShmRingReserve);
+EXPORT_SYMBOL(IFXOS_ShmRingCommit);
+EXPORT_SYMBOL(IFXOS_ShmRingPeek);
+EXPORT_SYMBOL(IFXOS_ShmRingRelease);
+EXPORT_SYMBOL(IFXOS_ShmRingIsEmpty);
+EXPORT_SYMBOL(IFXOS_ShmRingWaitPrepare);
+EXPORT_SYMBOL(IFXOS_ShmRingWaitDone);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_SHM_RING) && (IFXOS_HAVE_SHM_RING == 1) ) */
@@ -0,0 +1,1024 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS memory pool - fixed size elements with O(1)
+   allocation and free.
+
+\par Implementation
+   A pool consists of one or more slabs allocated via \ref IFXOS_BlockAlloc.
+   Each slab starts with a slab header, the elements follow at the next cache
+   line boundary. Free elements are kept within a single linked free list,
+   the link is stored within the free element itself (no per element
+   overhead).
+   With \ref IFXOS_POOL_FLAG_CACHE_ALIGN the element stride is rounded up to
+   the cache line size, so two elements never share a cache line.
+
+\par Thread Caches
+   With \ref IFXOS_POOL_FLAG_THREAD_CACHE the shared free list becomes the
+   depot behind small caches ("magazines") which are only accessed by a
+   single thread (user space, thread local storage) or CPU (Linux Kernel,
+   interrupts disabled). An empty cache is refilled and a full cache is
+   drained by \ref IFXOS_POOL_CACHE_BATCH elements under a single pool lock,
+   so most alloc / free calls do not touch any shared data.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     include <linux/string.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  else
+#     include <string.h>
+#  endif
+#else
+#  include <string.h>
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_memory_alloc.h"
+#include "ifxos_sys_show.h"
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - memory pool, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/** round up to the given alignment (power of 2) */
+#define IFXOS_POOL_ALIGN_UP(val, align) \
+            (((val) + ((align) - 1)) & ~((IFX_ulong_t)(align) - 1))
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && (IFXOS_HAVE_MEM_POOL_CPU_CACHE == 1) )
+/** per CPU cache refill with interrupts disabled - no slab allocation */
+#  define IFXOS_POOL_CACHE_GROW           IFX_FALSE
+#else
+#  define IFXOS_POOL_CACHE_GROW           IFX_TRUE
+#endif
+
+/** number of elements outside the free list (thread caches included) */
+#define IFXOS_POOL_OUT_COUNT(pPool)       ((pPool)->numOfElem - (pPool)->numOfFree)
+
+/* ============================================================================
+   IFX OS adaptation - memory pool, local functions
+   ========================================================================= */
+
+/**
+   Allocate a new slab and return its elements as linked list.
+
+\param
+   pPool       Points to the pool.
+\param
+   ppFirst     Returns the first element of the new slab.
+\param
+   ppLast      Returns the last element of the new slab.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the new slab (not yet added to the pool).
+*/
+IFXOS_STATIC IFXOS_PoolSlab_t *IFXOS_PoolSlabAlloc(
+               IFXOS_Pool_t      *pPool,
+               IFXOS_PoolElem_t  **ppFirst,
+               IFXOS_PoolElem_t  **ppLast)
+{
+   IFXOS_PoolSlab_t  *pSlab;
+   IFXOS_PoolElem_t  *pElem = IFX_NULL;
+   IFX_uint8_t       *pData;
+   IFX_uint32_t      i;
+
+   pSlab = (IFXOS_PoolSlab_t *)IFXOS_BlockAlloc(
+                  sizeof(IFXOS_PoolSlab_t) + (IFXOS_MEM_CACHE_LINE_SIZE - 1) +
+                  (pPool->elemStride * pPool->slabElems));
+   if (pSlab == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+   pSlab->pNext = IFX_NULL;
+
+   pData = (IFX_uint8_t *)IFXOS_POOL_ALIGN_UP(
+                  (IFX_ulong_t)(pSlab + 1), IFXOS_MEM_CACHE_LINE_SIZE);
+
+   *ppFirst = (IFXOS_PoolElem_t *)pData;
+   for (i = 0; i < pPool->slabElems; i++)
+   {
+      pElem = (IFXOS_PoolElem_t *)pData;
+      pData += pPool->elemStride;
+      pElem->pNext = (i + 1 < pPool->slabElems) ? (IFXOS_PoolElem_t *)pData : IFX_NULL;
+   }
+   *ppLast = pElem;
+
+   return pSlab;
+}
+
+/**
+   Take elements from the shared free list.
+
+\param
+   pPool       Points to the pool.
+\param
+   ppElem      Returns the elements.
+\param
+   nCount      Max number of elements.
+\param
+   bGrow       Add a slab if the free list is empty (IFXOS_POOL_FLAG_GROW).
+
+\return
+   Number of returned elements.
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_PoolDepotGet(
+               IFXOS_Pool_t   *pPool,
+               IFX_void_t     **ppElem,
+               IFX_uint32_t   nCount,
+               IFX_boolean_t  bGrow)
+{
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFXOS_PoolSlab_t        *pSlab;
+   IFXOS_PoolElem_t        *pFirst, *pLast;
+   IFX_uint32_t            n;
+
+   IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+
+   if ( (pPool->pFreeList == IFX_NULL) && (bGrow == IFX_TRUE) &&
+        (pPool->flags & IFXOS_POOL_FLAG_GROW) )
+   {
+      /* add a slab - allocate without holding the lock */
+      IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+      pSlab = IFXOS_PoolSlabAlloc(pPool, &pFirst, &pLast);
+      IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+
+      if (pSlab != IFX_NULL)
+      {
+         pSlab->pNext      = pPool->pSlabList;
+         pPool->pSlabList  = pSlab;
+         pLast->pNext      = pPool->pFreeList;
+         pPool->pFreeList  = pFirst;
+         pPool->numOfSlabs++;
+         pPool->numOfElem += pPool->slabElems;
+         pPool->numOfFree += pPool->slabElems;
+         IFXOS_SYS_MEM_POOL_SLAB_ADD(pPool->pSysObject, pPool->slabElems);
+      }
+   }
+
+   for (n = 0; (n < nCount) && (pPool->pFreeList != IFX_NULL); n++)
+   {
+      ppElem[n] = (IFX_void_t *)pPool->pFreeList;
+      pPool->pFreeList = pPool->pFreeList->pNext;
+   }
+
+   if (n > 0)
+   {
+      pPool->numOfFree -= n;
+      if (IFXOS_POOL_OUT_COUNT(pPool) > pPool->maxInUse)
+      {
+         pPool->maxInUse = IFXOS_POOL_OUT_COUNT(pPool);
+      }
+      IFXOS_SYS_MEM_POOL_ALLOC_COUNT_ADD(pPool->pSysObject, n,
+               IFXOS_POOL_OUT_COUNT(pPool), pPool->maxInUse);
+   }
+
+   IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+   return n;
+}
+
+/**
+   Return elements to the shared free list.
+
+\param
+   pPool       Points to the pool.
+\param
+   ppElem      Points to the elements.
+\param
+   nCount      Number of elements.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolDepotPut(
+               IFXOS_Pool_t   *pPool,
+               IFX_void_t     **ppElem,
+               IFX_uint32_t   nCount)
+{
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_uint32_t            n;
+
+   IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+
+   for (n = 0; n < nCount; n++)
+   {
+      ((IFXOS_PoolElem_t *)ppElem[n])->pNext = pPool->pFreeList;
+      pPool->pFreeList = (IFXOS_PoolElem_t *)ppElem[n];
+   }
+   pPool->numOfFree += nCount;
+   IFXOS_SYS_MEM_POOL_FREE_COUNT_ADD(pPool->pSysObject, nCount,
+            IFXOS_POOL_OUT_COUNT(pPool));
+
+   IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+   return;
+}
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && (IFXOS_HAVE_MEM_POOL_CPU_CACHE == 1) )
+/**
+   Setup the per CPU caches of a pool.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_PoolCacheSetup(
+               IFXOS_Pool_t   *pPool)
+{
+   IFX_uint_t i;
+
+   pPool->pCpuCache = (IFXOS_PoolCache_t *)IFXOS_BlockAlloc(
+                           sizeof(IFXOS_PoolCache_t) * IFXOS_POOL_CPU_NUM());
+   if (pPool->pCpuCache == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   memset(pPool->pCpuCache, 0x00, sizeof(IFXOS_PoolCache_t) * IFXOS_POOL_CPU_NUM());
+
+   for (i = 0; i < IFXOS_POOL_CPU_NUM(); i++)
+   {
+      pPool->pCpuCache[i].pPool = pPool;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Release the per CPU caches of a pool (the cached elements are released
+   together with the slabs).
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolCacheCleanup(
+               IFXOS_Pool_t   *pPool)
+{
+   IFXOS_BLOCK_FREE(pPool->pCpuCache);
+}
+
+/**
+   Number of elements within the per CPU caches (snapshot).
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_PoolCacheCount(
+               IFXOS_Pool_t   *pPool)
+{
+   IFX_uint_t     i;
+   IFX_uint32_t   nCached = 0;
+
+   for (i = 0; i < IFXOS_POOL_CPU_NUM(); i++)
+   {
+      nCached += pPool->pCpuCache[i].count;
+   }
+
+   return nCached;
+}
+
+/**
+   Get the cache of the current CPU and disable the interrupts.
+*/
+IFXOS_STATIC IFXOS_PoolCache_t *IFXOS_PoolCacheEnter(
+               IFXOS_Pool_t            *pPool,
+               IFXOS_PoolLockFlags_t   *pCacheFlags)
+{
+   IFXOS_POOL_CPU_CACHE_ENTER(*pCacheFlags);
+
+   return &pPool->pCpuCache[IFXOS_POOL_CPU_ID()];
+}
+
+/**
+   Leave the cache of the current CPU.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolCacheLeave(
+               IFXOS_PoolLockFlags_t   cacheFlags)
+{
+   IFXOS_POOL_CPU_CACHE_LEAVE(cacheFlags);
+}
+
+#else      /* #if ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && ... */
+
+/**
+   Thread end - return the thread cache to the pool (TLS destructor).
+
+\param
+   pValue      Points to the thread cache.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolCacheRelease(
+               IFX_void_t     *pValue)
+{
+   IFXOS_PoolCache_t       *pCache = (IFXOS_PoolCache_t *)pValue;
+   IFXOS_PoolCache_t       **ppCache;
+   IFXOS_Pool_t            *pPool;
+   IFXOS_PoolLockFlags_t   lockFlags;
+
+   if (pCache == IFX_NULL)
+   {
+      return;
+   }
+   pPool = pCache->pPool;
+
+   IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+   for (ppCache = &pPool->pCacheList; *ppCache != IFX_NULL; ppCache = &(*ppCache)->pNext)
+   {
+      if (*ppCache == pCache)
+      {
+         *ppCache = pCache->pNext;
+         break;
+      }
+   }
+   IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+   if (pCache->count > 0)
+   {
+      IFXOS_PoolDepotPut(pPool, pCache->pElem, pCache->count);
+   }
+
+   IFXOS_MemFree(pCache);
+}
+
+/**
+   Setup the thread caches of a pool.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_PoolCacheSetup(
+               IFXOS_Pool_t   *pPool)
+{
+   pPool->pCacheList = IFX_NULL;
+
+   return IFXOS_TlsKeyCreate(&pPool->cacheKey, IFXOS_PoolCacheRelease);
+}
+
+/**
+   Release the thread caches of a pool (the cached elements are released
+   together with the slabs).
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolCacheCleanup(
+               IFXOS_Pool_t   *pPool)
+{
+   IFXOS_PoolCache_t *pCache;
+
+   (void)IFXOS_TlsKeyDelete(pPool->cacheKey);
+
+   while (pPool->pCacheList != IFX_NULL)
+   {
+      pCache = pPool->pCacheList;
+      pPool->pCacheList = pCache->pNext;
+      IFXOS_MemFree(pCache);
+   }
+}
+
+/**
+   Number of elements within the thread caches (snapshot).
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_PoolCacheCount(
+               IFXOS_Pool_t   *pPool)
+{
+   IFXOS_PoolCache_t *pCache;
+   IFX_uint32_t      nCached = 0;
+
+   for (pCache = pPool->pCacheList; pCache != IFX_NULL; pCache = pCache->pNext)
+   {
+      nCached += pCache->count;
+   }
+
+   return nCached;
+}
+
+/**
+   Get the cache of the current thread, create it on first use.
+
+\return
+   IFX_NULL if no cache is available (use the shared free list), else
+   pointer to the thread cache.
+*/
+IFXOS_STATIC IFXOS_PoolCache_t *IFXOS_PoolCacheEnter(
+               IFXOS_Pool_t            *pPool,
+               IFXOS_PoolLockFlags_t   *pCacheFlags)
+{
+   IFXOS_PoolCache_t       *pCache;
+   IFXOS_PoolLockFlags_t   lockFlags;
+
+   (void)pCacheFlags;
+
+   pCache = (IFXOS_PoolCache_t *)IFXOS_TlsGet(pPool->cacheKey);
+   if (pCache != IFX_NULL)
+   {
+      return pCache;
+   }
+
+   pCache = (IFXOS_PoolCache_t *)IFXOS_MemAlloc(sizeof(IFXOS_PoolCache_t));
+   if (pCache == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+   memset(pCache, 0x00, sizeof(IFXOS_PoolCache_t));
+   pCache->pPool = pPool;
+
+   if (IFXOS_TlsSet(pPool->cacheKey, pCache) != IFX_SUCCESS)
+   {
+      IFXOS_MemFree(pCache);
+      return IFX_NULL;
+   }
+
+   IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+   pCache->pNext = pPool->pCacheList;
+   pPool->pCacheList = pCache;
+   IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+   return pCache;
+}
+
+/**
+   Leave the cache of the current thread.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_PoolCacheLeave(
+               IFXOS_PoolLockFlags_t   cacheFlags)
+{
+   (void)cacheFlags;
+}
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && ... */
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) ) */
+
+/* ============================================================================
+   IFX OS adaptation - memory pool, functions
+   ========================================================================= */
+
+/**
+   Create a memory pool with fixed size elements.
+
+\param
+   elemSize    Size of an element [byte].
+\param
+   count       Number of preallocated elements (also the slab size for growing).
+\param
+   flags       Pool flags, see IFXOS_POOL_FLAG_xxx.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the pool.
+*/
+IFXOS_Pool_t *IFXOS_PoolCreate(
+               IFX_size_t     elemSize,
+               IFX_uint32_t   count,
+               IFX_uint32_t   flags)
+{
+   IFXOS_Pool_t      *pPool;
+   IFXOS_PoolSlab_t  *pSlab;
+   IFXOS_PoolElem_t  *pFirst, *pLast;
+   IFX_size_t        stride;
+
+   if ((elemSize == 0) || (count == 0))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Create, invalid args (size %lu, count %u)" IFXOS_CRLF,
+           (IFX_ulong_t)elemSize, count));
+
+      return IFX_NULL;
+   }
+
+#if ( !defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) || (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 0) )
+   flags &= ~IFXOS_POOL_FLAG_THREAD_CACHE;
+#endif
+
+   stride = (elemSize < sizeof(IFXOS_PoolElem_t)) ? sizeof(IFXOS_PoolElem_t) : elemSize;
+   stride = (IFX_size_t)IFXOS_POOL_ALIGN_UP(stride,
+                  (flags & IFXOS_POOL_FLAG_CACHE_ALIGN) ?
+                     IFXOS_MEM_CACHE_LINE_SIZE : sizeof(IFX_ulong_t));
+
+   pPool = (IFXOS_Pool_t *)IFXOS_BlockAlloc(sizeof(IFXOS_Pool_t));
+   if (pPool == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Create, no memory for the pool object" IFXOS_CRLF));
+
+      return IFX_NULL;
+   }
+   memset(pPool, 0x00, sizeof(IFXOS_Pool_t));
+
+   pPool->elemSize   = elemSize;
+   pPool->elemStride = stride;
+   pPool->slabElems  = count;
+   pPool->flags      = flags;
+
+   pSlab = IFXOS_PoolSlabAlloc(pPool, &pFirst, &pLast);
+   if (pSlab == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Create, no memory for %u elements of %lu byte" IFXOS_CRLF,
+           count, (IFX_ulong_t)elemSize));
+
+      IFXOS_BlockFree(pPool);
+      return IFX_NULL;
+   }
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   if (flags & IFXOS_POOL_FLAG_THREAD_CACHE)
+   {
+      if (IFXOS_PoolCacheSetup(pPool) != IFX_SUCCESS)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Pool Create, thread cache setup failed" IFXOS_CRLF));
+
+         IFXOS_BlockFree(pSlab);
+         IFXOS_BlockFree(pPool);
+         return IFX_NULL;
+      }
+   }
+#endif
+
+   pPool->pSlabList  = pSlab;
+   pPool->pFreeList  = pFirst;
+   pPool->numOfSlabs = 1;
+   pPool->numOfElem  = count;
+   pPool->numOfFree  = count;
+
+   IFXOS_POOL_LOCK_INIT(&pPool->lock);
+
+   pPool->pSysObject = (IFX_void_t*)IFXOS_SYS_OBJECT_GET(IFXOS_SYS_OBJECT_MEM_POOL);
+   IFXOS_SYS_MEM_POOL_PARAMS_SET(pPool->pSysObject, pPool, elemSize);
+   IFXOS_SYS_MEM_POOL_SLAB_ADD(pPool->pSysObject, count);
+
+   return pPool;
+}
+
+/**
+   Delete a memory pool and release all slabs.
+
+\param
+   pPool    Points to the pool.
+
+\return
+   IFX_SUCCESS if the pool is deleted, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_PoolDelete(
+               IFXOS_Pool_t   *pPool)
+{
+   IFXOS_PoolSlab_t  *pSlab;
+   IFX_uint32_t      nCached = 0;
+
+   if (pPool == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Delete, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   if (pPool->flags & IFXOS_POOL_FLAG_THREAD_CACHE)
+   {
+      nCached = IFXOS_PoolCacheCount(pPool);
+      IFXOS_PoolCacheCleanup(pPool);
+   }
+#endif
+
+   if (pPool->numOfFree + nCached != pPool->numOfElem)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("IFXOS WARNING - Pool Delete, %u elements still in use" IFXOS_CRLF,
+           pPool->numOfElem - pPool->numOfFree - nCached));
+   }
+
+   IFXOS_SYS_OBJECT_RELEASE(pPool->pSysObject);
+   IFXOS_POOL_LOCK_DELETE(&pPool->lock);
+
+   while (pPool->pSlabList != IFX_NULL)
+   {
+      pSlab = pPool->pSlabList;
+      pPool->pSlabList = pSlab->pNext;
+      IFXOS_BlockFree(pSlab);
+   }
+
+   IFXOS_BlockFree(pPool);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Allocate an element from a memory pool - O(1).
+
+\param
+   pPool    Points to the pool.
+
+\return
+   IFX_NULL if the pool is empty, else
+   pointer to the element.
+*/
+IFX_void_t *IFXOS_PoolAlloc(
+               IFXOS_Pool_t   *pPool)
+{
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_void_t              *pElem = IFX_NULL;
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   IFXOS_PoolCache_t       *pCache;
+   IFXOS_PoolLockFlags_t   cacheFlags = 0;
+#endif
+
+   if (pPool == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   if (pPool->flags & IFXOS_POOL_FLAG_THREAD_CACHE)
+   {
+      pCache = IFXOS_PoolCacheEnter(pPool, &cacheFlags);
+      if (pCache != IFX_NULL)
+      {
+         if (pCache->count == 0)
+         {
+            pCache->count = IFXOS_PoolDepotGet(pPool, pCache->pElem,
+                                 IFXOS_POOL_CACHE_BATCH, IFXOS_POOL_CACHE_GROW);
+         }
+         if (pCache->count > 0)
+         {
+            pElem = pCache->pElem[--pCache->count];
+         }
+         IFXOS_PoolCacheLeave(cacheFlags);
+      }
+   }
+#endif
+
+   if (pElem == IFX_NULL)
+   {
+      if (IFXOS_PoolDepotGet(pPool, &pElem, 1, IFX_TRUE) == 0)
+      {
+         IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+         pPool->numOfAllocFails++;
+         IFXOS_SYS_MEM_POOL_FAIL_COUNT_INC(pPool->pSysObject);
+         IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+         return IFX_NULL;
+      }
+   }
+
+   if (pPool->flags & IFXOS_POOL_FLAG_ZERO)
+   {
+      memset(pElem, 0x00, pPool->elemSize);
+   }
+
+   return pElem;
+}
+
+/**
+   Return an element to its memory pool - O(1).
+
+\param
+   pPool    Points to the pool.
+\param
+   pElem    Points to the element.
+*/
+IFX_void_t IFXOS_PoolFree(
+               IFXOS_Pool_t   *pPool,
+               IFX_void_t     *pElem)
+{
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   IFXOS_PoolCache_t       *pCache;
+   IFXOS_PoolLockFlags_t   cacheFlags = 0;
+#endif
+
+   if ((pPool == IFX_NULL) || (pElem == IFX_NULL))
+   {
+      return;
+   }
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   if (pPool->flags & IFXOS_POOL_FLAG_THREAD_CACHE)
+   {
+      pCache = IFXOS_PoolCacheEnter(pPool, &cacheFlags);
+      if (pCache != IFX_NULL)
+      {
+         if (pCache->count == IFXOS_POOL_CACHE_SIZE)
+         {
+            /* drain the older half, keep the recently freed (cache hot) ones */
+            IFXOS_PoolDepotPut(pPool, pCache->pElem, IFXOS_POOL_CACHE_BATCH);
+            memmove(&pCache->pElem[0], &pCache->pElem[IFXOS_POOL_CACHE_BATCH],
+                    sizeof(IFX_void_t *) * (IFXOS_POOL_CACHE_SIZE - IFXOS_POOL_CACHE_BATCH));
+            pCache->count = IFXOS_POOL_CACHE_SIZE - IFXOS_POOL_CACHE_BATCH;
+         }
+         pCache->pElem[pCache->count++] = pElem;
+         IFXOS_PoolCacheLeave(cacheFlags);
+
+         return;
+      }
+   }
+#endif
+
+   IFXOS_PoolDepotPut(pPool, &pElem, 1);
+
+   return;
+}
+
+/**
+   Get the statistics of a memory pool.
+
+\param
+   pPool    Points to the pool.
+\param
+   pStats   Returns the statistics.
+
+\return
+   IFX_SUCCESS if the statistics are returned, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_PoolStatsGet(
+               IFXOS_Pool_t      *pPool,
+               IFXOS_PoolStats_t *pStats)
+{
+   IFXOS_PoolLockFlags_t   lockFlags;
+
+   if ((pPool == IFX_NULL) || (pStats == IFX_NULL))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Stats Get, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   IFXOS_POOL_LOCK_GET(&pPool->lock, lockFlags);
+
+   pStats->elemSize        = pPool->elemSize;
+   pStats->numOfSlabs      = pPool->numOfSlabs;
+   pStats->numOfElem       = pPool->numOfElem;
+   pStats->numOfFree       = pPool->numOfFree;
+   pStats->numOfCached     = 0;
+#if ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   if (pPool->flags & IFXOS_POOL_FLAG_THREAD_CACHE)
+   {
+      pStats->numOfCached  = IFXOS_PoolCacheCount(pPool);
+   }
+#endif
+   pStats->numOfInUse      = pPool->numOfElem - pPool->numOfFree - pStats->numOfCached;
+   pStats->maxInUse        = pPool->maxInUse;
+   pStats->numOfAllocFails = pPool->numOfAllocFails;
+
+   IFXOS_POOL_LOCK_RELEASE(&pPool->lock, lockFlags);
+
+   return IFX_SUCCESS;
+}
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_BENCHMARK) && (IFXOS_HAVE_MEM_POOL_BENCHMARK == 1) )
+
+/** max time to wait for the end of the benchmark threads [ms] */
+#define IFXOS_POOL_BENCHMARK_WAIT_MS      600000
+
+/**
+   Memory pool benchmark - control of a single run.
+*/
+typedef struct
+{
+   /** pool under test, IFX_NULL: IFXOS_BlockAlloc */
+   IFXOS_Pool_t            *pPool;
+   /** element size [byte] */
+   IFX_size_t              elemSize;
+   /** number of loops per thread */
+   IFX_uint32_t            nLoops;
+   /** start trigger for all threads */
+   volatile IFX_boolean_t  bStart;
+} IFXOS_PoolBenchmark_t;
+
+/**
+   Memory pool benchmark - per thread data.
+*/
+typedef struct
+{
+   /** thread control */
+   IFXOS_ThreadCtrl_t      thrCntrl;
+   /** common benchmark control */
+   IFXOS_PoolBenchmark_t   *pBench;
+   /** measured time [ms] */
+   IFX_time_t              time_ms;
+   /** number of failed allocations */
+   IFX_uint32_t            nFails;
+} IFXOS_PoolBenchmarkThr_t;
+
+/**
+   Memory pool benchmark - thread function.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_PoolBenchmarkThread(
+               IFXOS_ThreadParams_t *pThrParams)
+{
+   IFXOS_PoolBenchmarkThr_t   *pThr   = (IFXOS_PoolBenchmarkThr_t *)pThrParams->nArg1;
+   IFXOS_PoolBenchmark_t      *pBench = pThr->pBench;
+   IFX_void_t                 *pElem[IFXOS_POOL_CACHE_SIZE];
+   IFX_uint32_t               loop, i;
+   IFX_time_t                 startTime_ms;
+
+   while (pBench->bStart == IFX_FALSE)
+   {
+      IFXOS_MSecSleep(1);
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+   for (loop = 0; loop < pBench->nLoops; loop++)
+   {
+      for (i = 0; i < IFXOS_POOL_CACHE_SIZE; i++)
+      {
+         pElem[i] = (pBench->pPool != IFX_NULL) ?
+                        IFXOS_PoolAlloc(pBench->pPool) :
+                        IFXOS_BlockAlloc(pBench->elemSize);
+         if (pElem[i] != IFX_NULL)
+            *(volatile IFX_uint8_t *)pElem[i] = (IFX_uint8_t)i;
+         else
+            pThr->nFails++;
+      }
+
+      for (i = 0; i < IFXOS_POOL_CACHE_SIZE; i++)
+      {
+         if (pElem[i] == IFX_NULL)
+            continue;
+
+         if (pBench->pPool != IFX_NULL)
+            IFXOS_PoolFree(pBench->pPool, pElem[i]);
+         else
+            IFXOS_BlockFree(pElem[i]);
+      }
+   }
+
+   pThr->time_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Memory pool benchmark - run the threads for one allocator and print the
+   result.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_PoolBenchmarkRun(
+               const IFX_char_t  *pName,
+               IFXOS_Pool_t      *pPool,
+               IFX_uint32_t      nThreads,
+               IFX_uint32_t      nLoops,
+               IFX_size_t        elemSize)
+{
+   IFXOS_PoolBenchmark_t      bench;
+   IFXOS_PoolBenchmarkThr_t   *pThr;
+   IFXOS_ThreadCtrl_t         **ppThrCntrl;
+   IFX_uint32_t               i, nStarted = 0, nFails = 0;
+   IFX_time_t                 maxTime_ms = 0;
+   IFX_int32_t                retVal = IFX_SUCCESS;
+
+   pThr = (IFXOS_PoolBenchmarkThr_t *)IFXOS_MemAlloc(
+                     (sizeof(IFXOS_PoolBenchmarkThr_t) + sizeof(IFXOS_ThreadCtrl_t *)) * nThreads);
+   if (pThr == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Benchmark, no memory for %u threads" IFXOS_CRLF, nThreads));
+
+      return IFX_ERROR;
+   }
+   memset(pThr, 0x00, (sizeof(IFXOS_PoolBenchmarkThr_t) + sizeof(IFXOS_ThreadCtrl_t *)) * nThreads);
+   ppThrCntrl = (IFXOS_ThreadCtrl_t **)&pThr[nThreads];
+
+   bench.pPool    = pPool;
+   bench.elemSize = elemSize;
+   bench.nLoops   = nLoops;
+   bench.bStart   = IFX_FALSE;
+
+   for (i = 0; i < nThreads; i++)
+   {
+      pThr[i].pBench = &bench;
+      if (IFXOS_ThreadInit(&pThr[i].thrCntrl, "poolbm",
+                           IFXOS_PoolBenchmarkThread,
+                           IFXOS_DEFAULT_STACK_SIZE, 0,
+                           (IFX_ulong_t)&pThr[i], 0) != IFX_SUCCESS)
+      {
+         retVal = IFX_ERROR;
+         break;
+      }
+      ppThrCntrl[i] = &pThr[i].thrCntrl;
+      nStarted++;
+   }
+
+   bench.bStart = IFX_TRUE;
+
+   if (IFXOS_ThreadDeleteAll(ppThrCntrl, nStarted, IFXOS_POOL_BENCHMARK_WAIT_MS) != IFX_SUCCESS)
+   {
+      retVal = IFX_ERROR;
+   }
+
+   if (retVal == IFX_SUCCESS)
+   {
+      for (i = 0; i < nThreads; i++)
+      {
+         if (pThr[i].time_ms > maxTime_ms)
+            maxTime_ms = pThr[i].time_ms;
+         nFails += pThr[i].nFails;
+      }
+
+      IFXOS_DBG_PRINT_USR(
+         "IFXOS Pool Benchmark - %-12s: %u threads x %u alloc/free, %u ms (%u alloc/free per ms), fails %u" IFXOS_CRLF,
+         pName, nThreads, nLoops * IFXOS_POOL_CACHE_SIZE, (IFX_uint32_t)maxTime_ms,
+         (maxTime_ms > 0) ?
+            (IFX_uint32_t)(((IFX_ulong_t)nThreads * nLoops * IFXOS_POOL_CACHE_SIZE) / maxTime_ms) : 0,
+         nFails);
+   }
+   else
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Benchmark, %s run failed (%u of %u threads started)" IFXOS_CRLF,
+           pName, nStarted, nThreads));
+   }
+
+   IFXOS_MemFree(pThr);
+
+   return retVal;
+}
+
+/**
+   Multi-threaded alloc / free benchmark, compares \ref IFXOS_BlockAlloc
+   with the memory pool (shared free list and thread caches).
+
+\param
+   nThreads    Number of concurrent threads.
+\param
+   nLoops      Number of loops per thread.
+\param
+   elemSize    Element size [byte].
+
+\return
+   IFX_SUCCESS if the benchmark has been done, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_PoolBenchmark(
+               IFX_uint32_t   nThreads,
+               IFX_uint32_t   nLoops,
+               IFX_size_t     elemSize)
+{
+   IFXOS_Pool_t   *pPool;
+   IFX_int32_t    retVal;
+
+   if ((nThreads == 0) || (nLoops == 0) || (elemSize == 0))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Pool Benchmark, invalid args" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   retVal = IFXOS_PoolBenchmarkRun("BlockAlloc", IFX_NULL, nThreads, nLoops, elemSize);
+
+   /* each thread holds up to 2 x IFXOS_POOL_CACHE_SIZE elements (cache + in use) */
+   pPool = IFXOS_PoolCreate(elemSize, nThreads * 2 * IFXOS_POOL_CACHE_SIZE,
+                            IFXOS_POOL_FLAG_GROW);
+   if (pPool == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   if (IFXOS_PoolBenchmarkRun("Pool", pPool, nThreads, nLoops, elemSize) != IFX_SUCCESS)
+   {
+      retVal = IFX_ERROR;
+   }
+   (void)IFXOS_PoolDelete(pPool);
+
+   pPool = IFXOS_PoolCreate(elemSize, nThreads * 2 * IFXOS_POOL_CACHE_SIZE,
+                            IFXOS_POOL_FLAG_GROW | IFXOS_POOL_FLAG_THREAD_CACHE);
+   if (pPool == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   if (IFXOS_PoolBenchmarkRun("Pool (cache)", pPool, nThreads, nLoops, elemSize) != IFX_SUCCESS)
+   {
+      retVal = IFX_ERROR;
+   }
+   (void)IFXOS_PoolDelete(pPool);
+
+   return retVal;
+}
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_POOL_BENCHMARK) && (IFXOS_HAVE_MEM_POOL_BENCHMARK == 1) ) */
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_PoolCreate);
+EXPORT_SYMBOL(IFXOS_PoolDelete);
+EXPORT_SYMBOL(IFXOS_PoolAlloc);
+EXPORT_SYMBOL(IFXOS_PoolFree);
+EXPORT_SYMBOL(IFXOS_PoolStatsGet);
+#if ( defined(IFXOS_HAVE_MEM_POOL_BENCHMARK) && (IFXOS_HAVE_MEM_POOL_BENCHMARK == 1) )
+EXPORT_SYMBOL(IFXOS_PoolBenchmark);
+#endif
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) ) */
+
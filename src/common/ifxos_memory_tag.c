@@ -0,0 +1,341 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS memory tags - attribution of the allocated
+   bytes to an owner (module).
+
+\par Implementation
+   A tagged block is allocated via \ref IFXOS_MemAlloc with a small header in
+   front of the user data, the header keeps the tag and the size for the free.
+   The counters of a tag are split into CPU slots (atomic counters, one cache
+   line per slot), so concurrent allocations on different CPUs do not share
+   a counter. The live bytes are the sum over all slots, the peak is updated
+   on allocation if the sum exceeds the current peak.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     include <linux/smp.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  else
+#     ifndef _GNU_SOURCE
+#        define _GNU_SOURCE     1
+#     endif
+#     include <sched.h>
+#  endif
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_memory_alloc.h"
+#include "ifxos_sys_show.h"
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - memory tag, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/** size of the block header, keeps the alignment of the user data */
+#define IFXOS_MEM_TAG_HDR_SIZE            16
+
+/** counter slot index of the current CPU */
+#define IFXOS_MEM_TAG_SLOT_INDEX() \
+            ((IFX_uint32_t)(IFXOS_MEM_COUNTER_CPU_ID() & (IFXOS_MEM_TAG_CPU_SLOTS - 1)))
+
+/**
+   Memory tag - block header, placed in front of the user data.
+*/
+typedef union
+{
+   struct
+   {
+      /** tag of the block, IFX_NULL after free */
+      IFXOS_MemTag_t *pTag;
+      /** requested size [byte] */
+      IFX_uint32_t   size;
+      /** counter slot of the allocation */
+      IFX_uint32_t   slot;
+   } hdr;
+   /** padding - alignment of the user data */
+   IFX_uint8_t pad[IFXOS_MEM_TAG_HDR_SIZE];
+} IFXOS_MemTagHdr_t;
+
+/* ============================================================================
+   IFX OS adaptation - memory tag, local functions
+   ========================================================================= */
+
+/**
+   Sum of the live bytes over all CPU slots.
+*/
+IFXOS_STATIC IFX_long_t IFXOS_MemTagLiveGet(
+               IFXOS_MemTag_t *pTag)
+{
+   IFX_long_t  liveBytes = 0;
+   IFX_uint_t  i;
+
+   for (i = 0; i < IFXOS_MEM_TAG_CPU_SLOTS; i++)
+   {
+      liveBytes += IFXOS_MEM_COUNTER_GET(&pTag->slot[i].cnt.liveBytes);
+   }
+
+   return liveBytes;
+}
+
+/* ============================================================================
+   IFX OS adaptation - memory tag, functions
+   ========================================================================= */
+
+/**
+   Initialize a memory tag.
+
+\param
+   pTag     Points to the tag object.
+\param
+   pName    Name of the tag, the string is referenced (not copied).
+
+\return
+   IFX_SUCCESS if the tag has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTagInit(
+               IFXOS_MemTag_t    *pTag,
+               const IFX_char_t  *pName)
+{
+   IFX_uint_t  i;
+
+   if (pTag == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Tag Init, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   for (i = 0; i < IFXOS_MEM_TAG_CPU_SLOTS; i++)
+   {
+      IFXOS_MEM_COUNTER_SET(&pTag->slot[i].cnt.liveBytes, 0);
+      IFXOS_MEM_COUNTER_SET(&pTag->slot[i].cnt.peakBytes, 0);
+      IFXOS_MEM_COUNTER_SET(&pTag->slot[i].cnt.numOfAlloc, 0);
+      IFXOS_MEM_COUNTER_SET(&pTag->slot[i].cnt.numOfFree, 0);
+   }
+
+   pTag->pName  = (pName != IFX_NULL) ? pName : "<none>";
+   pTag->bValid = IFX_TRUE;
+
+   pTag->pSysObject = (IFX_void_t*)IFXOS_SYS_OBJECT_GET(IFXOS_SYS_OBJECT_MEM_TAG);
+   IFXOS_SYS_MEM_TAG_PARAMS_SET(pTag->pSysObject, pTag);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Delete a memory tag.
+
+\param
+   pTag     Points to the tag object.
+
+\return
+   IFX_SUCCESS if the tag has been deleted, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTagDelete(
+               IFXOS_MemTag_t    *pTag)
+{
+   IFX_long_t liveBytes;
+
+   if ((pTag == IFX_NULL) || (pTag->bValid != IFX_TRUE))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Tag Delete, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   liveBytes = IFXOS_MemTagLiveGet(pTag);
+   if (liveBytes != 0)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("IFXOS WARNING - Mem Tag Delete <%s>, %ld byte still in use" IFXOS_CRLF,
+           pTag->pName, (long)liveBytes));
+   }
+
+   IFXOS_SYS_OBJECT_RELEASE(pTag->pSysObject);
+   pTag->bValid = IFX_FALSE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Allocate Memory Space from the OS and account it to a tag.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   pTag           Points to the tag object.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocTagged(
+               IFX_size_t     memSize_byte,
+               IFXOS_MemTag_t *pTag)
+{
+   IFXOS_MemTagHdr_t    *pHdr;
+   IFXOS_MemTagSlot_t   *pSlot;
+   IFX_uint32_t         slot;
+   IFX_long_t           liveBytes;
+
+   if ((pTag == IFX_NULL) || (pTag->bValid != IFX_TRUE) || (memSize_byte == 0))
+   {
+      return IFX_NULL;
+   }
+
+   /* the block header keeps a 32 bit size */
+   if ((IFX_size_t)(IFX_uint32_t)memSize_byte != memSize_byte)
+   {
+      return IFX_NULL;
+   }
+
+   pHdr = (IFXOS_MemTagHdr_t *)IFXOS_MEM_ALLOC_CALLER(sizeof(IFXOS_MemTagHdr_t) + memSize_byte);
+   if (pHdr == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+   slot = IFXOS_MEM_TAG_SLOT_INDEX();
+   pHdr->hdr.pTag = pTag;
+   pHdr->hdr.size = (IFX_uint32_t)memSize_byte;
+   pHdr->hdr.slot = slot;
+
+   pSlot = &pTag->slot[slot];
+   IFXOS_MEM_COUNTER_ADD(&pSlot->cnt.liveBytes, memSize_byte);
+   IFXOS_MEM_COUNTER_ADD(&pSlot->cnt.numOfAlloc, 1);
+
+   /* peak of the slot - concurrent updates may lose a slightly higher value */
+   liveBytes = IFXOS_MEM_COUNTER_GET(&pSlot->cnt.liveBytes);
+   if (liveBytes > IFXOS_MEM_COUNTER_GET(&pSlot->cnt.peakBytes))
+   {
+      IFXOS_MEM_COUNTER_SET(&pSlot->cnt.peakBytes, liveBytes);
+   }
+
+   return (IFX_void_t *)(pHdr + 1);
+}
+
+/**
+   Free a Memory Space allocated via \ref IFXOS_MemAllocTagged.
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeTagged(
+               IFX_void_t     *pMemBlock)
+{
+   IFXOS_MemTagHdr_t    *pHdr;
+   IFXOS_MemTagSlot_t   *pSlot;
+   IFXOS_MemTag_t       *pTag;
+
+   if (pMemBlock == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("WARNING - Cannot free tagged NULL pointer" IFXOS_CRLF));
+
+      return;
+   }
+
+   pHdr = (IFXOS_MemTagHdr_t *)pMemBlock - 1;
+   pTag = pHdr->hdr.pTag;
+   if (pTag == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Free Tagged, block 0x%p already freed" IFXOS_CRLF,
+           pMemBlock));
+
+      return;
+   }
+
+   /* slot of the allocation, the slot counters never become negative */
+   pSlot = &pTag->slot[pHdr->hdr.slot];
+   IFXOS_MEM_COUNTER_ADD(&pSlot->cnt.liveBytes, -(IFX_long_t)pHdr->hdr.size);
+   IFXOS_MEM_COUNTER_ADD(&pSlot->cnt.numOfFree, 1);
+
+   pHdr->hdr.pTag = IFX_NULL;
+   IFXOS_MemFree(pHdr);
+
+   return;
+}
+
+/**
+   Get the statistics of a memory tag.
+
+\param
+   pTag     Points to the tag object.
+\param
+   pStats   Returns the statistics.
+
+\return
+   IFX_SUCCESS if the statistics are returned, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTagStatsGet(
+               IFXOS_MemTag_t       *pTag,
+               IFXOS_MemTagStats_t  *pStats)
+{
+   IFX_long_t  liveBytes, peakBytes = 0;
+   IFX_uint_t  i;
+
+   if ((pTag == IFX_NULL) || (pTag->bValid != IFX_TRUE) || (pStats == IFX_NULL))
+   {
+      return IFX_ERROR;
+   }
+
+   pStats->numOfAlloc = 0;
+   pStats->numOfFree  = 0;
+   for (i = 0; i < IFXOS_MEM_TAG_CPU_SLOTS; i++)
+   {
+      pStats->numOfAlloc += (IFX_ulong_t)IFXOS_MEM_COUNTER_GET(&pTag->slot[i].cnt.numOfAlloc);
+      pStats->numOfFree  += (IFX_ulong_t)IFXOS_MEM_COUNTER_GET(&pTag->slot[i].cnt.numOfFree);
+      peakBytes          += IFXOS_MEM_COUNTER_GET(&pTag->slot[i].cnt.peakBytes);
+   }
+
+   /* the slots are read one by one, the sum is not a snapshot */
+   liveBytes = IFXOS_MemTagLiveGet(pTag);
+   pStats->liveBytes = (liveBytes > 0) ? (IFX_size_t)liveBytes : 0;
+   pStats->peakBytes = (IFX_size_t)peakBytes;
+
+   return IFX_SUCCESS;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_MemTagInit);
+EXPORT_SYMBOL(IFXOS_MemTagDelete);
+EXPORT_SYMBOL(IFXOS_MemAllocTagged);
+EXPORT_SYMBOL(IFXOS_MemFreeTagged);
+EXPORT_SYMBOL(IFXOS_MemTagStatsGet);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) ) */
+
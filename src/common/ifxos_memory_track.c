@@ -0,0 +1,544 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS memory leak tracker - records the call site
+   and the size of each live allocation.
+
+\par Implementation
+   The live allocations are kept within a hash table (key: block address)
+   which is split into \ref IFXOS_MEM_TRACK_SHARDS shards with a lock each,
+   so concurrent allocations rarely wait for each other.
+   The entries are preallocated on start and kept within a free list per
+   shard, so the tracker itself does not allocate on the alloc / free path.
+   The show aggregates the live entries per call site and prints the sites
+   with the most live bytes.
+   A stop only empties the shards (under the shard lock) and releases the
+   entries, the shards and their locks are kept up to \ref IFXOS_MemTrackRelease
+   at process / module exit. So an allocation or free which has passed the
+   enabled check before the stop finds an empty shard instead of freed memory.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     include <linux/string.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  else
+#     include <string.h>
+#  endif
+#else
+#  include <string.h>
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_print.h"
+#include "ifxos_memory_alloc.h"
+
+#if ( defined(IFXOS_HAVE_MEM_TRACK) && (IFXOS_HAVE_MEM_TRACK == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - leak tracker, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/**
+   Leak tracker - record of a live allocation.
+*/
+typedef struct IFXOS_MemTrackEntry_s
+{
+   /** next entry within the bucket / free list */
+   struct IFXOS_MemTrackEntry_s *pNext;
+   /** allocated block */
+   IFX_void_t        *pBlock;
+   /** size of the block [byte] */
+   IFX_size_t        size;
+   /** call site of the allocation */
+   IFX_void_t        *pCaller;
+} IFXOS_MemTrackEntry_t;
+
+/**
+   Leak tracker - hash table shard.
+*/
+typedef struct
+{
+   /** protects the shard */
+   IFXOS_PoolLock_t        lock;
+   /** free entries */
+   IFXOS_MemTrackEntry_t   *pFreeList;
+   /** number of allocations which are not recorded (no free entry) */
+   IFX_uint32_t            numOfDropped;
+   /** hash buckets */
+   IFXOS_MemTrackEntry_t   *pBucket[IFXOS_MEM_TRACK_BUCKETS];
+} IFXOS_MemTrackShard_t;
+
+/**
+   Leak tracker - live bytes per call site, for the show.
+*/
+typedef struct
+{
+   /** call site */
+   IFX_void_t     *pCaller;
+   /** live bytes */
+   IFX_size_t     liveBytes;
+   /** number of live blocks */
+   IFX_uint32_t   numOfBlocks;
+} IFXOS_MemTrackSite_t;
+
+/* ============================================================================
+   IFX OS adaptation - leak tracker, variables
+   ========================================================================= */
+
+/** Leak tracker - enabled flag, checked by the allocation functions */
+volatile IFX_boolean_t IFXOS_memTrackEnabled = IFX_FALSE;
+
+/** Leak tracker - hash table shards */
+IFXOS_STATIC IFXOS_MemTrackShard_t *pIFXOS_memTrackShard = IFX_NULL;
+/** Leak tracker - preallocated entries */
+IFXOS_STATIC IFXOS_MemTrackEntry_t *pIFXOS_memTrackEntry = IFX_NULL;
+
+/* ============================================================================
+   IFX OS adaptation - leak tracker, local functions
+   ========================================================================= */
+
+/**
+   Hash of a block address, the low bits select the shard, the following
+   bits the bucket.
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_MemTrackHash(
+               IFX_void_t        *pBlock)
+{
+   IFX_uint32_t hash;
+
+   hash  = (IFX_uint32_t)((IFX_uintptr_t)pBlock >> 4) * 0x9E3779B1U;
+   hash ^= hash >> 16;
+
+   return hash;
+}
+
+#define IFXOS_MEM_TRACK_SHARD_GET(hash) \
+            (&pIFXOS_memTrackShard[(hash) & (IFXOS_MEM_TRACK_SHARDS - 1)])
+#define IFXOS_MEM_TRACK_BUCKET_GET(hash) \
+            (((hash) / IFXOS_MEM_TRACK_SHARDS) & (IFXOS_MEM_TRACK_BUCKETS - 1))
+
+/**
+   Add the live bytes of all entries of a shard to the call site table.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_MemTrackShardCollect(
+               IFXOS_MemTrackShard_t   *pShard,
+               IFXOS_MemTrackSite_t    *pSite,
+               IFXOS_MemTrackSite_t    *pOther)
+{
+   IFXOS_MemTrackEntry_t   *pEntry;
+   IFX_uint32_t            b, idx, n;
+
+   for (b = 0; b < IFXOS_MEM_TRACK_BUCKETS; b++)
+   {
+      for (pEntry = pShard->pBucket[b]; pEntry != IFX_NULL; pEntry = pEntry->pNext)
+      {
+         /* open addressing by call site */
+         idx = IFXOS_MemTrackHash(pEntry->pCaller) & (IFXOS_MEM_TRACK_SITES_MAX - 1);
+         for (n = 0; n < IFXOS_MEM_TRACK_SITES_MAX; n++)
+         {
+            if ((pSite[idx].pCaller == pEntry->pCaller) || (pSite[idx].numOfBlocks == 0))
+               break;
+            idx = (idx + 1) & (IFXOS_MEM_TRACK_SITES_MAX - 1);
+         }
+
+         if (n == IFXOS_MEM_TRACK_SITES_MAX)
+         {
+            pOther->liveBytes += pEntry->size;
+            pOther->numOfBlocks++;
+            continue;
+         }
+
+         pSite[idx].pCaller = pEntry->pCaller;
+         pSite[idx].liveBytes += pEntry->size;
+         pSite[idx].numOfBlocks++;
+      }
+   }
+
+   return;
+}
+
+/* ============================================================================
+   IFX OS adaptation - leak tracker, functions
+   ========================================================================= */
+
+/**
+   Start the leak tracker.
+
+\param
+   maxEntries  Max number of recorded live allocations.
+
+\return
+   IFX_SUCCESS if the tracker has been started, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTrackInit(
+               IFX_uint32_t   maxEntries)
+{
+   IFXOS_MemTrackShard_t   *pShard;
+   IFXOS_MemTrackEntry_t   *pEntry;
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_uint32_t            i, j;
+
+   if ((IFXOS_memTrackEnabled == IFX_TRUE) || (maxEntries == 0))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Track Init, %s" IFXOS_CRLF,
+           (maxEntries == 0) ? "no entries" : "already started"));
+
+      return IFX_ERROR;
+   }
+
+   /* the shards are kept after a stop, see IFXOS_MemTrackRelease */
+   if (pIFXOS_memTrackShard == IFX_NULL)
+   {
+      pShard = (IFXOS_MemTrackShard_t *)IFXOS_BlockAlloc(
+                  IFXOS_MEM_TRACK_SHARDS * sizeof(IFXOS_MemTrackShard_t));
+      if (pShard == IFX_NULL)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Mem Track Init, no memory for the shards" IFXOS_CRLF));
+
+         return IFX_ERROR;
+      }
+
+      memset(pShard, 0x00, IFXOS_MEM_TRACK_SHARDS * sizeof(IFXOS_MemTrackShard_t));
+      for (i = 0; i < IFXOS_MEM_TRACK_SHARDS; i++)
+      {
+         IFXOS_POOL_LOCK_INIT(&pShard[i].lock);
+      }
+      pIFXOS_memTrackShard = pShard;
+   }
+
+   pEntry = (IFXOS_MemTrackEntry_t *)IFXOS_BlockAlloc(
+               maxEntries * sizeof(IFXOS_MemTrackEntry_t));
+   if (pEntry == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Track Init, no memory for %u entries" IFXOS_CRLF,
+           maxEntries));
+
+      return IFX_ERROR;
+   }
+
+   /* distribute the entries round robin over the shards */
+   for (i = 0; i < IFXOS_MEM_TRACK_SHARDS; i++)
+   {
+      pShard = &pIFXOS_memTrackShard[i];
+
+      IFXOS_POOL_LOCK_GET(&pShard->lock, lockFlags);
+      for (j = i; j < maxEntries; j += IFXOS_MEM_TRACK_SHARDS)
+      {
+         pEntry[j].pNext = pShard->pFreeList;
+         pShard->pFreeList = &pEntry[j];
+      }
+      IFXOS_POOL_LOCK_RELEASE(&pShard->lock, lockFlags);
+   }
+   pIFXOS_memTrackEntry = pEntry;
+
+   IFXOS_memTrackEnabled = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Stop the leak tracker and release the entries.
+
+\return
+   IFX_SUCCESS if the tracker has been stopped, else
+   IFX_ERROR.
+
+\remarks
+   The shards are emptied under their lock and kept, concurrent callers which
+   are already within the tracker find an empty shard.
+*/
+IFX_int32_t IFXOS_MemTrackCleanup(IFX_void_t)
+{
+   IFXOS_MemTrackShard_t   *pShard;
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_uint32_t            i;
+
+   if (IFXOS_memTrackEnabled != IFX_TRUE)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Track Cleanup, not started" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   IFXOS_memTrackEnabled = IFX_FALSE;
+
+   /* no entry is referenced by a shard after this */
+   for (i = 0; i < IFXOS_MEM_TRACK_SHARDS; i++)
+   {
+      pShard = &pIFXOS_memTrackShard[i];
+
+      IFXOS_POOL_LOCK_GET(&pShard->lock, lockFlags);
+      pShard->pFreeList    = IFX_NULL;
+      pShard->numOfDropped = 0;
+      memset(pShard->pBucket, 0x00, sizeof(pShard->pBucket));
+      IFXOS_POOL_LOCK_RELEASE(&pShard->lock, lockFlags);
+   }
+
+   IFXOS_BlockFree(pIFXOS_memTrackEntry);
+   pIFXOS_memTrackEntry = IFX_NULL;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Release the leak tracker tables (shards and locks).
+
+\return
+   IFX_SUCCESS if the tables have been released, else
+   IFX_ERROR.
+
+\remarks
+   Only at process / module exit, no other thread may allocate or free
+   memory at this time. A running tracker is stopped before.
+*/
+IFX_int32_t IFXOS_MemTrackRelease(IFX_void_t)
+{
+   IFX_uint32_t i;
+
+   if (IFXOS_memTrackEnabled == IFX_TRUE)
+   {
+      (void)IFXOS_MemTrackCleanup();
+   }
+
+   if (pIFXOS_memTrackShard == IFX_NULL)
+      return IFX_SUCCESS;
+
+   for (i = 0; i < IFXOS_MEM_TRACK_SHARDS; i++)
+   {
+      IFXOS_POOL_LOCK_DELETE(&pIFXOS_memTrackShard[i].lock);
+   }
+
+   IFXOS_BlockFree(pIFXOS_memTrackShard);
+   pIFXOS_memTrackShard = IFX_NULL;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Record a live allocation.
+
+\param
+   pBlock   Points to the allocated block.
+\param
+   size     Size of the block [byte].
+\param
+   pCaller  Call site of the allocation.
+*/
+IFX_void_t IFXOS_MemTrackAdd(
+               IFX_void_t        *pBlock,
+               IFX_size_t        size,
+               IFX_void_t        *pCaller)
+{
+   IFXOS_MemTrackShard_t   *pShard;
+   IFXOS_MemTrackEntry_t   *pEntry;
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_uint32_t            hash, b;
+
+   hash   = IFXOS_MemTrackHash(pBlock);
+   pShard = IFXOS_MEM_TRACK_SHARD_GET(hash);
+   b      = IFXOS_MEM_TRACK_BUCKET_GET(hash);
+
+   IFXOS_POOL_LOCK_GET(&pShard->lock, lockFlags);
+
+   pEntry = pShard->pFreeList;
+   if (pEntry != IFX_NULL)
+   {
+      pShard->pFreeList = pEntry->pNext;
+
+      pEntry->pBlock  = pBlock;
+      pEntry->size    = size;
+      pEntry->pCaller = pCaller;
+      pEntry->pNext   = pShard->pBucket[b];
+      pShard->pBucket[b] = pEntry;
+   }
+   else
+   {
+      pShard->numOfDropped++;
+   }
+
+   IFXOS_POOL_LOCK_RELEASE(&pShard->lock, lockFlags);
+
+   return;
+}
+
+/**
+   Remove the record of a freed allocation.
+
+\param
+   pBlock   Points to the freed block.
+
+\remarks
+   Blocks which are not recorded (allocated before the start or dropped) are
+   ignored.
+*/
+IFX_void_t IFXOS_MemTrackRemove(
+               IFX_void_t        *pBlock)
+{
+   IFXOS_MemTrackShard_t   *pShard;
+   IFXOS_MemTrackEntry_t   *pEntry, **ppPrev;
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_uint32_t            hash;
+
+   hash   = IFXOS_MemTrackHash(pBlock);
+   pShard = IFXOS_MEM_TRACK_SHARD_GET(hash);
+   ppPrev = &pShard->pBucket[IFXOS_MEM_TRACK_BUCKET_GET(hash)];
+
+   IFXOS_POOL_LOCK_GET(&pShard->lock, lockFlags);
+
+   for (pEntry = *ppPrev; pEntry != IFX_NULL; ppPrev = &pEntry->pNext, pEntry = pEntry->pNext)
+   {
+      if (pEntry->pBlock == pBlock)
+      {
+         *ppPrev = pEntry->pNext;
+         pEntry->pNext = pShard->pFreeList;
+         pShard->pFreeList = pEntry;
+         break;
+      }
+   }
+
+   IFXOS_POOL_LOCK_RELEASE(&pShard->lock, lockFlags);
+
+   return;
+}
+
+/**
+   Print the call sites with the most live bytes.
+
+\param
+   topN     Number of call sites to print, 0 selects all.
+
+\return
+   IFX_SUCCESS if the call sites have been printed, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTrackShow(
+               IFX_uint32_t   topN)
+{
+   IFXOS_MemTrackSite_t    *pSite, other = {IFX_NULL, 0, 0};
+   IFXOS_PoolLockFlags_t   lockFlags;
+   IFX_size_t              liveBytes = 0;
+   IFX_uint32_t            i, n, maxIdx, numOfBlocks = 0, numOfSites = 0, numOfDropped = 0;
+
+   if (IFXOS_memTrackEnabled != IFX_TRUE)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Track Show, not started" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   pSite = (IFXOS_MemTrackSite_t *)IFXOS_BlockAlloc(
+                        IFXOS_MEM_TRACK_SITES_MAX * sizeof(IFXOS_MemTrackSite_t));
+   if (pSite == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Track Show, no memory" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+   /* the show table itself is not a leak candidate */
+   IFXOS_MemTrackRemove(pSite);
+   memset(pSite, 0x00, IFXOS_MEM_TRACK_SITES_MAX * sizeof(IFXOS_MemTrackSite_t));
+
+   for (i = 0; i < IFXOS_MEM_TRACK_SHARDS; i++)
+   {
+      IFXOS_POOL_LOCK_GET(&pIFXOS_memTrackShard[i].lock, lockFlags);
+      IFXOS_MemTrackShardCollect(&pIFXOS_memTrackShard[i], pSite, &other);
+      numOfDropped += pIFXOS_memTrackShard[i].numOfDropped;
+      IFXOS_POOL_LOCK_RELEASE(&pIFXOS_memTrackShard[i].lock, lockFlags);
+   }
+
+   for (i = 0; i < IFXOS_MEM_TRACK_SITES_MAX; i++)
+   {
+      if (pSite[i].numOfBlocks != 0)
+      {
+         liveBytes   += pSite[i].liveBytes;
+         numOfBlocks += pSite[i].numOfBlocks;
+         numOfSites++;
+      }
+   }
+   liveBytes   += other.liveBytes;
+   numOfBlocks += other.numOfBlocks;
+
+   IFXOS_DBG_PRINT_USR(
+      "IFXOS Mem Track - live: %lu byte, %u blocks, %u call sites (not tracked: %u allocations)" IFXOS_CRLF,
+      (IFX_ulong_t)liveBytes, numOfBlocks, numOfSites, numOfDropped);
+
+   if ((topN == 0) || (topN > numOfSites))
+      topN = numOfSites;
+
+   /* select the sites with the most live bytes, printed sites are cleared */
+   for (n = 0; n < topN; n++)
+   {
+      maxIdx = IFXOS_MEM_TRACK_SITES_MAX;
+      for (i = 0; i < IFXOS_MEM_TRACK_SITES_MAX; i++)
+      {
+         if ((pSite[i].numOfBlocks != 0) &&
+             ((maxIdx == IFXOS_MEM_TRACK_SITES_MAX) || (pSite[i].liveBytes > pSite[maxIdx].liveBytes)))
+         {
+            maxIdx = i;
+         }
+      }
+
+      IFXOS_DBG_PRINT_USR(
+         "IFXOS Mem Track - %3u: %10lu byte %8u blocks  " IFXOS_MEM_TRACK_CALLER_FMT IFXOS_CRLF,
+         n + 1, (IFX_ulong_t)pSite[maxIdx].liveBytes, pSite[maxIdx].numOfBlocks,
+         pSite[maxIdx].pCaller);
+
+      pSite[maxIdx].numOfBlocks = 0;
+   }
+
+   if (other.numOfBlocks != 0)
+   {
+      IFXOS_DBG_PRINT_USR(
+         "IFXOS Mem Track - other: %10lu byte %8u blocks (call site table full)" IFXOS_CRLF,
+         (IFX_ulong_t)other.liveBytes, other.numOfBlocks);
+   }
+
+   IFXOS_BlockFree(pSite);
+
+   return IFX_SUCCESS;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_memTrackEnabled);
+EXPORT_SYMBOL(IFXOS_MemTrackInit);
+EXPORT_SYMBOL(IFXOS_MemTrackCleanup);
+EXPORT_SYMBOL(IFXOS_MemTrackRelease);
+EXPORT_SYMBOL(IFXOS_MemTrackAdd);
+EXPORT_SYMBOL(IFXOS_MemTrackRemove);
+EXPORT_SYMBOL(IFXOS_MemTrackShow);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_TRACK) && (IFXOS_HAVE_MEM_TRACK == 1) ) */
+
@@ -83,6 +83,8 @@
 
       typedef int IFXOS_SYS_LOCK_t;
 #  endif
+#  include <stdio.h>
+#  include <unistd.h>
 #  endif
 
 #elif defined(VXWORKS)
@@ -491,6 +493,18 @@ IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemAlloc(
                   IFXOS_sys_object_mem_t     *pSysObjMemory);
 #endif
 
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) )
+IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemPool(
+                  IFX_uint_t                    objIndex,
+                  IFXOS_sys_object_mem_pool_t   *pSysObjMemPool);
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) )
+IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemTag(
+                  IFX_uint_t                    objIndex,
+                  IFXOS_sys_object_mem_tag_t    *pSysObjMemTag);
+#endif
+
 #if ( defined(IFXOS_HAVE_LOCK) && (IFXOS_HAVE_LOCK == 1) )
 IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Lock(
                   IFX_uint_t                 objIndex,
@@ -510,6 +524,15 @@ IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Event(
 #endif
 
 #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) )
+#if defined(LINUX) && !defined(__KERNEL__)
+IFXOS_STATIC IFX_int_t IFXOS_SysObjectThreadProcUsageGet(
+                  IFX_int_t                  taskId,
+                  IFX_uint_t                 *pUsrTime_ms,
+                  IFX_uint_t                 *pSysTime_ms,
+                  IFX_uint_t                 *pVolCtxSw,
+                  IFX_uint_t                 *pInvolCtxSw);
+#endif
+
 IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Thread(
                   IFX_uint_t                 objIndex,
                   IFXOS_sys_object_thread_t  *pSysObjThread);
@@ -553,9 +576,79 @@ IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemAlloc(
    if (pSysObjMemory != IFX_NULL)
    {
       IFXOS_DBG_PRINT_USR(
-            "SysObj[%03d] Mem - calls: %d / %d (alloc / free)" IFXOS_CRLF,
-            objIndex, pSysObjMemory->numOfMemAlloc, pSysObjMemory->numOfMemFree);
+            "SysObj[%03d] Mem - calls: %ld / %ld (alloc / free)" IFXOS_CRLF,
+            objIndex,
+            (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfMemAlloc),
+            (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfMemFree));
+
+      if ((IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfSlabAlloc) != 0) ||
+          (IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfVirtAlloc) != 0))
+      {
+         IFXOS_DBG_PRINT_USR(
+               "SysObj[%03d] Mem - backing: %ld / %ld (slab / vmalloc)" IFXOS_CRLF,
+               objIndex,
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfSlabAlloc),
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfVirtAlloc));
+      }
+
+      if (IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfLargeAlloc) != 0)
+      {
+         IFXOS_DBG_PRINT_USR(
+               "SysObj[%03d] Mem - large: %ld / %ld (alloc / free), %ld huge page, curr size %ld" IFXOS_CRLF,
+               objIndex,
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfLargeAlloc),
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfLargeFree),
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->numOfLargeHuge),
+               (long)IFXOS_SYS_MEM_COUNTER_GET(&pSysObjMemory->currLargeSize));
+      }
+   }
+}
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) )
+IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemPool(
+                  IFX_uint_t                    objIndex,
+                  IFXOS_sys_object_mem_pool_t   *pSysObjMemPool)
+{
+   if (pSysObjMemPool != IFX_NULL)
+   {
+      IFXOS_DBG_PRINT_USR(
+            "SysObj[%03d] Mem Pool - elem size %u, elements %u (slabs %u), free %u, in use %u (max %u)" IFXOS_CRLF,
+            objIndex, pSysObjMemPool->elemSize,
+            pSysObjMemPool->numOfElem, pSysObjMemPool->numOfSlabs,
+            pSysObjMemPool->numOfElem - pSysObjMemPool->currInUse,
+            pSysObjMemPool->currInUse, pSysObjMemPool->maxInUse);
 
+      IFXOS_DBG_PRINT_USR(
+            "SysObj[%03d] Mem Pool - elements: %u / %u (alloc / free), alloc fails %u" IFXOS_CRLF,
+            objIndex, pSysObjMemPool->numOfAlloc, pSysObjMemPool->numOfFree,
+            pSysObjMemPool->numOfAllocFails);
+   }
+}
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) )
+IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_MemTag(
+                  IFX_uint_t                    objIndex,
+                  IFXOS_sys_object_mem_tag_t    *pSysObjMemTag)
+{
+   IFXOS_MemTagStats_t tagStats;
+
+   if (pSysObjMemTag != IFX_NULL)
+   {
+      if (IFXOS_MemTagStatsGet(
+               (IFXOS_MemTag_t *)pSysObjMemTag->pThis, &tagStats) != IFX_SUCCESS)
+      {
+         return;
+      }
+
+      IFXOS_DBG_PRINT_USR(
+            "SysObj[%03d] Mem Tag - bytes: %lu live, %lu peak" IFXOS_CRLF,
+            objIndex, (IFX_ulong_t)tagStats.liveBytes, (IFX_ulong_t)tagStats.peakBytes);
+
+      IFXOS_DBG_PRINT_USR(
+            "SysObj[%03d] Mem Tag - calls: %lu / %lu (alloc / free)" IFXOS_CRLF,
+            objIndex, tagStats.numOfAlloc, tagStats.numOfFree);
    }
 }
 #endif
@@ -623,10 +716,80 @@ IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Event(
 
 
 #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) )
+#if defined(LINUX) && !defined(__KERNEL__)
+/**
+   Read the CPU times and context switches of a thread of the own process
+   from "/proc/self/task/<tid>/stat" and "/proc/self/task/<tid>/status".
+
+\return
+   IFX_SUCCESS if the values have been read, else IFX_ERROR.
+*/
+IFXOS_STATIC IFX_int_t IFXOS_SysObjectThreadProcUsageGet(
+                  IFX_int_t                  taskId,
+                  IFX_uint_t                 *pUsrTime_ms,
+                  IFX_uint_t                 *pSysTime_ms,
+                  IFX_uint_t                 *pVolCtxSw,
+                  IFX_uint_t                 *pInvolCtxSw)
+{
+   FILE           *pFile;
+   IFX_char_t     procPath[64], procLine[512], *pPos;
+   unsigned long  usrTicks = 0, sysTicks = 0, nVolCtxSw = 0, nInvolCtxSw = 0;
+   long           ticksPerSec = sysconf(_SC_CLK_TCK);
+   IFX_int_t      nFound = 0;
+
+   if ((taskId <= 0) || (ticksPerSec <= 0))
+      return IFX_ERROR;
+
+   sprintf(procPath, "/proc/self/task/%d/stat", taskId);
+   pFile = fopen(procPath, "r");
+   if (pFile == IFX_NULL)
+      return IFX_ERROR;
+
+   if (fgets(procLine, sizeof(procLine), pFile) != IFX_NULL)
+   {
+      /* skip "pid (comm) ", the comm field may contain spaces */
+      pPos = strrchr(procLine, ')');
+      if ( (pPos != IFX_NULL) &&
+           (sscanf(pPos + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+                   &usrTicks, &sysTicks) == 2) )
+      {
+         nFound++;
+      }
+   }
+   fclose(pFile);
+
+   sprintf(procPath, "/proc/self/task/%d/status", taskId);
+   pFile = fopen(procPath, "r");
+   if (pFile != IFX_NULL)
+   {
+      while (fgets(procLine, sizeof(procLine), pFile) != IFX_NULL)
+      {
+         if (sscanf(procLine, "voluntary_ctxt_switches: %lu", &nVolCtxSw) == 1)
+            nFound++;
+         else if (sscanf(procLine, "nonvoluntary_ctxt_switches: %lu", &nInvolCtxSw) == 1)
+            nFound++;
+      }
+      fclose(pFile);
+   }
+
+   if (nFound != 3)
+      return IFX_ERROR;
+
+   *pUsrTime_ms = (IFX_uint_t)((usrTicks * 1000) / (unsigned long)ticksPerSec);
+   *pSysTime_ms = (IFX_uint_t)((sysTicks * 1000) / (unsigned long)ticksPerSec);
+   *pVolCtxSw   = (IFX_uint_t)nVolCtxSw;
+   *pInvolCtxSw = (IFX_uint_t)nInvolCtxSw;
+
+   return IFX_SUCCESS;
+}
+#endif
+
 IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Thread(
                   IFX_uint_t                 objIndex,
                   IFXOS_sys_object_thread_t  *pSysObjThread)
 {
+   IFX_uint_t usrTime_ms, sysTime_ms, nVolCtxSw, nInvolCtxSw;
+
    if (pSysObjThread != IFX_NULL)
    {
       IFXOS_DBG_PRINT_USR(
@@ -642,6 +805,29 @@ IFXOS_STATIC IFX_void_t IFXOS_SysObjectShow_Thread(
                pSysObjThread->pThis->nPriority,
                pSysObjThread->pThis->thrParams.bRunning);
 
+         /* values sampled at thread end, running threads are read from the system */
+         usrTime_ms  = pSysObjThread->cpuUserTime_ms;
+         sysTime_ms  = pSysObjThread->cpuSysTime_ms;
+         nVolCtxSw   = pSysObjThread->numOfVolCtxSwitch;
+         nInvolCtxSw = pSysObjThread->numOfInvolCtxSwitch;
+#if defined(LINUX) && !defined(__KERNEL__)
+         if (pSysObjThread->pThis->thrParams.bRunning)
+         {
+            (void)IFXOS_SysObjectThreadProcUsageGet(pSysObjThread->taskId,
+                     &usrTime_ms, &sysTime_ms, &nVolCtxSw, &nInvolCtxSw);
+         }
+#endif
+         IFXOS_DBG_PRINT_USR(
+               "SysObj[%03d] THREAD - task %d, cpu %u / %u [ms] (usr / sys), ctx switch %u / %u (vol / invol)" IFXOS_CRLF,
+               objIndex, pSysObjThread->taskId,
+               usrTime_ms, sysTime_ms, nVolCtxSw, nInvolCtxSw);
+
+         IFXOS_DBG_PRINT_USR(
+               "SysObj[%03d] THREAD - wakeups %u, latency [us]: last %u, avg %u, max %u" IFXOS_CRLF,
+               objIndex, pSysObjThread->numOfWakeup,
+               pSysObjThread->wakeupLatencyLast_us, pSysObjThread->wakeupLatencyAvg_us,
+               pSysObjThread->wakeupLatencyMax_us);
+
 #if ( defined(HAVE_IFXOS_SYSOBJ_EXT_TRACE_SUPPORT) && (HAVE_IFXOS_SYSOBJ_EXT_TRACE_SUPPORT == 1))
                IFXOS_DBG_PRINT_USR(
                      "SysObj[%03d] THREAD - run Count = %d, Info \"%s\"" IFXOS_CRLF,
@@ -1024,6 +1210,20 @@ IFX_void_t IFXOS_SysObject_ShowObject(
             case IFXOS_SYS_OBJECT_OWN:
                break;
 
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) )
+            case IFXOS_SYS_OBJECT_MEM_POOL:
+               IFXOS_SysObjectShow_MemPool(
+                           pSysObject->objIndex, &pSysObject->uSysObject.sysObjMemPool);
+               break;
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) )
+            case IFXOS_SYS_OBJECT_MEM_TAG:
+               IFXOS_SysObjectShow_MemTag(
+                           pSysObject->objIndex, &pSysObject->uSysObject.sysObjMemTag);
+               break;
+#endif
+
 #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) )
             case IFXOS_SYS_OBJECT_MEM_ALLOC:
                IFXOS_SysObjectShow_MemAlloc(
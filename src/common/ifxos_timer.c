@@ -0,0 +1,904 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the IFXOS timer service - callback timers based on a
+   hierarchical timing wheel.
+
+\par Implementation
+   The timing wheel consists of \ref IFXOS_TIMER_WHEEL_LEVELS levels with
+   \ref IFXOS_TIMER_WHEEL_SLOTS slots. Level 0 covers the next 64 ticks with
+   one slot per tick, each further level covers 64 times the range of the
+   previous one. On each wrap of a level index the corresponding slot of the
+   next level is "cascaded" (re-sorted into the lower levels).
+
+   The dispatch thread sleeps until the next non-empty level 0 slot or the
+   next cascade is due. A timer start with an earlier expiry wakes it up.
+*/
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#ifdef LINUX
+#  ifdef __KERNEL__
+#     include <linux/kernel.h>
+#     include <linux/string.h>
+#     ifdef MODULE
+#        include <linux/module.h>
+#     endif
+#  else
+#     include <string.h>
+#  endif
+#else
+#  include <string.h>
+#endif
+
+#include "ifx_types.h"
+#include "ifxos_debug.h"
+#include "ifxos_timer.h"
+
+#if ( defined(IFXOS_HAVE_TIMER) && (IFXOS_HAVE_TIMER == 1) )
+
+/* ============================================================================
+   IFX OS adaptation - timer service, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/** index mask of a timing wheel level */
+#define IFXOS_TIMER_WHEEL_MASK      (IFXOS_TIMER_WHEEL_SLOTS - 1)
+/** max range of the timing wheel [ticks] */
+#define IFXOS_TIMER_WHEEL_RANGE     (1UL << (IFXOS_TIMER_WHEEL_BITS * IFXOS_TIMER_WHEEL_LEVELS))
+
+/** check if the tick a is before tick b (wrap around safe) */
+#define IFXOS_TIMER_TICK_BEFORE(a, b)  ((IFX_int32_t)((a) - (b)) < 0)
+
+/* ============================================================================
+   IFX OS adaptation - timer service, local function declaration
+   ========================================================================= */
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerListInit(
+               IFXOS_TimerList_t *pHead);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerListAdd(
+               IFXOS_TimerList_t *pHead,
+               IFXOS_TimerList_t *pNode);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerListRemove(
+               IFXOS_TimerList_t *pNode);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerTimeUpdate(
+               IFXOS_TimerService_t *pService);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerWheelAdd(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerUnlink(
+               IFXOS_Timer_t        *pTimer);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerArm(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer);
+
+IFXOS_STATIC IFX_boolean_t IFXOS_TimerRunCheck(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer,
+               IFX_boolean_t        bCancel);
+
+IFXOS_STATIC IFX_uint32_t IFXOS_TimerWheelRun(
+               IFXOS_TimerService_t *pService);
+
+IFXOS_STATIC IFX_uint32_t IFXOS_TimerWaitTimeGet(
+               IFXOS_TimerService_t *pService);
+
+IFXOS_STATIC IFX_void_t IFXOS_TimerReadyRun(
+               IFXOS_TimerService_t *pService);
+
+IFXOS_STATIC IFX_int32_t IFXOS_TimerDispatchThread(
+               IFXOS_ThreadParams_t *pThrParams);
+
+IFXOS_STATIC IFX_int32_t IFXOS_TimerWorkerThread(
+               IFXOS_ThreadParams_t *pThrParams);
+
+/* ============================================================================
+   IFX OS adaptation - timer service, local functions
+   ========================================================================= */
+
+/**
+   Init an empty (circular) timer list.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerListInit(
+               IFXOS_TimerList_t *pHead)
+{
+   pHead->pNext = pHead;
+   pHead->pPrev = pHead;
+}
+
+/**
+   Add a node at the end of a timer list.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerListAdd(
+               IFXOS_TimerList_t *pHead,
+               IFXOS_TimerList_t *pNode)
+{
+   pNode->pNext        = pHead;
+   pNode->pPrev        = pHead->pPrev;
+   pHead->pPrev->pNext = pNode;
+   pHead->pPrev        = pNode;
+}
+
+/**
+   Remove a node from its timer list.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerListRemove(
+               IFXOS_TimerList_t *pNode)
+{
+   pNode->pPrev->pNext = pNode->pNext;
+   pNode->pNext->pPrev = pNode->pPrev;
+   pNode->pNext = pNode;
+   pNode->pPrev = pNode;
+}
+
+/**
+   Update the current service time based on the elapsed time since the last
+   update. Must be called with the service lock held.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerTimeUpdate(
+               IFXOS_TimerService_t *pService)
+{
+   IFX_time_t     now_ms = IFXOS_ElapsedTimeMSecGet(0);
+   IFX_uint32_t   elapsed_ms;
+
+   elapsed_ms = pService->partTick_ms + (IFX_uint32_t)(now_ms - pService->lastTime_ms);
+
+   pService->lastTime_ms  = now_ms;
+   pService->nowTick     += elapsed_ms / pService->tick_ms;
+   pService->partTick_ms  = elapsed_ms % pService->tick_ms;
+}
+
+/**
+   Sort a timer into the timing wheel, based on its expiry time.
+   Must be called with the service lock held.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerWheelAdd(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer)
+{
+   IFX_uint32_t   expires = pTimer->expires;
+   IFX_uint32_t   delta;
+   IFX_int_t      level;
+
+   if (IFXOS_TIMER_TICK_BEFORE(expires, pService->runTick))
+   {
+      /* already expired - process with the next tick */
+      expires = pService->runTick;
+   }
+   else if ((expires - pService->runTick) >= IFXOS_TIMER_WHEEL_RANGE)
+   {
+      /* out of range - sort in at the end, re-sorted on expiry */
+      expires = pService->runTick + (IFX_uint32_t)(IFXOS_TIMER_WHEEL_RANGE - 1);
+   }
+   delta = expires - pService->runTick;
+
+   for (level = 0; level < (IFXOS_TIMER_WHEEL_LEVELS - 1); level++)
+   {
+      if (delta < (1UL << (IFXOS_TIMER_WHEEL_BITS * (level + 1))))
+         break;
+   }
+
+   IFXOS_TimerListAdd(
+      &pService->wheel[level][(expires >> (IFXOS_TIMER_WHEEL_BITS * level)) & IFXOS_TIMER_WHEEL_MASK],
+      &pTimer->node);
+
+   pTimer->state = IFXOS_TIMER_STATE_PENDING;
+   pService->nPending++;
+}
+
+/**
+   Remove a timer from the timing wheel or the ready list.
+   Must be called with the service lock held.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerUnlink(
+               IFXOS_Timer_t        *pTimer)
+{
+   switch (pTimer->state)
+   {
+      case IFXOS_TIMER_STATE_PENDING:
+         pTimer->pService->nPending--;
+         IFXOS_TimerListRemove(&pTimer->node);
+         break;
+
+      case IFXOS_TIMER_STATE_READY:
+         IFXOS_TimerListRemove(&pTimer->node);
+         break;
+
+      default:
+         break;
+   }
+
+   pTimer->state = IFXOS_TIMER_STATE_IDLE;
+}
+
+/**
+   Sort in a timer and wakeup the dispatch thread if the timer expires before
+   the planned wakeup. Must be called with the service lock held.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerArm(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer)
+{
+   IFXOS_TimerWheelAdd(pService, pTimer);
+
+   if (IFXOS_TIMER_TICK_BEFORE(pTimer->expires, pService->wakeTick))
+   {
+      pService->wakeTick = pTimer->expires;
+      IFXOS_EventWakeUp(&pService->dispatchEvent);
+   }
+}
+
+/**
+   Check if the callback of a timer is running, optional cancel the re-arm
+   of the periodic timer. Must be called with the service lock held.
+
+\return
+   IFX_TRUE if a callback of the timer is running.
+*/
+IFXOS_STATIC IFX_boolean_t IFXOS_TimerRunCheck(
+               IFXOS_TimerService_t *pService,
+               IFXOS_Timer_t        *pTimer,
+               IFX_boolean_t        bCancel)
+{
+   IFXOS_TimerRun_t  *pRun;
+   IFX_boolean_t     bRunning = IFX_FALSE;
+
+   for (pRun = pService->pRunList; pRun != IFX_NULL; pRun = pRun->pNext)
+   {
+      if (pRun->pTimer == pTimer)
+      {
+         bRunning = IFX_TRUE;
+         if (bCancel == IFX_TRUE)
+            pRun->bRearm = IFX_FALSE;
+      }
+   }
+
+   return bRunning;
+}
+
+/**
+   Process all ticks of the timing wheel up to the current time and move the
+   expired timers to the ready list. Must be called with the service lock held.
+
+\return
+   Number of expired timers.
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_TimerWheelRun(
+               IFXOS_TimerService_t *pService)
+{
+   IFXOS_TimerList_t deferList, *pHead;
+   IFXOS_Timer_t     *pTimer;
+   IFX_uint32_t      nExpired = 0, idx;
+   IFX_int_t         level;
+
+   IFXOS_TimerListInit(&deferList);
+
+   while (!IFXOS_TIMER_TICK_BEFORE(pService->nowTick, pService->runTick))
+   {
+      if (pService->nPending == 0)
+      {
+         /* nothing to do - skip the idle time */
+         pService->runTick = pService->nowTick + 1;
+         break;
+      }
+
+      /* cascade the next level slots on index wrap */
+      idx = pService->runTick & IFXOS_TIMER_WHEEL_MASK;
+      for (level = 1; (idx == 0) && (level < IFXOS_TIMER_WHEEL_LEVELS); level++)
+      {
+         idx = (pService->runTick >> (IFXOS_TIMER_WHEEL_BITS * level)) & IFXOS_TIMER_WHEEL_MASK;
+         pHead = &pService->wheel[level][idx];
+
+         while (pHead->pNext != pHead)
+         {
+            pTimer = (IFXOS_Timer_t *)pHead->pNext;
+            IFXOS_TimerUnlink(pTimer);
+            IFXOS_TimerWheelAdd(pService, pTimer);
+         }
+      }
+
+      pHead = &pService->wheel[0][pService->runTick & IFXOS_TIMER_WHEEL_MASK];
+      while (pHead->pNext != pHead)
+      {
+         pTimer = (IFXOS_Timer_t *)pHead->pNext;
+         IFXOS_TimerUnlink(pTimer);
+
+         if (IFXOS_TIMER_TICK_BEFORE(pService->runTick, pTimer->expires))
+         {
+            /* out of range timer, not yet expired */
+            IFXOS_TimerListAdd(&deferList, &pTimer->node);
+            continue;
+         }
+
+         IFXOS_TimerListAdd(&pService->readyList, &pTimer->node);
+         pTimer->state = IFXOS_TIMER_STATE_READY;
+         nExpired++;
+      }
+
+      /* re-sort the out of range timers */
+      while (deferList.pNext != &deferList)
+      {
+         pTimer = (IFXOS_Timer_t *)deferList.pNext;
+         IFXOS_TimerListRemove(&pTimer->node);
+         IFXOS_TimerWheelAdd(pService, pTimer);
+      }
+
+      pService->runTick++;
+   }
+
+   return nExpired;
+}
+
+/**
+   Get the time until the next timing wheel slot or cascade is due.
+   Must be called with the service lock held, after \ref IFXOS_TimerWheelRun.
+
+\return
+   Time to wait [ms].
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_TimerWaitTimeGet(
+               IFXOS_TimerService_t *pService)
+{
+   IFX_uint32_t n, tick, wait_ms = IFXOS_TIMER_IDLE_WAIT_MS;
+
+   if (pService->nPending > 0)
+   {
+      for (n = 0; n < IFXOS_TIMER_WHEEL_SLOTS; n++)
+      {
+         tick = pService->runTick + n;
+         if ( ((tick & IFXOS_TIMER_WHEEL_MASK) == 0) ||
+              (pService->wheel[0][tick & IFXOS_TIMER_WHEEL_MASK].pNext !=
+                  &pService->wheel[0][tick & IFXOS_TIMER_WHEEL_MASK]) )
+         {
+            break;
+         }
+      }
+
+      /* the runTick is already behind the current tick */
+      n = (pService->runTick + n) - pService->nowTick;
+      if (n < (IFXOS_TIMER_IDLE_WAIT_MS / pService->tick_ms))
+      {
+         wait_ms = n * pService->tick_ms - pService->partTick_ms;
+      }
+   }
+
+   pService->wakeTick = pService->nowTick +
+      (wait_ms + pService->partTick_ms) / pService->tick_ms;
+
+   return wait_ms;
+}
+
+/**
+   Call the callbacks of the expired timers and re-arm the periodic timers.
+
+\remark
+   The callback may free its timer (a periodic timer after a stop), so the
+   timer is only accessed after the callback for a pending re-arm.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TimerReadyRun(
+               IFXOS_TimerService_t *pService)
+{
+   IFXOS_Timer_t           *pTimer;
+   IFXOS_TimerCallback_t   pCallback;
+   IFX_ulong_t             nArg;
+   IFXOS_TimerRun_t        run, **ppRun;
+
+   IFXOS_LockGet(&pService->lock);
+
+   while ( (pService->readyList.pNext != &pService->readyList) &&
+           (pService->bShutDown == IFX_FALSE) )
+   {
+      pTimer = (IFXOS_Timer_t *)pService->readyList.pNext;
+      IFXOS_TimerListRemove(&pTimer->node);
+      pTimer->state = (pTimer->period != 0) ?
+                        IFXOS_TIMER_STATE_RUNNING : IFXOS_TIMER_STATE_IDLE;
+      pCallback = pTimer->pCallback;
+      nArg      = pTimer->nArg;
+
+      run.pTimer = pTimer;
+      run.bRearm = (pTimer->period != 0) ? IFX_TRUE : IFX_FALSE;
+      run.pNext  = pService->pRunList;
+      pService->pRunList = &run;
+
+      IFXOS_LockRelease(&pService->lock);
+      pCallback(pTimer, nArg);
+      IFXOS_LockGet(&pService->lock);
+
+      for (ppRun = &pService->pRunList; *ppRun != &run; ppRun = &(*ppRun)->pNext)
+         ;
+      *ppRun = run.pNext;
+
+      /* periodic timer, not stopped or restarted within the callback */
+      if (run.bRearm == IFX_TRUE)
+      {
+         /* re-arm based on the last expiry, skip missed periods */
+         IFXOS_TimerTimeUpdate(pService);
+         pTimer->expires += pTimer->period;
+         if (IFXOS_TIMER_TICK_BEFORE(pTimer->expires, pService->nowTick))
+         {
+            pTimer->expires +=
+               ((pService->nowTick - pTimer->expires + pTimer->period - 1) / pTimer->period) *
+               pTimer->period;
+         }
+         IFXOS_TimerArm(pService, pTimer);
+      }
+   }
+
+   IFXOS_LockRelease(&pService->lock);
+}
+
+/**
+   Timer service - dispatch thread.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_TimerDispatchThread(
+               IFXOS_ThreadParams_t *pThrParams)
+{
+   IFXOS_TimerService_t *pService = (IFXOS_TimerService_t *)pThrParams->nArg1;
+   IFX_uint32_t         nExpired, wait_ms;
+
+   while ( (pThrParams->bShutDown == IFX_FALSE) &&
+           (pService->bShutDown == IFX_FALSE) )
+   {
+      IFXOS_LockGet(&pService->lock);
+      IFXOS_TimerTimeUpdate(pService);
+      nExpired = IFXOS_TimerWheelRun(pService);
+      wait_ms  = IFXOS_TimerWaitTimeGet(pService);
+      IFXOS_LockRelease(&pService->lock);
+
+      if (nExpired > 0)
+      {
+         if (pService->nWorkers == 0)
+         {
+            IFXOS_TimerReadyRun(pService);
+         }
+         else
+         {
+            if (nExpired > pService->nWorkers)
+               nExpired = pService->nWorkers;
+
+            while (nExpired-- > 0)
+               IFXOS_EventWakeUp(&pService->workerEvent);
+         }
+
+         /* time has passed, re-calculate the wait time */
+         continue;
+      }
+
+      IFXOS_EventWait(&pService->dispatchEvent, wait_ms, IFX_NULL);
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Timer service - worker thread.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_TimerWorkerThread(
+               IFXOS_ThreadParams_t *pThrParams)
+{
+   IFXOS_TimerService_t *pService = (IFXOS_TimerService_t *)pThrParams->nArg1;
+
+   while ( (pThrParams->bShutDown == IFX_FALSE) &&
+           (pService->bShutDown == IFX_FALSE) )
+   {
+      IFXOS_EventWait(&pService->workerEvent, IFXOS_TIMER_IDLE_WAIT_MS, IFX_NULL);
+      IFXOS_TimerReadyRun(pService);
+   }
+
+   return IFX_SUCCESS;
+}
+
+/* ============================================================================
+   IFX OS adaptation - timer service, global functions
+   ========================================================================= */
+
+/**
+   Create a timer service and start the service threads.
+
+\param
+   pService    Points to the timer service object.
+\param
+   pName       Name of the service threads.
+\param
+   tick_ms     Tick resolution of the service [ms],
+               0 selects \ref IFXOS_TIMER_DEFAULT_TICK_MS.
+\param
+   nWorkers    Number of worker threads for the callbacks,
+               0: the callbacks are called by the dispatch thread.
+\param
+   nPriority   Priority of the service threads.
+
+\return
+   IFX_SUCCESS if the service has been started, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerServiceInit(
+               IFXOS_TimerService_t *pService,
+               const IFX_char_t     *pName,
+               IFX_uint32_t         tick_ms,
+               IFX_uint32_t         nWorkers,
+               IFX_uint32_t         nPriority)
+{
+   IFX_uint32_t   i;
+   IFX_int_t      level;
+
+   if (pService == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer Service init, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   if (pService->bValid == IFX_TRUE)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer Service <%s> init, already initialized" IFXOS_CRLF,
+           (pName) ? pName : "noname"));
+
+      return IFX_ERROR;
+   }
+
+   memset(pService, 0x00, sizeof(IFXOS_TimerService_t));
+
+   pService->tick_ms  = (tick_ms != 0) ? tick_ms : IFXOS_TIMER_DEFAULT_TICK_MS;
+   pService->nWorkers = nWorkers;
+
+   for (level = 0; level < IFXOS_TIMER_WHEEL_LEVELS; level++)
+   {
+      for (i = 0; i < IFXOS_TIMER_WHEEL_SLOTS; i++)
+      {
+         IFXOS_TimerListInit(&pService->wheel[level][i]);
+      }
+   }
+   IFXOS_TimerListInit(&pService->readyList);
+
+   if ( (IFXOS_LockInit(&pService->lock) != IFX_SUCCESS) ||
+        (IFXOS_EventInit(&pService->dispatchEvent) != IFX_SUCCESS) ||
+        (IFXOS_EventInit(&pService->workerEvent) != IFX_SUCCESS) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer Service <%s> init, lock / event init failed" IFXOS_CRLF,
+           (pName) ? pName : "noname"));
+
+      goto TIMER_SERVICE_INIT_ERROR;
+   }
+
+   if (nWorkers > 0)
+   {
+      pService->pWorkerThreads =
+         (IFXOS_ThreadCtrl_t *)IFXOS_MemAlloc(nWorkers * sizeof(IFXOS_ThreadCtrl_t));
+      if (pService->pWorkerThreads == IFX_NULL)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Timer Service <%s> init, no memory for %u workers" IFXOS_CRLF,
+              (pName) ? pName : "noname", nWorkers));
+
+         goto TIMER_SERVICE_INIT_ERROR;
+      }
+      memset(pService->pWorkerThreads, 0x00, nWorkers * sizeof(IFXOS_ThreadCtrl_t));
+   }
+
+   pService->lastTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+   pService->bValid      = IFX_TRUE;
+
+   if (IFXOS_ThreadInit(&pService->dispatchThread, pName,
+                        IFXOS_TimerDispatchThread,
+                        IFXOS_DEFAULT_STACK_SIZE, nPriority,
+                        (IFX_ulong_t)pService, 0) != IFX_SUCCESS)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer Service <%s> init, dispatch thread start failed" IFXOS_CRLF,
+           (pName) ? pName : "noname"));
+
+      IFXOS_TimerServiceDelete(pService);
+      return IFX_ERROR;
+   }
+
+   for (i = 0; i < nWorkers; i++)
+   {
+      if (IFXOS_ThreadInit(&pService->pWorkerThreads[i], pName,
+                           IFXOS_TimerWorkerThread,
+                           IFXOS_DEFAULT_STACK_SIZE, nPriority,
+                           (IFX_ulong_t)pService, 0) != IFX_SUCCESS)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Timer Service <%s> init, worker thread %u start failed" IFXOS_CRLF,
+              (pName) ? pName : "noname", i));
+
+         IFXOS_TimerServiceDelete(pService);
+         return IFX_ERROR;
+      }
+   }
+
+   return IFX_SUCCESS;
+
+TIMER_SERVICE_INIT_ERROR:
+
+   if (IFXOS_EVENT_INIT_VALID(&pService->workerEvent) == IFX_TRUE)
+      IFXOS_EventDelete(&pService->workerEvent);
+   if (IFXOS_EVENT_INIT_VALID(&pService->dispatchEvent) == IFX_TRUE)
+      IFXOS_EventDelete(&pService->dispatchEvent);
+   if (IFXOS_LOCK_INIT_VALID(&pService->lock) == IFX_TRUE)
+      IFXOS_LockDelete(&pService->lock);
+
+   return IFX_ERROR;
+}
+
+/**
+   Stop the service threads and delete the timer service.
+
+\param
+   pService    Points to the timer service object.
+
+\return
+   IFX_SUCCESS if the service has been deleted, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerServiceDelete(
+               IFXOS_TimerService_t *pService)
+{
+   IFX_int32_t    retVal = IFX_SUCCESS;
+   IFX_uint32_t   i;
+   IFX_int_t      level;
+
+   if ((pService == IFX_NULL) || (pService->bValid != IFX_TRUE))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer Service delete, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   /* stop the service threads */
+   pService->bShutDown = IFX_TRUE;
+   IFXOS_EventWakeUp(&pService->dispatchEvent);
+   for (i = 0; i < pService->nWorkers; i++)
+   {
+      IFXOS_EventWakeUp(&pService->workerEvent);
+   }
+
+   if (IFXOS_THREAD_INIT_VALID(&pService->dispatchThread) == IFX_TRUE)
+   {
+      if (IFXOS_ThreadDelete(&pService->dispatchThread,
+                             IFXOS_TIMER_THREAD_DELETE_WAIT_MS) != IFX_SUCCESS)
+         retVal = IFX_ERROR;
+   }
+
+   for (i = 0; (pService->pWorkerThreads != IFX_NULL) && (i < pService->nWorkers); i++)
+   {
+      if (IFXOS_THREAD_INIT_VALID(&pService->pWorkerThreads[i]) == IFX_TRUE)
+      {
+         if (IFXOS_ThreadDelete(&pService->pWorkerThreads[i],
+                                IFXOS_TIMER_THREAD_DELETE_WAIT_MS) != IFX_SUCCESS)
+            retVal = IFX_ERROR;
+      }
+   }
+
+   /* stop the remaining timers */
+   IFXOS_LockGet(&pService->lock);
+   for (level = 0; level < IFXOS_TIMER_WHEEL_LEVELS; level++)
+   {
+      for (i = 0; i < IFXOS_TIMER_WHEEL_SLOTS; i++)
+      {
+         while (pService->wheel[level][i].pNext != &pService->wheel[level][i])
+         {
+            IFXOS_TimerUnlink((IFXOS_Timer_t *)pService->wheel[level][i].pNext);
+         }
+      }
+   }
+   while (pService->readyList.pNext != &pService->readyList)
+   {
+      IFXOS_TimerUnlink((IFXOS_Timer_t *)pService->readyList.pNext);
+   }
+   pService->bValid = IFX_FALSE;
+   IFXOS_LockRelease(&pService->lock);
+
+   if (pService->pWorkerThreads != IFX_NULL)
+   {
+      IFXOS_MemFree(pService->pWorkerThreads);
+      pService->pWorkerThreads = IFX_NULL;
+   }
+
+   IFXOS_EventDelete(&pService->workerEvent);
+   IFXOS_EventDelete(&pService->dispatchEvent);
+   IFXOS_LockDelete(&pService->lock);
+
+   return retVal;
+}
+
+/**
+   Initialize a timer object.
+
+\param
+   pTimer      Points to the timer object.
+\param
+   pService    Points to the timer service which runs the timer.
+\param
+   pCallback   Callback which is called on expiry.
+\param
+   nArg        User argument for the callback.
+
+\return
+   IFX_SUCCESS if the timer has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerInit(
+               IFXOS_Timer_t           *pTimer,
+               IFXOS_TimerService_t    *pService,
+               IFXOS_TimerCallback_t   pCallback,
+               IFX_ulong_t             nArg)
+{
+   if ( (pTimer == IFX_NULL) || (pCallback == IFX_NULL) ||
+        (pService == IFX_NULL) || (pService->bValid != IFX_TRUE) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer init, invalid arguments" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   memset(pTimer, 0x00, sizeof(IFXOS_Timer_t));
+   IFXOS_TimerListInit(&pTimer->node);
+   pTimer->pService  = pService;
+   pTimer->pCallback = pCallback;
+   pTimer->nArg      = nArg;
+   pTimer->state     = IFXOS_TIMER_STATE_IDLE;
+   pTimer->bValid    = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Start (or restart) a timer.
+
+\param
+   pTimer      Points to the timer object.
+\param
+   timeout_ms  Time until the first expiry [ms].
+\param
+   period_ms   Period of the following expiries [ms],
+               0 for a one-shot timer.
+
+\return
+   IFX_SUCCESS if the timer has been started, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerStart(
+               IFXOS_Timer_t  *pTimer,
+               IFX_uint32_t   timeout_ms,
+               IFX_uint32_t   period_ms)
+{
+   IFXOS_TimerService_t *pService;
+   IFX_uint32_t         ticks;
+
+   if ((pTimer == IFX_NULL) || (pTimer->bValid != IFX_TRUE))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer start, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+   pService = pTimer->pService;
+
+   IFXOS_LockGet(&pService->lock);
+
+   if (pService->bValid != IFX_TRUE)
+   {
+      IFXOS_LockRelease(&pService->lock);
+      return IFX_ERROR;
+   }
+
+   IFXOS_TimerUnlink(pTimer);
+   (void)IFXOS_TimerRunCheck(pService, pTimer, IFX_TRUE);
+   IFXOS_TimerTimeUpdate(pService);
+
+   /* round up, count the already elapsed part of the current tick */
+   ticks = timeout_ms / pService->tick_ms;
+   ticks += ((timeout_ms % pService->tick_ms) + pService->partTick_ms +
+             pService->tick_ms - 1) / pService->tick_ms;
+
+   pTimer->expires = pService->nowTick + ticks;
+   pTimer->period  = period_ms / pService->tick_ms +
+                     (((period_ms % pService->tick_ms) != 0) ? 1 : 0);
+
+   IFXOS_TimerArm(pService, pTimer);
+
+   IFXOS_LockRelease(&pService->lock);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Stop a timer.
+
+\param
+   pTimer      Points to the timer object.
+
+\return
+   IFX_SUCCESS if the timer has been stopped, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerStop(
+               IFXOS_Timer_t  *pTimer)
+{
+   IFXOS_TimerService_t *pService;
+
+   if ((pTimer == IFX_NULL) || (pTimer->bValid != IFX_TRUE))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Timer stop, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+   pService = pTimer->pService;
+
+   IFXOS_LockGet(&pService->lock);
+   IFXOS_TimerUnlink(pTimer);
+   (void)IFXOS_TimerRunCheck(pService, pTimer, IFX_TRUE);
+   IFXOS_LockRelease(&pService->lock);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Check if a timer is pending or its callback is queued / running.
+
+\param
+   pTimer      Points to the timer object.
+
+\return
+   IFX_TRUE if the timer is active, else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_TimerIsActive(
+               IFXOS_Timer_t  *pTimer)
+{
+   IFXOS_TimerService_t *pService;
+   IFX_boolean_t        bActive;
+
+   if ((pTimer == IFX_NULL) || (pTimer->bValid != IFX_TRUE))
+      return IFX_FALSE;
+   pService = pTimer->pService;
+
+   IFXOS_LockGet(&pService->lock);
+   bActive = (pTimer->state != IFXOS_TIMER_STATE_IDLE) ? IFX_TRUE :
+               IFXOS_TimerRunCheck(pService, pTimer, IFX_FALSE);
+   IFXOS_LockRelease(&pService->lock);
+
+   return bActive;
+}
+
+#if defined(LINUX) && defined(__KERNEL__) && defined(MODULE)
+EXPORT_SYMBOL(IFXOS_TimerServiceInit);
+EXPORT_SYMBOL(IFXOS_TimerServiceDelete);
+EXPORT_SYMBOL(IFXOS_TimerInit);
+EXPORT_SYMBOL(IFXOS_TimerStart);
+EXPORT_SYMBOL(IFXOS_TimerStop);
+EXPORT_SYMBOL(IFXOS_TimerIsActive);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_TIMER) && (IFXOS_HAVE_TIMER == 1) ) */
+
@@ -11,6 +11,14 @@
 /** \file
    This file contains a OS independent device IO control layer -
    Device Input, Output, Control
+
+\par Tables
+   The driver, device and descriptor tables grow in chunks of
+   DEVIO_TABLE_CHUNK_SIZE entries. A chunk is never moved or freed, so an
+   entry stays at the same address (lock-free lookup). Free entries are kept
+   within a list (O(1) allocation and release).
+   A descriptor contains the table index and the generation of the entry,
+   the generation is incremented on close, so a stale descriptor is rejected.
 */
 #include <string.h>     /* strncmp */
 
@@ -23,23 +31,79 @@
 #include "ifxos_time.h"
 #include "ifxos_mutex.h"
 #include "ifxos_thread.h"
+#include "ifxos_event.h"
+#include "ifxos_memory_alloc.h"
+#include "ifxos_debug.h"
 
 /* ============================================================================
    Device IO - Local Defines and Types
    ========================================================================= */
 
+/** Device IO - table chunk, number of entries (shift) */
+#define DEVIO_TABLE_CHUNK_SHIFT           (6)
+/** Device IO - table chunk, number of entries */
+#define DEVIO_TABLE_CHUNK_SIZE            (1U << DEVIO_TABLE_CHUNK_SHIFT)
+/** Device IO - table, max number of chunks */
+#define DEVIO_TABLE_CHUNKS_MAX            (1U << (DEVIO_FD_INDEX_BITS - DEVIO_TABLE_CHUNK_SHIFT))
+
+/** Device IO - descriptor, table index */
+#define DEVIO_FD_INDEX_MASK               ((1U << DEVIO_FD_INDEX_BITS) - 1)
+/** Device IO - descriptor, generation (keeps the descriptor positive) */
+#define DEVIO_FD_GEN_MASK                 ((1U << (31 - DEVIO_FD_INDEX_BITS)) - 1)
+/** Device IO - descriptor, build from index and generation */
+#define DEVIO_FD_BUILD(idx, gen)          ((int)(((gen) << DEVIO_FD_INDEX_BITS) | (idx)))
+/** Device IO - descriptor, table index */
+#define DEVIO_FD_INDEX(fd)                ((unsigned int)(fd) & DEVIO_FD_INDEX_MASK)
+/** Device IO - descriptor, generation */
+#define DEVIO_FD_GEN(fd)                  ((unsigned int)(fd) >> DEVIO_FD_INDEX_BITS)
+
+/**
+   Device IO - table entry header, first element of each table entry
+*/
+typedef struct
+{
+   unsigned int   in_use;
+   /** next free entry (index + 1, 0: end) */
+   unsigned int   next_free;
+   /** generation, incremented on release */
+   unsigned int   generation;
+} DEVIO_entry_t;
+
+/**
+   Device IO - table with chunked storage
+*/
+typedef struct
+{
+   /** chunks, published once and never moved */
+   IFX_uint8_t    *chunk[DEVIO_TABLE_CHUNKS_MAX];
+   /** size of an entry [byte] */
+   unsigned int   entry_size;
+   /** number of allocated chunks */
+   unsigned int   num_chunks;
+   /** first free entry (index + 1, 0: none) */
+   unsigned int   free_head;
+} DEVIO_table_t;
+
 /**
    Device IO - device driver function table
 */
 typedef struct
 {
-   unsigned int         in_use;
+   DEVIO_entry_t        hdr;
    DEVIO_device_open    device_open;
    DEVIO_device_close   device_close;
    DEVIO_device_read    device_read;
    DEVIO_device_write   device_write;
    DEVIO_device_ioctl   device_ioctl;
    DEVIO_device_poll    device_poll;
+   /** optional batch functions */
+   DEVIO_device_readv         device_readv;
+   DEVIO_device_writev        device_writev;
+   DEVIO_device_ioctl_batch   device_ioctl_batch;
+   /** optional asynchronous operation function */
+   DEVIO_device_async         device_async;
+   /** driver signals the readiness via DEVIO_device_notify */
+   unsigned int         notify;
 } DEVIO_driver_t;
 
 
@@ -48,10 +112,15 @@ typedef struct
 */
 typedef struct
 {
-   unsigned int   in_use;
+   DEVIO_entry_t  hdr;
    unsigned int   driver_number;
    char           name[DEVIO_MAXDEVNAME];
    void           *device;
+   /** name index - length and hash of the name */
+   unsigned int   name_len;
+   IFX_uint32_t   name_hash;
+   /** name index - next device of the hash bucket (index + 1, 0: end) */
+   unsigned int   hash_next;
 } DEVIO_device_t;
 
 
@@ -60,144 +129,287 @@ typedef struct
 */
 typedef struct
 {
+   DEVIO_entry_t  hdr;
+   /** table index of the instance */
+   unsigned int   idx;
    int   device_number;
    void  *priv;
+   /** dispatch - driver functions, fixed while the instance is open */
+   DEVIO_device_read    device_read;
+   DEVIO_device_write   device_write;
+   DEVIO_device_ioctl   device_ioctl;
+   DEVIO_device_close   device_close;
+   DEVIO_device_readv         device_readv;
+   DEVIO_device_writev        device_writev;
+   DEVIO_device_ioctl_batch   device_ioctl_batch;
+   DEVIO_device_async         device_async;
+   /** dispatch - DEVIO_FD_OPEN flag and number of running calls */
+   unsigned int         ref;
 } DEVIO_fd_t;
 
 
+/**
+   Device IO - waiting DEVIO_select call
+*/
+typedef struct DEVIO_select_waiter_s
+{
+   struct DEVIO_select_waiter_s  *next;
+   /** wakeup of the waiting call */
+   IFXOS_event_t                 event;
+   /** descriptors of the call */
+   const DEVIO_fd_set_t          *read_fd_in;
+   unsigned int                  max_fd;
+} DEVIO_select_waiter_t;
+
+
+/**
+   Device IO - poll set entry
+*/
+typedef struct DEVIO_poll_entry_s
+{
+   /** next entry of the poll set (in use or free) */
+   struct DEVIO_poll_entry_s  *next;
+   /** next entry of the poll set index bucket */
+   struct DEVIO_poll_entry_s  *hash_next;
+   /** poll set of the entry */
+   DEVIO_poll_set_t           *set;
+   /** descriptor, -1: free entry */
+   int                        fd;
+   /** instance of the descriptor, key of the poll set index */
+   void                       *priv;
+   /** user data */
+   void                       *pUser;
+   /** signaled via DEVIO_device_notify() or ready at the last check */
+   unsigned int               ready;
+   /** driver without notification, checked by each wait */
+   unsigned int               polled;
+   /** check of the current wait (only used by the waiting thread) */
+   unsigned int               check;
+   int                        check_fd;
+   void                       *check_user;
+} DEVIO_poll_entry_t;
+
+/**
+   Device IO - poll set
+*/
+struct DEVIO_poll_set_s
+{
+   /** entries, added at the head (never freed up to the delete) */
+   DEVIO_poll_entry_t   *entries;
+   /** wakeup of DEVIO_poll_wait() */
+   IFXOS_event_t        event;
+   /** DEVIO_poll_wait() is waiting */
+   unsigned int         waiting;
+};
+
 /** Device IO - driver table */
-static DEVIO_driver_t DEVIO_driver_table[DEVIO_MAXDRIVERS];
+static DEVIO_table_t DEVIO_driver_table = { {IFX_NULL}, sizeof(DEVIO_driver_t), 0, 0 };
 /** Device IO - device table */
-static DEVIO_device_t DEVIO_device_table[DEVIO_MAXDEVICES];
+static DEVIO_table_t DEVIO_device_table = { {IFX_NULL}, sizeof(DEVIO_device_t), 0, 0 };
 /** Device IO - open instances of devices */
-static DEVIO_fd_t DEVIO_fd_table[DEVIO_MAXFDS];
+static DEVIO_table_t DEVIO_fd_table = { {IFX_NULL}, sizeof(DEVIO_fd_t), 0, 0 };
+/** Device IO - name index, first device of the bucket (index + 1, 0: empty) */
+static unsigned int DEVIO_devname_hash[DEVIO_DEVNAME_HASH_SIZE];
+/** Device IO - name index, number of devices per name length */
+static unsigned int DEVIO_devname_len_cnt[DEVIO_MAXDEVNAME];
+/** Device IO - waiting select calls */
+static DEVIO_select_waiter_t *DEVIO_select_waiters = IFX_NULL;
+/** Device IO - poll set index, entries by instance */
+static DEVIO_poll_entry_t *DEVIO_poll_hash[DEVIO_POLL_HASH_SIZE];
 /** Mutex to protect the tables */
 static IFXOS_mutex_t mutex;
 
 
+/** Device IO - descriptor reference, instance is open (published) */
+#define DEVIO_FD_OPEN                     0x80000000U
+
+#if (DEVIO_LOCKFREE_DISPATCH == 1)
+/** Device IO - descriptor reference, atomic read */
+#define DEVIO_FD_REF_LOAD(pFd)            __atomic_load_n(&(pFd)->ref, __ATOMIC_ACQUIRE)
+/** Device IO - descriptor reference, publish the filled entry (lock taken) */
+#define DEVIO_FD_PUBLISH(pFd)             __atomic_store_n(&(pFd)->ref, DEVIO_FD_OPEN, __ATOMIC_RELEASE)
+/** Device IO - descriptor reference, unpublish the entry and take a
+    reference for the close (lock taken) */
+#define DEVIO_FD_CLOSE(pFd)               (void)__atomic_fetch_add(&(pFd)->ref, 1 - DEVIO_FD_OPEN, __ATOMIC_ACQ_REL)
+/** Device IO - table, read a chunk pointer */
+#define DEVIO_TABLE_CHUNK_LOAD(pTable, c) __atomic_load_n(&(pTable)->chunk[c], __ATOMIC_ACQUIRE)
+/** Device IO - table, publish a new chunk (lock taken) */
+#define DEVIO_TABLE_CHUNK_STORE(pTable, c, p) \
+                                          __atomic_store_n(&(pTable)->chunk[c], (p), __ATOMIC_RELEASE)
+#else
+#define DEVIO_FD_REF_LOAD(pFd)            (*(volatile unsigned int *)&(pFd)->ref)
+#define DEVIO_FD_PUBLISH(pFd)             ((pFd)->ref = DEVIO_FD_OPEN)
+#define DEVIO_FD_CLOSE(pFd)               ((pFd)->ref += 1 - DEVIO_FD_OPEN)
+#define DEVIO_TABLE_CHUNK_LOAD(pTable, c) ((pTable)->chunk[c])
+#define DEVIO_TABLE_CHUNK_STORE(pTable, c, p) \
+                                          ((pTable)->chunk[c] = (p))
+#endif
+
+/** Device IO - name hash (FNV-1a), start value */
+#define DEVIO_DEVNAME_HASH_INIT           0x811C9DC5U
+/** Device IO - name hash (FNV-1a), add a character */
+#define DEVIO_DEVNAME_HASH_ADD(h, c)      (((h) ^ (IFX_uint8_t)(c)) * 0x01000193U)
+/** Device IO - name hash bucket */
+#define DEVIO_DEVNAME_HASH_BUCKET(h)      ((h) & (DEVIO_DEVNAME_HASH_SIZE - 1))
+
+/** Device IO - poll set index bucket */
+#define DEVIO_POLL_HASH_BUCKET(priv)      ((((IFX_uintptr_t)(priv)) >> 4) & (DEVIO_POLL_HASH_SIZE - 1))
+
+/** Device IO - driver table entry (IFX_NULL if not allocated) */
+#define DEVIO_DRIVER_GET(idx)             ((DEVIO_driver_t *)DEVIO_table_entry(&DEVIO_driver_table, (idx)))
+/** Device IO - device table entry (IFX_NULL if not allocated) */
+#define DEVIO_DEVICE_GET(idx)             ((DEVIO_device_t *)DEVIO_table_entry(&DEVIO_device_table, (idx)))
+
 /* ============================================================================
-   Device IO - Device and driver functions
+   Device IO - Local functions
    ========================================================================= */
 
 /**
-   Device IO - Install a new driver to the Device IO Layer.
+   Device IO - Get a table entry.
+
+\return
+   entry, IFX_NULL if the index is not allocated.
 */
-unsigned int DEVIO_driver_install (
-                        DEVIO_device_open   device_open,
-                        DEVIO_device_close  device_close,
-                        DEVIO_device_read   device_read,
-                        DEVIO_device_write  device_write,
-                        DEVIO_device_ioctl  device_ioctl,
-                        DEVIO_device_poll   device_poll )
+static void *DEVIO_table_entry (
+                        DEVIO_table_t  *pTable,
+                        unsigned int   idx )
 {
-   unsigned int i, nRet = ( unsigned int ) -1;
-   static unsigned int first;
-
-   IFXOS_ThreadLock();
+   IFX_uint8_t *pChunk;
 
-   if ( first == 0 )
+   if ( ( idx >> DEVIO_TABLE_CHUNK_SHIFT ) >= DEVIO_TABLE_CHUNKS_MAX )
    {
-      IFXOS_MutexInit(&mutex);
+      return IFX_NULL;
+   }
 
-      first = 1;
-      for ( i = 0; i < DEVIO_MAXFDS; i++ )
-      {
-         DEVIO_fd_table[i].device_number = -1;
-         memset ( &DEVIO_driver_table, 0x00, sizeof ( DEVIO_driver_table ) );
-      }
+   pChunk = DEVIO_TABLE_CHUNK_LOAD(pTable, idx >> DEVIO_TABLE_CHUNK_SHIFT);
+   if ( pChunk == IFX_NULL )
+   {
+      return IFX_NULL;
    }
 
-   IFXOS_ThreadUnlock();
+   return pChunk + ( idx & ( DEVIO_TABLE_CHUNK_SIZE - 1 ) ) * pTable->entry_size;
+}
 
-   IFXOS_MutexGet(&mutex);
+/**
+   Device IO - Allocate a table entry, the table grows by a chunk if no
+   free entry is available (lock taken).
+
+\return
+   entry (marked in use), IFX_NULL if the table is full.
+*/
+static void *DEVIO_table_alloc (
+                        DEVIO_table_t  *pTable,
+                        unsigned int   *pIdx )
+{
+   DEVIO_entry_t  *pEntry;
+   IFX_uint8_t    *pChunk;
+   unsigned int   i, base;
 
-   for ( i = 0; i < DEVIO_MAXDRIVERS; i++ )
+   if ( pTable->free_head == 0 )
    {
-      if ( DEVIO_driver_table[i].in_use == 0 )
+      if ( pTable->num_chunks >= DEVIO_TABLE_CHUNKS_MAX )
       {
-         DEVIO_driver_table[i].in_use = 1;
+         return IFX_NULL;
+      }
 
-         DEVIO_driver_table[i].device_open   = device_open;
-         DEVIO_driver_table[i].device_close  = device_close;
-         DEVIO_driver_table[i].device_read   = device_read;
-         DEVIO_driver_table[i].device_write  = device_write;
-         DEVIO_driver_table[i].device_ioctl  = device_ioctl;
-         DEVIO_driver_table[i].device_poll   = device_poll;
-         nRet = i;
-         break;
+      pChunk = (IFX_uint8_t *)IFXOS_MemAlloc(DEVIO_TABLE_CHUNK_SIZE * pTable->entry_size);
+      if ( pChunk == IFX_NULL )
+      {
+         return IFX_NULL;
+      }
+      memset(pChunk, 0x00, DEVIO_TABLE_CHUNK_SIZE * pTable->entry_size);
+
+      /* link the new entries in order into the free list */
+      base = pTable->num_chunks << DEVIO_TABLE_CHUNK_SHIFT;
+      for ( i = 0; i < DEVIO_TABLE_CHUNK_SIZE; i++ )
+      {
+         pEntry = (DEVIO_entry_t *)(pChunk + i * pTable->entry_size);
+         pEntry->next_free = ( i + 1 < DEVIO_TABLE_CHUNK_SIZE ) ? base + i + 2 : 0;
       }
+
+      DEVIO_TABLE_CHUNK_STORE(pTable, pTable->num_chunks, pChunk);
+      pTable->num_chunks++;
+      pTable->free_head = base + 1;
    }
 
-   IFXOS_MutexRelease(&mutex);
+   *pIdx  = pTable->free_head - 1;
+   pEntry = (DEVIO_entry_t *)DEVIO_table_entry(pTable, *pIdx);
+   pTable->free_head = pEntry->next_free;
+   pEntry->next_free = 0;
+   pEntry->in_use    = 1;
 
-   return ( nRet );
+   return pEntry;
 }
 
 /**
-   Device IO - Remove a driver from the Device IO Layer.
+   Device IO - Release a table entry, the generation is incremented
+   (lock taken).
 */
-void DEVIO_driver_remove(
-                        unsigned int   driver_num,
-                        int            force )
+static void DEVIO_table_free (
+                        DEVIO_table_t  *pTable,
+                        unsigned int   idx )
 {
-   IFXOS_MutexGet(&mutex);
+   DEVIO_entry_t *pEntry = (DEVIO_entry_t *)DEVIO_table_entry(pTable, idx);
 
-   if ( ( driver_num < DEVIO_MAXDRIVERS ) && ( DEVIO_driver_table[driver_num].in_use ) )
-   {
-      DEVIO_driver_table[driver_num].in_use = 0;
+   pEntry->in_use     = 0;
+   pEntry->generation = ( pEntry->generation + 1 ) & DEVIO_FD_GEN_MASK;
+   pEntry->next_free  = pTable->free_head;
+   pTable->free_head  = idx + 1;
+}
 
-      DEVIO_driver_table[driver_num].device_open  = 0;
-      DEVIO_driver_table[driver_num].device_close = 0;
-      DEVIO_driver_table[driver_num].device_read  = 0;
-      DEVIO_driver_table[driver_num].device_write = 0;
-      DEVIO_driver_table[driver_num].device_ioctl = 0;
-      DEVIO_driver_table[driver_num].device_poll  = 0;
-   }
+/**
+   Device IO - Number of allocated table entries.
+*/
+static unsigned int DEVIO_table_size ( DEVIO_table_t *pTable )
+{
+   return pTable->num_chunks << DEVIO_TABLE_CHUNK_SHIFT;
+}
 
-   IFXOS_MutexRelease(&mutex);
+/**
+   Device IO - Get an installed driver (lock taken).
+
+\return
+   driver, IFX_NULL if the driver is not installed.
+*/
+static DEVIO_driver_t *DEVIO_driver_get ( unsigned int driver_num )
+{
+   DEVIO_driver_t *pDriver = DEVIO_DRIVER_GET(driver_num);
+
+   return ( ( pDriver != IFX_NULL ) && ( pDriver->hdr.in_use ) ) ? pDriver : IFX_NULL;
 }
 
 /**
-   Device IO - Add a device to the device IO layer.
+   Device IO - Free a closed instance, called by the release of the last
+   reference (lock not taken). The driver close function is called before
+   the descriptor is released for reuse.
+
+\return
+   result of the driver close function, 0 for a detached instance.
 */
-unsigned int DEVIO_device_add(
-                        void           *device,
-                        const char     *name,
-                        unsigned int   driver_number )
+static int DEVIO_fd_free ( DEVIO_fd_t *pFd )
 {
-   unsigned int i, k, nRet = ( unsigned int ) -1;
+   int nRet = 0;
 
-   if ( ( name == 0 ) || ( device == 0 ) || ( driver_number >= DEVIO_MAXDRIVERS ) )
+   /* last reference - no call and no forced remove uses the instance */
+   if ( pFd->device_close )
    {
-      return ( nRet );
+      nRet = pFd->device_close ( pFd->priv );
    }
 
    IFXOS_MutexGet(&mutex);
 
-   /* assign next free entry in device table to this device */
-   for ( i = 0; i < DEVIO_MAXDEVICES; i++ )
-   {
-      if ( DEVIO_device_table[i].in_use == 0 )
-      {
-         DEVIO_device_table[i].in_use = 1;
-         DEVIO_device_table[i].device = device;
-         DEVIO_device_table[i].driver_number = driver_number;
-
-         for ( k = 0; k < DEVIO_MAXDEVNAME; k++ )
-         {
-            DEVIO_device_table[i].name[k] = name[k];
-            if ( name[k] == 0 )
-               break;
-         }
-         if ( k == DEVIO_MAXDEVNAME )
-         {
-            DEVIO_device_table[i].name[k - 1] = 0;
-         }
-
-         nRet = 0;
-         break;
-      }
-   }
+   /* clear entry in file descriptor list */
+   pFd->device_read   = NULL;
+   pFd->device_write  = NULL;
+   pFd->device_ioctl  = NULL;
+   pFd->device_close  = NULL;
+   pFd->device_readv  = NULL;
+   pFd->device_writev = NULL;
+   pFd->device_ioctl_batch = NULL;
+   pFd->device_async  = NULL;
+   pFd->priv          = NULL;
+   pFd->device_number = ( -1 );
+   DEVIO_table_free(&DEVIO_fd_table, pFd->idx);
 
    IFXOS_MutexRelease(&mutex);
 
@@ -205,365 +417,1783 @@ unsigned int DEVIO_device_add(
 }
 
 /**
-   Device IO - Delete a device from the device IO layer.
+   Device IO - Release an open instance after a call.
+
+\remark
+   The release of the last reference of a closed instance frees it.
+
+\return
+   result of the driver close function for the last reference, else 0.
 */
-void DEVIO_device_delete(
-                        void *device )
+static int DEVIO_fd_put ( DEVIO_fd_t *pFd )
 {
-   unsigned int i;
+   unsigned int ref;
 
+#if (DEVIO_LOCKFREE_DISPATCH == 1)
+   ref = __atomic_sub_fetch(&pFd->ref, 1, __ATOMIC_ACQ_REL);
+#else
    IFXOS_MutexGet(&mutex);
+   ref = --pFd->ref;
+   IFXOS_MutexRelease(&mutex);
+#endif
 
-   for ( i = 0; i < DEVIO_MAXDEVICES; i++ )
+   if ( ref == 0 )
    {
-      if ( DEVIO_device_table[i].device != device )
-         continue;
-
-      DEVIO_device_table[i].in_use  = 0;
-      DEVIO_device_table[i].device = IFX_NULL;
-      memset(&DEVIO_device_table[i].name[0], 0, DEVIO_MAXDEVNAME);
-      DEVIO_device_table[i].driver_number = 0;
-      break;
+      return DEVIO_fd_free(pFd);
    }
 
-   IFXOS_MutexRelease(&mutex);
+   return 0;
 }
 
-
 /**
-   Device IO - Open a device.
+   Device IO - Hold an open instance without running calls for a forced
+   driver remove (lock taken). No further call is dispatched up to the
+   DEVIO_FD_PUBLISH of the instance.
+
+\return
+   1 if the instance is held, 0 if a call is running or the instance is
+   closing.
 */
-int DEVIO_open ( const char *name )
+static int DEVIO_fd_hold ( DEVIO_fd_t *pFd )
 {
-   int i, nRet = -1, len, lenDevTableEntry;
-   int foundDeviceTableEntry = -1, maxMatchingLen = 0;
-   void *priv;
-   DEVIO_device_t    *pDevice;
-   DEVIO_device_open foo = NULL;
+#if (DEVIO_LOCKFREE_DISPATCH == 1)
+   unsigned int ref = DEVIO_FD_OPEN;
 
-   if ( name == NULL || name[0] == '0' )
+   return __atomic_compare_exchange_n(&pFd->ref, &ref, 0, 0,
+                                      __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) ? 1 : 0;
+#else
+   if ( pFd->ref != DEVIO_FD_OPEN )
    {
-      return -1;
+      return 0;
    }
 
-   len = (int)strlen ( name );
-   IFXOS_MutexGet(&mutex);
+   pFd->ref = 0;
 
-   for ( i = 0; i < DEVIO_MAXDEVICES; i++ )
-   {
-      pDevice = &DEVIO_device_table[i];
-      lenDevTableEntry = (int)strlen ( pDevice->name );
+   return 1;
+#endif
+}
 
+/**
+   Device IO - Get an open instance for a call, the instance stays valid
+   up to DEVIO_fd_put().
 
-      if (len != lenDevTableEntry)
-      {
-         continue;
-      }
+\return
+   instance, NULL if the descriptor is not open.
+*/
+static DEVIO_fd_t *DEVIO_fd_get ( const int fd )
+{
+   DEVIO_fd_t     *pFd;
+   unsigned int   ref;
 
-      if ( strncmp ( name, pDevice->name, lenDevTableEntry ) != 0 )
-      {
-         continue;
-      }
+   if ( fd < 0 )
+   {
+      return NULL;
+   }
 
-      if (len == lenDevTableEntry)
-      {
-         /* exact match -> found */
-         if (DEVIO_driver_table[pDevice->driver_number].device_open)
-         {
-            foundDeviceTableEntry = i;
-            maxMatchingLen        = lenDevTableEntry;
-            break;
-         }
-      }
-      else
+   pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, DEVIO_FD_INDEX(fd));
+   if ( pFd == NULL )
+   {
+      return NULL;
+   }
+
+#if (DEVIO_LOCKFREE_DISPATCH == 1)
+   ref = __atomic_load_n(&pFd->ref, __ATOMIC_ACQUIRE);
+   do
+   {
+      if ( ( ref & DEVIO_FD_OPEN ) == 0 )
       {
-         /* check for best match */
-         if ( (lenDevTableEntry > maxMatchingLen) &&
-              (DEVIO_driver_table[pDevice->driver_number].device_open) )
-         {
-            foundDeviceTableEntry = i;
-            maxMatchingLen        = lenDevTableEntry;
-         }
+         return NULL;
       }
+   } while ( !__atomic_compare_exchange_n(&pFd->ref, &ref, ref + 1, 1,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) );
+#else
+   IFXOS_MutexGet(&mutex);
+   ref = pFd->ref;
+   if ( ref & DEVIO_FD_OPEN )
+   {
+      pFd->ref = ref + 1;
    }
+   IFXOS_MutexRelease(&mutex);
 
-   if (foundDeviceTableEntry != -1)
+   if ( ( ref & DEVIO_FD_OPEN ) == 0 )
    {
-      /* driver entry found */
-      pDevice = &DEVIO_device_table[foundDeviceTableEntry];
-      foo     = DEVIO_driver_table[pDevice->driver_number].device_open;
-
-      IFXOS_MutexRelease(&mutex);
+      return NULL;
+   }
+#endif
 
-      /* call open function of device driver - best base dev name + appendix */
-      priv = ( void * ) foo(pDevice->device, name + maxMatchingLen);
+   /* stale descriptor - the entry has been reused */
+   if ( pFd->hdr.generation != DEVIO_FD_GEN(fd) )
+   {
+      DEVIO_fd_put(pFd);
+      return NULL;
+   }
 
-      IFXOS_MutexGet(&mutex);
+   return pFd;
+}
 
-      /* check if valid ptr */
-      if (( ( IFX_intptr_t ) priv != -1 ) && ( ( IFX_intptr_t ) priv != 0 ))
-      {
-         for ( i = 0; i < DEVIO_MAXFDS; i++ )
-         {
-            /* assign next free filedescriptor to device */
-            if ( DEVIO_fd_table[i].device_number == -1 )
-            {
-               DEVIO_fd_table[i].device_number = foundDeviceTableEntry;
-               DEVIO_fd_table[i].priv          = priv;
-               nRet = i;
-               break;
-            }
-         }
-      }
-   }
+/**
+   Device IO - Get the driver of an open instance (reference taken).
 
-   IFXOS_MutexRelease(&mutex);
+\return
+   driver, IFX_NULL if not available.
+*/
+static DEVIO_driver_t *DEVIO_fd_driver ( DEVIO_fd_t *pFd )
+{
+   DEVIO_device_t *pDevice = DEVIO_DEVICE_GET((unsigned int)pFd->device_number);
 
-   return ( nRet );
+   return ( pDevice != IFX_NULL ) ? DEVIO_DRIVER_GET(pDevice->driver_number) : IFX_NULL;
 }
 
 /**
-   Device IO - Close a device.
+   Device IO - Find a device by the first name_len characters of the
+   given name (lock taken).
+
+\return
+   index of the device, -1 if not found.
 */
-int DEVIO_close ( const int fd )
+static int DEVIO_devname_find(
+                        const char     *name,
+                        unsigned int   name_len,
+                        IFX_uint32_t   name_hash )
 {
-   int nRet = -1;
-   unsigned int dev_no, drv_no;
-   void *priv = NULL;
-   DEVIO_device_close foo = NULL;
+   unsigned int   idx;
+   DEVIO_device_t *pDevice;
+   DEVIO_driver_t *pDriver;
 
-   if ( fd < DEVIO_MAXFDS )
+   for ( idx = DEVIO_devname_hash[DEVIO_DEVNAME_HASH_BUCKET(name_hash)];
+         idx != 0; idx = pDevice->hash_next )
    {
-      if ( fd >= 0 )
+      pDevice = DEVIO_DEVICE_GET(idx - 1);
+      if ( ( pDevice->name_hash == name_hash ) &&
+           ( pDevice->name_len  == name_len ) &&
+           ( strncmp ( name, pDevice->name, name_len ) == 0 ) )
       {
-         IFXOS_MutexGet(&mutex);
-
-         dev_no = DEVIO_fd_table[fd].device_number;
-         priv = DEVIO_fd_table[fd].priv;
-         if ( (dev_no < DEVIO_MAXDEVICES)
-              && ( ( drv_no = DEVIO_device_table[dev_no].driver_number ) < DEVIO_MAXDRIVERS ) )
+         pDriver = DEVIO_driver_get(pDevice->driver_number);
+         if ( ( pDriver != IFX_NULL ) && ( pDriver->device_open ) )
          {
-            /* clear entry in file descriptor list */
-            DEVIO_fd_table[fd].device_number = ( -1 );
-            DEVIO_fd_table[fd].priv = NULL;
-
-            foo = DEVIO_driver_table[drv_no].device_close ;
+            return (int)(idx - 1);
          }
-
-         IFXOS_MutexRelease(&mutex);
       }
-
-      if(foo)
-         nRet = foo ( priv );
    }
 
-   return ( nRet );
+   return -1;
 }
 
+/* ============================================================================
+   Device IO - Device and driver functions
+   ========================================================================= */
+
 /**
-   Device IO - Write to a device.
+   Device IO - Install a new driver to the Device IO Layer.
 */
-int DEVIO_write ( const int fd, const void *pData, const unsigned int nSize )
+unsigned int DEVIO_driver_install (
+                        DEVIO_device_open   device_open,
+                        DEVIO_device_close  device_close,
+                        DEVIO_device_read   device_read,
+                        DEVIO_device_write  device_write,
+                        DEVIO_device_ioctl  device_ioctl,
+                        DEVIO_device_poll   device_poll )
 {
-   unsigned int dev_no, drv_no;
-   int nRet = -1;
-   void *priv = NULL;
-   DEVIO_device_write foo=NULL;
+   unsigned int i, nRet = ( unsigned int ) -1;
+   static unsigned int first;
+   DEVIO_driver_t *pDriver;
+
+   IFXOS_ThreadLock();
 
-   if ( fd < DEVIO_MAXFDS )
+   if ( first == 0 )
    {
-      if ( fd >= 0 )
-      {
-         IFXOS_MutexGet(&mutex);
+      IFXOS_MutexInit(&mutex);
 
-         dev_no = DEVIO_fd_table[fd].device_number;
-         priv = DEVIO_fd_table[fd].priv;
-         if ( (dev_no < DEVIO_MAXDEVICES)
-              && ( ( drv_no = DEVIO_device_table[dev_no].driver_number ) < DEVIO_MAXDRIVERS ) )
-         {
-            foo = DEVIO_driver_table[drv_no].device_write;
-         }
+      first = 1;
+   }
 
-         IFXOS_MutexRelease(&mutex);
-      }
+   IFXOS_ThreadUnlock();
+
+   IFXOS_MutexGet(&mutex);
 
-      if(foo)
-          nRet =  foo( priv, (const char *)pData, nSize );
+   pDriver = (DEVIO_driver_t *)DEVIO_table_alloc(&DEVIO_driver_table, &i);
+   if ( pDriver != IFX_NULL )
+   {
+      pDriver->device_open   = device_open;
+      pDriver->device_close  = device_close;
+      pDriver->device_read   = device_read;
+      pDriver->device_write  = device_write;
+      pDriver->device_ioctl  = device_ioctl;
+      pDriver->device_poll   = device_poll;
+      pDriver->device_readv  = NULL;
+      pDriver->device_writev = NULL;
+      pDriver->device_ioctl_batch = NULL;
+      pDriver->device_async  = NULL;
+      pDriver->notify        = 0;
+      nRet = i;
    }
 
+   IFXOS_MutexRelease(&mutex);
+
    return ( nRet );
 }
 
 /**
-   Device IO - Read from a device.
+   Device IO - Check if an instance is attached to a driver (lock taken).
 */
-int DEVIO_read ( const int fd, void *pData, const unsigned int nSize )
+static int DEVIO_fd_of_driver (
+                        DEVIO_fd_t     *pFd,
+                        unsigned int   driver_num )
 {
-   unsigned int dev_no, drv_no;
-   int nRet = -1;
-   void *priv = NULL;
-   DEVIO_device_read foo=NULL;
-
-   if ( fd < DEVIO_MAXFDS )
-   {
-      if ( fd >= 0 )
-      {
-         IFXOS_MutexGet(&mutex);
-
-         dev_no = DEVIO_fd_table[fd].device_number;
-         priv = DEVIO_fd_table[fd].priv;
-         if ( (dev_no < DEVIO_MAXDEVICES)
-              && ( ( drv_no = DEVIO_device_table[dev_no].driver_number ) < DEVIO_MAXDRIVERS ) )
-         {
-            foo = DEVIO_driver_table[drv_no].device_read;
-         }
+   DEVIO_device_t *pDevice;
 
-         IFXOS_MutexRelease(&mutex);
-      }
+   if ( ( pFd->hdr.in_use == 0 ) || ( pFd->device_number < 0 ) )
+      return 0;
 
-      if(foo)
-         nRet = foo ( priv, (char *)pData, nSize );
-   }
+   pDevice = DEVIO_DEVICE_GET((unsigned int)pFd->device_number);
+   if ( ( pDevice == IFX_NULL ) || ( pDevice->hdr.in_use == 0 ) ||
+        ( pDevice->driver_number != driver_num ) )
+      return 0;
 
-   return ( nRet );
+   return 1;
 }
 
 /**
-   Device IO - ioctl command.
+   Device IO - Remove a driver from the Device IO Layer.
+
+\remark
+   The open instances of a driver call the driver functions without a
+   table lookup, so the driver is not removed as long as an instance is
+   open (or closing). A forced remove detaches the open instances, further
+   calls of them fail and their close does not call the driver. The forced
+   remove is refused as long as a call of an instance is running or an
+   instance is closing, the functions are never detached while in use.
+
+\return
+   0 if the driver is removed, -1 if the remove is refused.
+*/
+int DEVIO_driver_remove(
+                        unsigned int   driver_num,
+                        int            force )
+{
+   unsigned int   i, j, nUsed = 0, nBusy = 0;
+   DEVIO_driver_t *pDriver;
+   DEVIO_fd_t     *pFd;
+
+   IFXOS_MutexGet(&mutex);
+
+   pDriver = DEVIO_driver_get(driver_num);
+   if ( pDriver == IFX_NULL )
+   {
+      IFXOS_MutexRelease(&mutex);
+      return ( -1 );
+   }
+
+   for ( i = 0; i < DEVIO_table_size(&DEVIO_fd_table); i++ )
+   {
+      pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, i);
+      if ( DEVIO_fd_of_driver(pFd, driver_num) == 0 )
+         continue;
+
+      nUsed++;
+      /* forced - hold the instance, no call is dispatched meanwhile */
+      if ( ( force != 0 ) && ( DEVIO_fd_hold(pFd) == 0 ) )
+      {
+         nBusy++;
+         break;
+      }
+   }
+
+   if ( ( nUsed != 0 ) && ( ( force == 0 ) || ( nBusy != 0 ) ) )
+   {
+      /* refused - publish the instances held so far again */
+      for ( j = 0; ( force != 0 ) && ( j < i ); j++ )
+      {
+         pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, j);
+         if ( DEVIO_fd_of_driver(pFd, driver_num) )
+            DEVIO_FD_PUBLISH(pFd);
+      }
+
+      IFXOS_MutexRelease(&mutex);
+
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO driver %u remove, %s" IFXOS_CRLF,
+           driver_num, ( nBusy != 0 ) ? "instance in use" : "instances open"));
+
+      return ( -1 );
+   }
+
+   /* forced - detach the held instances and publish them again */
+   for ( i = 0; ( nUsed != 0 ) && ( i < DEVIO_table_size(&DEVIO_fd_table) ); i++ )
+   {
+      pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, i);
+      if ( DEVIO_fd_of_driver(pFd, driver_num) == 0 )
+         continue;
+
+      pFd->device_read   = NULL;
+      pFd->device_write  = NULL;
+      pFd->device_ioctl  = NULL;
+      pFd->device_close  = NULL;
+      pFd->device_readv  = NULL;
+      pFd->device_writev = NULL;
+      pFd->device_ioctl_batch = NULL;
+      pFd->device_async  = NULL;
+      pFd->device_number = ( -1 );
+      DEVIO_FD_PUBLISH(pFd);
+   }
+
+   pDriver->device_open  = 0;
+   pDriver->device_close = 0;
+   pDriver->device_read  = 0;
+   pDriver->device_write = 0;
+   pDriver->device_ioctl = 0;
+   pDriver->device_poll  = 0;
+   pDriver->device_readv  = 0;
+   pDriver->device_writev = 0;
+   pDriver->device_ioctl_batch = 0;
+   pDriver->device_async  = 0;
+   pDriver->notify       = 0;
+
+   DEVIO_table_free(&DEVIO_driver_table, driver_num);
+
+   IFXOS_MutexRelease(&mutex);
+
+   return ( 0 );
+}
+
+/**
+   Device IO - Enable the readiness notification of a driver.
+*/
+void DEVIO_driver_notify_enable(
+                        unsigned int   driver_num )
+{
+   DEVIO_driver_t *pDriver;
+
+   IFXOS_MutexGet(&mutex);
+
+   pDriver = DEVIO_driver_get(driver_num);
+   if ( pDriver != IFX_NULL )
+   {
+      pDriver->notify = 1;
+   }
+
+   IFXOS_MutexRelease(&mutex);
+}
+
+/**
+   Device IO - Set the optional batch functions of a driver.
+*/
+void DEVIO_driver_batch_set(
+                        unsigned int               driver_num,
+                        DEVIO_device_readv         device_readv,
+                        DEVIO_device_writev        device_writev,
+                        DEVIO_device_ioctl_batch   device_ioctl_batch )
+{
+   DEVIO_driver_t *pDriver;
+
+   IFXOS_MutexGet(&mutex);
+
+   pDriver = DEVIO_driver_get(driver_num);
+   if ( pDriver != IFX_NULL )
+   {
+      pDriver->device_readv       = device_readv;
+      pDriver->device_writev      = device_writev;
+      pDriver->device_ioctl_batch = device_ioctl_batch;
+   }
+
+   IFXOS_MutexRelease(&mutex);
+}
+
+/**
+   Device IO - Set the optional asynchronous operation function of a driver.
+*/
+void DEVIO_driver_async_set(
+                        unsigned int               driver_num,
+                        DEVIO_device_async         device_async )
+{
+   DEVIO_driver_t *pDriver;
+
+   IFXOS_MutexGet(&mutex);
+
+   pDriver = DEVIO_driver_get(driver_num);
+   if ( pDriver != IFX_NULL )
+   {
+      pDriver->device_async = device_async;
+   }
+
+   IFXOS_MutexRelease(&mutex);
+}
+
+/**
+   Device IO - Add a device to the device IO layer.
+*/
+unsigned int DEVIO_device_add(
+                        void           *device,
+                        const char     *name,
+                        unsigned int   driver_number )
+{
+   unsigned int i, k, nRet = ( unsigned int ) -1;
+   DEVIO_device_t *pDevice;
+
+   if ( ( name == 0 ) || ( device == 0 ) )
+   {
+      return ( nRet );
+   }
+
+   IFXOS_MutexGet(&mutex);
+
+   if ( DEVIO_driver_get(driver_number) == IFX_NULL )
+   {
+      IFXOS_MutexRelease(&mutex);
+      return ( nRet );
+   }
+
+   /* assign next free entry in device table to this device */
+   pDevice = (DEVIO_device_t *)DEVIO_table_alloc(&DEVIO_device_table, &i);
+   if ( pDevice != IFX_NULL )
+   {
+      pDevice->device = device;
+      pDevice->driver_number = driver_number;
+
+      for ( k = 0; k < DEVIO_MAXDEVNAME; k++ )
+      {
+         pDevice->name[k] = name[k];
+         if ( name[k] == 0 )
+            break;
+      }
+      if ( k == DEVIO_MAXDEVNAME )
+      {
+         pDevice->name[k - 1] = 0;
+      }
+
+      /* add to the name index */
+      pDevice->name_hash = DEVIO_DEVNAME_HASH_INIT;
+      for ( k = 0; pDevice->name[k] != 0; k++ )
+      {
+         pDevice->name_hash = DEVIO_DEVNAME_HASH_ADD(pDevice->name_hash, pDevice->name[k]);
+      }
+      pDevice->name_len  = k;
+      pDevice->hash_next = DEVIO_devname_hash[DEVIO_DEVNAME_HASH_BUCKET(pDevice->name_hash)];
+      DEVIO_devname_hash[DEVIO_DEVNAME_HASH_BUCKET(pDevice->name_hash)] = i + 1;
+      DEVIO_devname_len_cnt[k]++;
+
+      nRet = 0;
+   }
+
+   IFXOS_MutexRelease(&mutex);
+
+   return ( nRet );
+}
+
+/**
+   Device IO - Delete a device from the device IO layer.
+*/
+void DEVIO_device_delete(
+                        void *device )
+{
+   unsigned int i, *p_idx;
+   DEVIO_device_t *pDevice;
+
+   IFXOS_MutexGet(&mutex);
+
+   for ( i = 0; i < DEVIO_table_size(&DEVIO_device_table); i++ )
+   {
+      pDevice = DEVIO_DEVICE_GET(i);
+      if ( ( pDevice->hdr.in_use == 0 ) || ( pDevice->device != device ) )
+         continue;
+
+      /* remove from the name index */
+      for ( p_idx = &DEVIO_devname_hash[DEVIO_DEVNAME_HASH_BUCKET(pDevice->name_hash)];
+            *p_idx != 0; p_idx = &DEVIO_DEVICE_GET(*p_idx - 1)->hash_next )
+      {
+         if ( *p_idx == i + 1 )
+         {
+            *p_idx = pDevice->hash_next;
+            DEVIO_devname_len_cnt[pDevice->name_len]--;
+            break;
+         }
+      }
+      pDevice->hash_next = 0;
+
+      pDevice->device = IFX_NULL;
+      memset(&pDevice->name[0], 0, DEVIO_MAXDEVNAME);
+      pDevice->driver_number = 0;
+
+      DEVIO_table_free(&DEVIO_device_table, i);
+      break;
+   }
+
+   IFXOS_MutexRelease(&mutex);
+}
+
+
+/**
+   Device IO - Open a device.
+
+\remark
+   The device is searched via the name index: the hashes of all prefixes of
+   the given name are calculated within one pass, then the prefixes are
+   checked from the longest to the shortest one (only lengths of registered
+   names). The longest match is the base name, the rest is the appendix
+   which is passed to device_open.
+*/
+int DEVIO_open ( const char *name )
+{
+   int nRet = -1;
+   int foundDeviceTableEntry = -1, maxMatchingLen = 0;
+   unsigned int i, k, len;
+   IFX_uint32_t prefix_hash[DEVIO_MAXDEVNAME];
+   void *priv;
+   DEVIO_device_t    *pDevice;
+   DEVIO_driver_t    *pDriver;
+   DEVIO_fd_t        *pFd;
+   DEVIO_device_open foo = NULL;
+
+   if ( name == NULL || name[0] == '0' )
+   {
+      return -1;
+   }
+
+   /* hash of each prefix, registered names are shorter than DEVIO_MAXDEVNAME */
+   prefix_hash[0] = DEVIO_DEVNAME_HASH_INIT;
+   for ( len = 0; (len < DEVIO_MAXDEVNAME - 1) && (name[len] != 0); len++ )
+   {
+      prefix_hash[len + 1] = DEVIO_DEVNAME_HASH_ADD(prefix_hash[len], name[len]);
+   }
+
+   IFXOS_MutexGet(&mutex);
+
+   for ( k = len; k > 0; k-- )
+   {
+      if ( DEVIO_devname_len_cnt[k] == 0 )
+      {
+         continue;
+      }
+
+      foundDeviceTableEntry = DEVIO_devname_find(name, k, prefix_hash[k]);
+      if (foundDeviceTableEntry != -1)
+      {
+         maxMatchingLen = (int)k;
+         break;
+      }
+   }
+
+   if (foundDeviceTableEntry != -1)
+   {
+      /* driver entry found */
+      pDevice = DEVIO_DEVICE_GET(foundDeviceTableEntry);
+      pDriver = DEVIO_driver_get(pDevice->driver_number);
+      foo     = pDriver->device_open;
+
+      IFXOS_MutexRelease(&mutex);
+
+      /* call open function of device driver - best base dev name + appendix */
+      priv = ( void * ) foo(pDevice->device, name + maxMatchingLen);
+
+      IFXOS_MutexGet(&mutex);
+
+      /* check if valid ptr */
+      pDriver = DEVIO_driver_get(pDevice->driver_number);
+      if (( ( IFX_intptr_t ) priv != -1 ) && ( ( IFX_intptr_t ) priv != 0 ) && ( pDriver != IFX_NULL ))
+      {
+         /* assign next free filedescriptor to device */
+         pFd = (DEVIO_fd_t *)DEVIO_table_alloc(&DEVIO_fd_table, &i);
+         if ( pFd != IFX_NULL )
+         {
+            pFd->idx           = i;
+            pFd->device_number = foundDeviceTableEntry;
+            pFd->priv          = priv;
+            pFd->device_read   = pDriver->device_read;
+            pFd->device_write  = pDriver->device_write;
+            pFd->device_ioctl  = pDriver->device_ioctl;
+            pFd->device_close  = pDriver->device_close;
+            pFd->device_readv  = pDriver->device_readv;
+            pFd->device_writev = pDriver->device_writev;
+            pFd->device_ioctl_batch = pDriver->device_ioctl_batch;
+            pFd->device_async  = pDriver->device_async;
+            DEVIO_FD_PUBLISH(pFd);
+            nRet = DEVIO_FD_BUILD(i, pFd->hdr.generation);
+         }
+         else if ( pDriver->device_close )
+         {
+            /* no descriptor available - undo the open */
+            IFXOS_MutexRelease(&mutex);
+            (void)pDriver->device_close(priv);
+            IFXOS_MutexGet(&mutex);
+         }
+      }
+   }
+
+   IFXOS_MutexRelease(&mutex);
+
+   return ( nRet );
+}
+
+/**
+   Device IO - Close a device.
+
+\remark
+   The instance is unpublished first, so no new call is dispatched. The
+   driver close function is called by the release of the last reference,
+   after the return of the last running call (by this call if no other call
+   is running). The descriptor is then released for reuse with the next
+   generation.
+
+\return
+   result of the driver close function, 0 if it is deferred to a running
+   call, -1 if the descriptor is not open.
+*/
+int DEVIO_close ( const int fd )
+{
+   DEVIO_fd_t *pFd;
+
+   if ( fd < 0 )
+   {
+      return ( -1 );
+   }
+
+   IFXOS_MutexGet(&mutex);
+
+   pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, DEVIO_FD_INDEX(fd));
+   if ( ( pFd == NULL ) || ( pFd->hdr.in_use == 0 ) ||
+        ( pFd->hdr.generation != DEVIO_FD_GEN(fd) ) ||
+        ( ( DEVIO_FD_REF_LOAD(pFd) & DEVIO_FD_OPEN ) == 0 ) )
+   {
+      IFXOS_MutexRelease(&mutex);
+      return ( -1 );
+   }
+   /* unpublish - the close takes a reference, released below */
+   DEVIO_FD_CLOSE(pFd);
+
+   IFXOS_MutexRelease(&mutex);
+
+   return DEVIO_fd_put(pFd);
+}
+
+/**
+   Device IO - Write to a device.
+*/
+int DEVIO_write ( const int fd, const void *pData, const unsigned int nSize )
+{
+   int nRet = -1;
+   DEVIO_fd_t *pFd;
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_write )
+         nRet = pFd->device_write ( pFd->priv, (const char *)pData, nSize );
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+/**
+   Device IO - Read from a device.
+*/
+int DEVIO_read ( const int fd, void *pData, const unsigned int nSize )
+{
+   int nRet = -1;
+   DEVIO_fd_t *pFd;
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_read )
+         nRet = pFd->device_read ( pFd->priv, (char *)pData, nSize );
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+/**
+   Device IO - ioctl command.
+*/
+int DEVIO_ioctl ( const int fd, const unsigned int cmd, IFX_ulong_t param )
+{
+   int nRet = -1;
+   DEVIO_fd_t *pFd;
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_ioctl )
+         nRet = pFd->device_ioctl ( pFd->priv, cmd, param );
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+
+/**
+   Device IO - Vectored read from a device.
+
+\remark
+   Without driver support the buffers are read one by one, up to the first
+   short read or failure.
+*/
+int DEVIO_readv ( const int fd, const DEVIO_iovec_t *iov, const unsigned int iovcnt )
+{
+   int nRet = -1, k;
+   unsigned int i;
+   DEVIO_fd_t *pFd;
+
+   if ( ( iov == NULL ) && ( iovcnt != 0 ) )
+   {
+      return ( nRet );
+   }
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_readv )
+      {
+         nRet = pFd->device_readv ( pFd->priv, iov, iovcnt );
+      }
+      else if ( pFd->device_read )
+      {
+         for ( i = 0, nRet = 0; i < iovcnt; i++ )
+         {
+            if ( iov[i].iov_len == 0 )
+               continue;
+
+            k = pFd->device_read ( pFd->priv, (char *)iov[i].iov_base, (IFX_int_t)iov[i].iov_len );
+            if ( k < 0 )
+            {
+               if ( nRet == 0 )
+                  nRet = -1;
+               break;
+            }
+
+            nRet += k;
+            if ( (unsigned int)k < iov[i].iov_len )
+               break;
+         }
+      }
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+/**
+   Device IO - Vectored write to a device.
+
+\remark
+   Without driver support the buffers are written one by one, up to the
+   first short write or failure.
+*/
+int DEVIO_writev ( const int fd, const DEVIO_iovec_t *iov, const unsigned int iovcnt )
+{
+   int nRet = -1, k;
+   unsigned int i;
+   DEVIO_fd_t *pFd;
+
+   if ( ( iov == NULL ) && ( iovcnt != 0 ) )
+   {
+      return ( nRet );
+   }
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_writev )
+      {
+         nRet = pFd->device_writev ( pFd->priv, iov, iovcnt );
+      }
+      else if ( pFd->device_write )
+      {
+         for ( i = 0, nRet = 0; i < iovcnt; i++ )
+         {
+            if ( iov[i].iov_len == 0 )
+               continue;
+
+            k = pFd->device_write ( pFd->priv, (const char *)iov[i].iov_base, (IFX_int_t)iov[i].iov_len );
+            if ( k < 0 )
+            {
+               if ( nRet == 0 )
+                  nRet = -1;
+               break;
+            }
+
+            nRet += k;
+            if ( (unsigned int)k < iov[i].iov_len )
+               break;
+         }
+      }
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+/**
+   Device IO - ioctl batch.
+
+\remark
+   Without driver support the commands are executed one by one, up to the
+   first command with a negative result.
+*/
+int DEVIO_ioctl_batch ( const int fd, DEVIO_ioctl_cmd_t *cmds, const unsigned int num )
+{
+   int nRet = -1;
+   unsigned int i;
+   DEVIO_fd_t *pFd;
+
+   if ( ( cmds == NULL ) && ( num != 0 ) )
+   {
+      return ( nRet );
+   }
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd != NULL )
+   {
+      if ( pFd->device_ioctl_batch )
+      {
+         nRet = pFd->device_ioctl_batch ( pFd->priv, cmds, num );
+      }
+      else if ( pFd->device_ioctl )
+      {
+         for ( i = 0, nRet = 0; i < num; i++ )
+         {
+            cmds[i].ret = pFd->device_ioctl ( pFd->priv, cmds[i].cmd, cmds[i].param );
+            if ( cmds[i].ret < 0 )
+               break;
+
+            nRet++;
+         }
+      }
+
+      DEVIO_fd_put(pFd);
+   }
+
+   return ( nRet );
+}
+
+
+/**
+   Device IO - Signal the readiness of an open device instance.
+*/
+void DEVIO_device_notify ( void *pprivate )
+{
+   DEVIO_select_waiter_t *waiter;
+   DEVIO_poll_entry_t *entry;
+   DEVIO_fd_t *pFd;
+   unsigned int idx, fd;
+
+   IFXOS_MutexGet(&mutex);
+
+   for ( entry = DEVIO_poll_hash[DEVIO_POLL_HASH_BUCKET(pprivate)];
+         entry != IFX_NULL; entry = entry->hash_next )
+   {
+      if ( entry->priv == pprivate )
+      {
+         entry->ready = 1;
+         if ( entry->set->waiting )
+         {
+            IFXOS_EventWakeUp(&entry->set->event);
+         }
+      }
+   }
+
+   for ( waiter = DEVIO_select_waiters; waiter != IFX_NULL; waiter = waiter->next )
+   {
+      for ( idx = 0; (idx < waiter->max_fd) && (idx < DEVIO_MAXFDS); idx++ )
+      {
+         fd = waiter->read_fd_in->fds[idx];
+         if ( fd == 0 )
+         {
+            continue;
+         }
+         pFd = (DEVIO_fd_t *)DEVIO_table_entry(&DEVIO_fd_table, idx);
+         if ( ( pFd != NULL ) && ( pFd->hdr.generation == DEVIO_FD_GEN(fd - 1) ) &&
+              ( pFd->priv == pprivate ) )
+         {
+            IFXOS_EventWakeUp(&waiter->event);
+            break;
+         }
+      }
+   }
+
+   IFXOS_MutexRelease(&mutex);
+}
+
+/**
+   Device IO - Device select.
+
+\param
+   max_fd         max FD value within the given fd_set struct plus 1,
+                  the set is checked up to DEVIO_MAXFDS
+\param
+   read_fd_in     given FD's to check [IN]
+\param
+   read_fd_out    found FD's which contains data [OUT]
+\param
+   timeout_msec   wait time in [msec]
+                  0: used for poll, checks the given FD's and returns immediately.
+                  -1 (0xFFFFFFFF): wait forever.
+\return
+   return
+
+\remark
+   The call is registered as waiter before the devices are polled, so a
+   DEVIO_device_notify() during the poll is not lost. Devices of drivers
+   without notification support are polled every DEVIO_SELECT_POLLING_TIME.
+*/
+int DEVIO_select ( const unsigned int max_fd, const DEVIO_fd_set_t * read_fd_in,
+                  DEVIO_fd_set_t * read_fd_out, const unsigned int timeout_msec )
+{
+   int fd, k, nRet = 0;
+   unsigned int idx, num_idx, wait_msec, polling;
+   IFX_time_t elapsed, start;
+   void *priv;
+   DEVIO_fd_t *pFd;
+   DEVIO_driver_t *pDriver;
+   DEVIO_select_waiter_t waiter, **pp_waiter;
+
+   if(read_fd_out)
+   {
+      memset(read_fd_out, 0x00, sizeof(DEVIO_fd_set_t));
+   }
+
+   if ( read_fd_in == 0 )
+   {
+      return -1;
+   }
+
+   /* a descriptor out of the set range has been refused */
+   if ( read_fd_in->overflow != 0 )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO select, descriptor out of the set range (%u)" IFXOS_CRLF,
+           (unsigned int)DEVIO_MAXFDS));
+
+      return -1;
+   }
+
+   /* a descriptor is stored at its table index */
+   num_idx = ( max_fd < DEVIO_MAXFDS ) ? max_fd : DEVIO_MAXFDS;
+
+   waiter.read_fd_in = read_fd_in;
+   waiter.max_fd     = max_fd;
+   if (timeout_msec != 0)
+   {
+      if (IFXOS_EventInit(&waiter.event) != IFX_SUCCESS)
+      {
+         return -1;
+      }
+
+      IFXOS_MutexGet(&mutex);
+      waiter.next = DEVIO_select_waiters;
+      DEVIO_select_waiters = &waiter;
+      IFXOS_MutexRelease(&mutex);
+   }
+
+   start = IFXOS_ElapsedTimeMSecGet(0);
+
+   while ( nRet == 0 )
+   {
+      polling = 0;
+
+      for ( idx = 0; idx < num_idx; idx++ )
+      {
+         if ( read_fd_in->fds[idx] == 0 )
+         {
+            continue;
+         }
+         fd = (int)(read_fd_in->fds[idx] - 1);
+         pFd = DEVIO_fd_get(fd);
+         if ( pFd == NULL )
+         {
+            continue;
+         }
+         priv = pFd->priv;
+         pDriver = DEVIO_fd_driver(pFd);
+         if ( pDriver != IFX_NULL )
+         {
+            if ( pDriver->device_poll != NULL )
+            {
+               k = pDriver->device_poll ( priv );
+               if ( read_fd_out && k )
+               {
+                  read_fd_out->fds[idx] = (unsigned int)fd + 1;
+               }
+               nRet |= k;
+
+               if ( pDriver->notify == 0 )
+               {
+                  polling = 1;
+               }
+            }
+         }
+         DEVIO_fd_put(pFd);
+      }
+
+      if ( ( nRet ) || (timeout_msec == 0) )
+         break;
+
+      wait_msec = timeout_msec;
+      if (timeout_msec != (unsigned int)(-1))
+      {
+         elapsed = IFXOS_ElapsedTimeMSecGet(start);
+         if (elapsed >= timeout_msec)
+            break;
+
+         wait_msec = timeout_msec - (unsigned int)elapsed;
+      }
+
+      if ( polling && (wait_msec > DEVIO_SELECT_POLLING_TIME) )
+      {
+         wait_msec = DEVIO_SELECT_POLLING_TIME;
+      }
+
+      /* sleep up to a notification or the (polling) timeout */
+      (void)IFXOS_EventWait(&waiter.event, wait_msec, IFX_NULL);
+   }
+
+   if (timeout_msec != 0)
+   {
+      IFXOS_MutexGet(&mutex);
+      for ( pp_waiter = &DEVIO_select_waiters; *pp_waiter != IFX_NULL;
+            pp_waiter = &(*pp_waiter)->next )
+      {
+         if (*pp_waiter == &waiter)
+         {
+            *pp_waiter = waiter.next;
+            break;
+         }
+      }
+      IFXOS_MutexRelease(&mutex);
+
+      IFXOS_EventDelete(&waiter.event);
+   }
+
+   return nRet;
+}
+
+
+/* ============================================================================
+   Device IO - Poll sets
+   ========================================================================= */
+
+/**
+   Device IO - Remove a poll set entry from the poll set index (lock taken).
+*/
+static void DEVIO_poll_unhash ( DEVIO_poll_entry_t *entry )
+{
+   DEVIO_poll_entry_t **pp_entry;
+
+   for ( pp_entry = &DEVIO_poll_hash[DEVIO_POLL_HASH_BUCKET(entry->priv)];
+         *pp_entry != IFX_NULL; pp_entry = &(*pp_entry)->hash_next )
+   {
+      if ( *pp_entry == entry )
+      {
+         *pp_entry = entry->hash_next;
+         break;
+      }
+   }
+   entry->hash_next = IFX_NULL;
+}
+
+/**
+   Device IO - Create a poll set.
+*/
+DEVIO_poll_set_t *DEVIO_poll_create ( void )
+{
+   DEVIO_poll_set_t *set;
+
+   set = (DEVIO_poll_set_t *)IFXOS_MemAlloc(sizeof(DEVIO_poll_set_t));
+   if ( set == NULL )
+   {
+      return NULL;
+   }
+   memset(set, 0x00, sizeof(DEVIO_poll_set_t));
+
+   if ( IFXOS_EventInit(&set->event) != IFX_SUCCESS )
+   {
+      IFXOS_MemFree(set);
+      return NULL;
+   }
+
+   return set;
+}
+
+/**
+   Device IO - Delete a poll set.
+*/
+void DEVIO_poll_delete ( DEVIO_poll_set_t *set )
+{
+   DEVIO_poll_entry_t *entry;
+
+   if ( set == NULL )
+   {
+      return;
+   }
+
+   IFXOS_MutexGet(&mutex);
+   for ( entry = set->entries; entry != NULL; entry = entry->next )
+   {
+      if ( entry->fd >= 0 )
+         DEVIO_poll_unhash(entry);
+   }
+   IFXOS_MutexRelease(&mutex);
+
+   while ( set->entries != NULL )
+   {
+      entry = set->entries;
+      set->entries = entry->next;
+      IFXOS_MemFree(entry);
+   }
+
+   IFXOS_EventDelete(&set->event);
+   IFXOS_MemFree(set);
+}
+
+/**
+   Device IO - Add a descriptor to a poll set.
+*/
+int DEVIO_poll_add ( DEVIO_poll_set_t *set, const int fd, void *pUser )
+{
+   DEVIO_poll_entry_t *entry, *free_entry = NULL;
+   DEVIO_driver_t *pDriver;
+   DEVIO_fd_t *pFd;
+   int nRet = -1;
+
+   if ( set == NULL )
+   {
+      return -1;
+   }
+
+   pFd = DEVIO_fd_get(fd);
+   if ( pFd == NULL )
+   {
+      return -1;
+   }
+
+   IFXOS_MutexGet(&mutex);
+
+   for ( entry = set->entries; entry != NULL; entry = entry->next )
+   {
+      if ( entry->fd == fd )
+         break;
+      if ( ( entry->fd < 0 ) && ( free_entry == NULL ) )
+         free_entry = entry;
+   }
+
+   if ( entry == NULL )
+   {
+      entry = free_entry;
+      if ( entry == NULL )
+      {
+         entry = (DEVIO_poll_entry_t *)IFXOS_MemAlloc(sizeof(DEVIO_poll_entry_t));
+         if ( entry != NULL )
+         {
+            memset(entry, 0x00, sizeof(DEVIO_poll_entry_t));
+            entry->set   = set;
+            entry->fd    = -1;
+            entry->next  = set->entries;
+            set->entries = entry;
+         }
+      }
+
+      if ( entry != NULL )
+      {
+         pDriver = DEVIO_fd_driver(pFd);
+
+         entry->fd     = fd;
+         entry->priv   = pFd->priv;
+         entry->pUser  = pUser;
+         /* check the current state by the next wait */
+         entry->ready  = 1;
+         entry->polled = ( ( pDriver == IFX_NULL ) || ( pDriver->notify == 0 ) ) ? 1 : 0;
+
+         entry->hash_next = DEVIO_poll_hash[DEVIO_POLL_HASH_BUCKET(entry->priv)];
+         DEVIO_poll_hash[DEVIO_POLL_HASH_BUCKET(entry->priv)] = entry;
+
+         if ( set->waiting )
+         {
+            IFXOS_EventWakeUp(&set->event);
+         }
+
+         nRet = 0;
+      }
+   }
+
+   IFXOS_MutexRelease(&mutex);
+
+   DEVIO_fd_put(pFd);
+
+   return nRet;
+}
+
+/**
+   Device IO - Remove a descriptor from a poll set.
 */
-int DEVIO_ioctl ( const int fd, const unsigned int cmd, IFX_ulong_t param )
+int DEVIO_poll_remove ( DEVIO_poll_set_t *set, const int fd )
 {
-   unsigned int dev_no, drv_no;
+   DEVIO_poll_entry_t *entry;
    int nRet = -1;
-   void *priv = NULL;
-   DEVIO_device_ioctl foo = NULL;
 
-   if ( fd < DEVIO_MAXFDS )
+   if ( ( set == NULL ) || ( fd < 0 ) )
+   {
+      return -1;
+   }
+
+   IFXOS_MutexGet(&mutex);
+
+   for ( entry = set->entries; entry != NULL; entry = entry->next )
    {
-      if ( fd >= 0 )
+      if ( entry->fd == fd )
       {
-         IFXOS_MutexGet(&mutex);
+         DEVIO_poll_unhash(entry);
+         entry->fd    = -1;
+         entry->priv  = NULL;
+         entry->pUser = NULL;
+         entry->ready = 0;
+         nRet = 0;
+         break;
+      }
+   }
+
+   IFXOS_MutexRelease(&mutex);
+
+   return nRet;
+}
+
+/**
+   Device IO - Wait for ready descriptors of a poll set.
+
+\remark
+   The candidates (signaled, last time ready or without notification) are
+   taken under the lock, their signal is cleared before the driver poll, so
+   a notification during the check is not lost. The ready candidates are
+   signaled again, so they are checked again by the next wait.
+   Only one wait per poll set is allowed at a time.
+*/
+int DEVIO_poll_wait ( DEVIO_poll_set_t *set, DEVIO_poll_event_t *events,
+                      const unsigned int max_events, const unsigned int timeout_msec )
+{
+   unsigned int n, nReady, wait_msec, polling;
+   IFX_time_t elapsed, start;
+   DEVIO_poll_entry_t *entry, *first;
+   DEVIO_driver_t *pDriver;
+   DEVIO_fd_t *pFd;
+   int k;
+
+   if ( ( set == NULL ) || ( events == NULL ) || ( max_events == 0 ) )
+   {
+      return -1;
+   }
+
+   start = IFXOS_ElapsedTimeMSecGet(0);
+
+   for (;;)
+   {
+      n       = 0;
+      nReady  = 0;
+      polling = 0;
+
+      IFXOS_MutexGet(&mutex);
+      set->waiting = ( timeout_msec != 0 ) ? 1 : 0;
+      first = set->entries;
+      for ( entry = first; entry != NULL; entry = entry->next )
+      {
+         entry->check = 0;
+         if ( ( entry->fd >= 0 ) && ( entry->ready || entry->polled ) )
+         {
+            entry->check      = 1;
+            entry->check_fd   = entry->fd;
+            entry->check_user = entry->pUser;
+            entry->ready      = 0;
+         }
+      }
+      IFXOS_MutexRelease(&mutex);
+
+      for ( entry = first; entry != NULL; entry = entry->next )
+      {
+         if ( entry->check == 0 )
+            continue;
+
+         if ( entry->polled )
+            polling = 1;
+
+         k = 0;
+         pFd = DEVIO_fd_get(entry->check_fd);
+         if ( pFd != NULL )
+         {
+            pDriver = DEVIO_fd_driver(pFd);
+            if ( ( pDriver != IFX_NULL ) && ( pDriver->device_poll != NULL ) )
+            {
+               k = pDriver->device_poll ( pFd->priv );
+            }
+            DEVIO_fd_put(pFd);
+         }
+
+         if ( k == 0 )
+         {
+            entry->check = 0;
+            continue;
+         }
 
-         dev_no = DEVIO_fd_table[fd].device_number;
-         priv = DEVIO_fd_table[fd].priv;
-         if ( (dev_no < DEVIO_MAXDEVICES)
-              && ( ( drv_no = DEVIO_device_table[dev_no].driver_number ) < DEVIO_MAXDRIVERS ) )
+         nReady++;
+         if ( n < max_events )
          {
-            foo = DEVIO_driver_table[drv_no].device_ioctl;
+            events[n].fd    = entry->check_fd;
+            events[n].pUser = entry->check_user;
+            n++;
          }
+      }
 
+      if ( nReady > 0 )
+      {
+         /* level triggered - check the ready descriptors again by the next wait */
+         IFXOS_MutexGet(&mutex);
+         for ( entry = first; entry != NULL; entry = entry->next )
+         {
+            if ( ( entry->check ) && ( entry->fd == entry->check_fd ) )
+               entry->ready = 1;
+         }
          IFXOS_MutexRelease(&mutex);
       }
 
-      if(foo)
-         nRet = foo ( priv, cmd, param );
+      if ( ( n > 0 ) || ( timeout_msec == 0 ) )
+         break;
+
+      wait_msec = timeout_msec;
+      if (timeout_msec != (unsigned int)(-1))
+      {
+         elapsed = IFXOS_ElapsedTimeMSecGet(start);
+         if (elapsed >= timeout_msec)
+            break;
+
+         wait_msec = timeout_msec - (unsigned int)elapsed;
+      }
+
+      if ( polling && (wait_msec > DEVIO_SELECT_POLLING_TIME) )
+      {
+         wait_msec = DEVIO_SELECT_POLLING_TIME;
+      }
+
+      /* sleep up to a notification or the (polling) timeout */
+      (void)IFXOS_EventWait(&set->event, wait_msec, IFX_NULL);
    }
 
-   return ( nRet );
+   if ( timeout_msec != 0 )
+   {
+      IFXOS_MutexGet(&mutex);
+      set->waiting = 0;
+      IFXOS_MutexRelease(&mutex);
+   }
+
+   return (int)n;
 }
 
+/* ============================================================================
+   Device IO - Asynchronous operations
+   ========================================================================= */
 
 /**
-   Device IO - Device select.
+   Device IO - Execute an asynchronous operation via the synchronous driver
+   functions.
+*/
+static int DEVIO_async_exec ( DEVIO_fd_t *pFd, DEVIO_async_op_t *op )
+{
+   int nRet = -1;
 
-\param
-   max_fd         max FD value within the given fd_set struct plus 1
-\param
-   read_fd_in     given FD's to check [IN]
-\param
-   read_fd_out    found FD's which contains data [OUT]
-\param
-   timeout_msec   wait time in [msec]
-                  0: used for poll, checks the given FD's and returns immediately.
-                  -1 (0xFFFFFFFF): wait forever.
-\return
-   return
+   /* queued operation of a closed instance, not passed to the driver */
+   if ( ( DEVIO_FD_REF_LOAD(pFd) & DEVIO_FD_OPEN ) == 0 )
+   {
+      return nRet;
+   }
+
+   switch ( op->op )
+   {
+      case DEVIO_ASYNC_OP_READ:
+         if ( pFd->device_read )
+            nRet = pFd->device_read ( pFd->priv, (char *)op->pData, (IFX_int_t)op->nSize );
+         break;
+
+      case DEVIO_ASYNC_OP_WRITE:
+         if ( pFd->device_write )
+            nRet = pFd->device_write ( pFd->priv, (const char *)op->pData, (IFX_int_t)op->nSize );
+         break;
+
+      case DEVIO_ASYNC_OP_IOCTL:
+         if ( pFd->device_ioctl )
+            nRet = pFd->device_ioctl ( pFd->priv, op->cmd, op->param );
+         break;
+
+      default:
+         break;
+   }
+
+   return nRet;
+}
 
+/**
+   Device IO - Asynchronous operations, worker thread.
 */
-int DEVIO_select ( const unsigned int max_fd, const DEVIO_fd_set_t * read_fd_in,
-                  DEVIO_fd_set_t * read_fd_out, const unsigned int timeout_msec )
+static IFX_int32_t DEVIO_async_worker ( IFXOS_ThreadParams_t *pThrParams )
 {
-   int fd, k, nRet = 0;
-   unsigned int dev_no, drv_no, t = 0;
-   void *priv;
+   DEVIO_async_ctx_t *ctx = (DEVIO_async_ctx_t *)pThrParams->nArg1;
+   DEVIO_async_op_t  *op;
 
-   if(read_fd_out)
+   while ( (pThrParams->bShutDown == IFX_FALSE) &&
+           (ctx->bShutDown == IFX_FALSE) )
    {
-      memset(read_fd_out, 0x00, sizeof(DEVIO_fd_set_t));
+      IFXOS_MutexGet(&ctx->mutex);
+      op = ctx->pPendHead;
+      if ( op != NULL )
+      {
+         ctx->pPendHead = op->pNext;
+         if ( ctx->pPendHead == NULL )
+            ctx->pPendTail = NULL;
+      }
+      IFXOS_MutexRelease(&ctx->mutex);
+
+      if ( op == NULL )
+      {
+         IFXOS_EventWait(&ctx->workerEvent, DEVIO_ASYNC_IDLE_WAIT_MS, IFX_NULL);
+         continue;
+      }
+
+      DEVIO_async_done(op, DEVIO_async_exec((DEVIO_fd_t *)op->pInstance, op));
    }
 
-   if ( read_fd_in == 0 )
+   return IFX_SUCCESS;
+}
+
+/**
+   Device IO - Create an asynchronous operation context.
+*/
+IFX_int32_t DEVIO_async_ctx_init (
+                        DEVIO_async_ctx_t    *ctx,
+                        const IFX_char_t     *pName,
+                        const unsigned int   nWorkers,
+                        const unsigned int   nPriority )
+{
+   unsigned int i;
+
+   if ( ctx == NULL )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO async init, missing object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   memset(ctx, 0x00, sizeof(DEVIO_async_ctx_t));
+   ctx->nWorkers = nWorkers;
+
+   if ( (IFXOS_MutexInit(&ctx->mutex) != IFX_SUCCESS) ||
+        (IFXOS_EventInit(&ctx->workerEvent) != IFX_SUCCESS) ||
+        (IFXOS_EventInit(&ctx->doneEvent) != IFX_SUCCESS) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO async <%s> init, mutex / event init failed" IFXOS_CRLF,
+           (pName) ? pName : "noname"));
+
+      goto DEVIO_ASYNC_CTX_INIT_ERROR;
+   }
+
+   if ( nWorkers > 0 )
+   {
+      ctx->pWorkerThreads =
+         (IFXOS_ThreadCtrl_t *)IFXOS_MemAlloc(nWorkers * sizeof(IFXOS_ThreadCtrl_t));
+      if ( ctx->pWorkerThreads == NULL )
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - DEVIO async <%s> init, no memory for %u workers" IFXOS_CRLF,
+              (pName) ? pName : "noname", nWorkers));
+
+         goto DEVIO_ASYNC_CTX_INIT_ERROR;
+      }
+      memset(ctx->pWorkerThreads, 0x00, nWorkers * sizeof(IFXOS_ThreadCtrl_t));
+   }
+
+   ctx->bValid = IFX_TRUE;
+
+   for ( i = 0; i < nWorkers; i++ )
+   {
+      if ( IFXOS_ThreadInit(&ctx->pWorkerThreads[i], pName,
+                            DEVIO_async_worker,
+                            IFXOS_DEFAULT_STACK_SIZE, nPriority,
+                            (IFX_ulong_t)ctx, 0) != IFX_SUCCESS )
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - DEVIO async <%s> init, worker thread %u start failed" IFXOS_CRLF,
+              (pName) ? pName : "noname", i));
+
+         (void)DEVIO_async_ctx_delete(ctx);
+         return IFX_ERROR;
+      }
+   }
+
+   return IFX_SUCCESS;
+
+DEVIO_ASYNC_CTX_INIT_ERROR:
+
+   if ( IFXOS_EVENT_INIT_VALID(&ctx->doneEvent) == IFX_TRUE )
+      IFXOS_EventDelete(&ctx->doneEvent);
+   if ( IFXOS_EVENT_INIT_VALID(&ctx->workerEvent) == IFX_TRUE )
+      IFXOS_EventDelete(&ctx->workerEvent);
+   if ( IFXOS_MUTEX_INIT_VALID(&ctx->mutex) == IFX_TRUE )
+      IFXOS_MutexDelete(&ctx->mutex);
+
+   return IFX_ERROR;
+}
+
+/**
+   Device IO - Delete an asynchronous operation context.
+*/
+IFX_int32_t DEVIO_async_ctx_delete (
+                        DEVIO_async_ctx_t    *ctx )
+{
+   IFX_int32_t  retVal = IFX_SUCCESS;
+   unsigned int i, nInFlight;
+
+   if ( (ctx == NULL) || (ctx->bValid != IFX_TRUE) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO async delete, invalid object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   IFXOS_MutexGet(&ctx->mutex);
+   nInFlight = ctx->nInFlight;
+   IFXOS_MutexRelease(&ctx->mutex);
+
+   if ( nInFlight != 0 )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO async delete, %u operations in flight" IFXOS_CRLF,
+           nInFlight));
+
+      return IFX_ERROR;
+   }
+
+   /* stop the worker threads */
+   ctx->bShutDown = IFX_TRUE;
+   for ( i = 0; i < ctx->nWorkers; i++ )
+   {
+      IFXOS_EventWakeUp(&ctx->workerEvent);
+   }
+
+   for ( i = 0; (ctx->pWorkerThreads != NULL) && (i < ctx->nWorkers); i++ )
+   {
+      if ( IFXOS_THREAD_INIT_VALID(&ctx->pWorkerThreads[i]) == IFX_TRUE )
+      {
+         if ( IFXOS_ThreadDelete(&ctx->pWorkerThreads[i],
+                                 DEVIO_ASYNC_THREAD_DELETE_WAIT_MS) != IFX_SUCCESS )
+            retVal = IFX_ERROR;
+      }
+   }
+
+   ctx->bValid    = IFX_FALSE;
+   ctx->pDoneHead = NULL;
+   ctx->pDoneTail = NULL;
+
+   if ( ctx->pWorkerThreads != NULL )
+   {
+      IFXOS_MemFree(ctx->pWorkerThreads);
+      ctx->pWorkerThreads = NULL;
+   }
+
+   IFXOS_EventDelete(&ctx->doneEvent);
+   IFXOS_EventDelete(&ctx->workerEvent);
+   IFXOS_MutexDelete(&ctx->mutex);
+
+   return retVal;
+}
+
+/**
+   Device IO - Submit an asynchronous operation.
+
+\remark
+   The operation holds a reference of the open instance up to its
+   completion. It is passed to the driver asynchronous operation function,
+   else it is queued for the worker threads (executed directly if the
+   context has no worker threads).
+*/
+int DEVIO_async_submit ( DEVIO_async_ctx_t *ctx, DEVIO_async_op_t *op )
+{
+   DEVIO_fd_t *pFd;
+
+   if ( (ctx == NULL) || (ctx->bValid != IFX_TRUE) ||
+        (op == NULL) || (op->op > DEVIO_ASYNC_OP_IOCTL) )
    {
       return -1;
    }
 
-   while ( nRet == 0 )
+   pFd = DEVIO_fd_get(op->fd);
+   if ( pFd == NULL )
+   {
+      return -1;
+   }
+
+   op->ret       = -1;
+   op->pNext     = NULL;
+   op->pCtx      = ctx;
+   op->pInstance = pFd;
+
+   IFXOS_MutexGet(&ctx->mutex);
+   ctx->nInFlight++;
+   IFXOS_MutexRelease(&ctx->mutex);
+
+   if ( pFd->device_async )
    {
-      for ( fd = 0; fd < (int)max_fd; fd++ )
+      if ( pFd->device_async ( pFd->priv, op ) < 0 )
       {
-         if (fd >= DEVIO_MAXFDS)
-         {
-            return -1;
-         }
-         if ( read_fd_in->fds[fd] == 0 )
-         {
-            continue;
-         }
-         dev_no = DEVIO_fd_table[fd].device_number;
-         priv = DEVIO_fd_table[fd].priv;
-         if ( dev_no < DEVIO_MAXDEVICES
-              && ( ( drv_no = DEVIO_device_table[dev_no].driver_number ) < DEVIO_MAXDRIVERS ) )
-         {
-            if ( DEVIO_driver_table[drv_no].device_poll != NULL )
-            {
-               k = DEVIO_driver_table[drv_no].device_poll ( priv );
-               if ( read_fd_out && k )
-               {
-                  read_fd_out->fds[fd] = 1;
-               }
-               nRet |= k;
-            }
-         }
+         IFXOS_MutexGet(&ctx->mutex);
+         ctx->nInFlight--;
+         IFXOS_MutexRelease(&ctx->mutex);
+
+         op->pInstance = NULL;
+         DEVIO_fd_put(pFd);
+         return -1;
+      }
+
+      return 0;
+   }
+
+   if ( ctx->nWorkers == 0 )
+   {
+      DEVIO_async_done(op, DEVIO_async_exec(pFd, op));
+      return 0;
+   }
+
+   IFXOS_MutexGet(&ctx->mutex);
+   if ( ctx->pPendTail != NULL )
+      ctx->pPendTail->pNext = op;
+   else
+      ctx->pPendHead = op;
+   ctx->pPendTail = op;
+   IFXOS_MutexRelease(&ctx->mutex);
+
+   IFXOS_EventWakeUp(&ctx->workerEvent);
+
+   return 0;
+}
+
+/**
+   Device IO - Complete an asynchronous operation.
+*/
+void DEVIO_async_done ( DEVIO_async_op_t *op, const IFX_int_t ret )
+{
+   DEVIO_async_ctx_t *ctx;
+
+   if ( (op == NULL) || (op->pInstance == NULL) )
+   {
+      return;
+   }
+
+   ctx = op->pCtx;
+
+   op->ret   = ret;
+   op->pNext = NULL;
+   DEVIO_fd_put((DEVIO_fd_t *)op->pInstance);
+   op->pInstance = NULL;
+
+   IFXOS_MutexGet(&ctx->mutex);
+   if ( ctx->pDoneTail != NULL )
+      ctx->pDoneTail->pNext = op;
+   else
+      ctx->pDoneHead = op;
+   ctx->pDoneTail = op;
+   ctx->nInFlight--;
+   /* wakeup with the lock held, the context may be deleted after the
+      release (last operation collected) */
+   IFXOS_EventWakeUp(&ctx->doneEvent);
+   IFXOS_MutexRelease(&ctx->mutex);
+}
+
+/**
+   Device IO - Collect completed asynchronous operations.
+*/
+int DEVIO_async_wait ( DEVIO_async_ctx_t *ctx, DEVIO_async_op_t **ops,
+                       const unsigned int max_ops, const unsigned int timeout_msec )
+{
+   unsigned int n, wait_msec;
+   IFX_time_t elapsed, start;
+
+   if ( (ctx == NULL) || (ctx->bValid != IFX_TRUE) ||
+        (ops == NULL) || (max_ops == 0) )
+   {
+      return -1;
+   }
+
+   start = IFXOS_ElapsedTimeMSecGet(0);
+
+   for (;;)
+   {
+      n = 0;
+
+      IFXOS_MutexGet(&ctx->mutex);
+      while ( (n < max_ops) && (ctx->pDoneHead != NULL) )
+      {
+         ops[n++] = ctx->pDoneHead;
+         ctx->pDoneHead = ctx->pDoneHead->pNext;
       }
+      if ( ctx->pDoneHead == NULL )
+         ctx->pDoneTail = NULL;
+      IFXOS_MutexRelease(&ctx->mutex);
 
-      if ( ( nRet ) || (timeout_msec == 0) || (t > timeout_msec) )
+      if ( (n > 0) || (timeout_msec == 0) )
          break;
 
+      wait_msec = timeout_msec;
       if (timeout_msec != (unsigned int)(-1))
       {
-         t += DEVIO_SELECT_POLLING_TIME;
+         elapsed = IFXOS_ElapsedTimeMSecGet(start);
+         if (elapsed >= timeout_msec)
+            break;
+
+         wait_msec = timeout_msec - (unsigned int)elapsed;
       }
 
-      IFXOS_MSecSleep ( DEVIO_SELECT_POLLING_TIME );
+      /* sleep up to a completion or the timeout, wakeups may be merged */
+      (void)IFXOS_EventWait(&ctx->doneEvent, wait_msec, IFX_NULL);
    }
 
-   return nRet;
+   return (int)n;
 }
 
-
-
-void DEVIO_fd_set(const unsigned int  fd, DEVIO_fd_set_t *set)
+int DEVIO_fd_set(const unsigned int  fd, DEVIO_fd_set_t *set)
 {
-   if(set && (fd < DEVIO_MAXFDS))
+   if(set == 0)
+   {
+      return -1;
+   }
+
+   if(DEVIO_FD_INDEX(fd) >= DEVIO_MAXFDS)
    {
-      set->fds[fd] = 1;
+      set->overflow = 1;
+      return -1;
    }
+
+   set->fds[DEVIO_FD_INDEX(fd)] = fd + 1;
+
+   return 0;
 }
 
 int DEVIO_fd_isset(const unsigned int  fd, const DEVIO_fd_set_t *set)
 {
-   if((set == 0) || (fd >= DEVIO_MAXFDS))
+   if((set == 0) || (DEVIO_FD_INDEX(fd) >= DEVIO_MAXFDS))
    {
       return 0;
    }
-   return set->fds[fd];
+   return (set->fds[DEVIO_FD_INDEX(fd)] == fd + 1) ? 1 : 0;
 }
 
 void DEVIO_fd_clear(const unsigned int  fd, DEVIO_fd_set_t *set)
 {
-   if(set && (fd < DEVIO_MAXFDS))
+   if(set && (DEVIO_FD_INDEX(fd) < DEVIO_MAXFDS) && (set->fds[DEVIO_FD_INDEX(fd)] == fd + 1))
    {
-      set->fds[fd] = 0;
+      set->fds[DEVIO_FD_INDEX(fd)] = 0;
    }
 }
 
@@ -580,6 +2210,7 @@ void DEVIO_fd_zero(DEVIO_fd_set_t *set)
    {
       set->fds[i] = 0;
    }
+   set->overflow = 0;
 }
 
 #endif      /* #if (defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1)) */
@@ -245,6 +245,242 @@ IFX_void_t IFXOS_DevFdZero(
 }
 #endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SELECT) && (IFXOS_HAVE_DEVICE_ACCESS_SELECT == 1) ) */
 
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) )
+
+/** number of commands passed per DEVIO_ioctl_batch call */
+#define IFXOS_DEV_CTRL_BATCH_DEVIO_CMDS    32
+
+/**
+   DEV_IO - Control a device with a set of commands.
+
+\param
+   devFd       device file descriptor.
+\param
+   pCmds       commands to execute.
+\param
+   nCmds       number of commands.
+\param
+   pResults    returns the result of each executed command.
+
+\return
+   Number of successful commands (stops on the first negative result).
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DeviceControlBatch(
+               const IFX_int32_t          devFd,
+               const IFXOS_DevCtrlCmd_t   *pCmds,
+               const IFX_uint32_t         nCmds,
+               IFX_int32_t                *pResults)
+{
+   DEVIO_ioctl_cmd_t cmds[IFXOS_DEV_CTRL_BATCH_DEVIO_CMDS];
+   IFX_uint32_t done = 0, num, i;
+   IFX_int_t nRet;
+
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pCmds, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pResults, -1);
+
+   while (done < nCmds)
+   {
+      num = ((nCmds - done) < IFXOS_DEV_CTRL_BATCH_DEVIO_CMDS) ?
+               (nCmds - done) : IFXOS_DEV_CTRL_BATCH_DEVIO_CMDS;
+      for (i = 0; i < num; i++)
+      {
+         cmds[i].cmd   = pCmds[done + i].devCmd;
+         cmds[i].param = pCmds[done + i].param;
+      }
+
+      nRet = DEVIO_ioctl_batch(devFd, cmds, num);
+      if (nRet < 0)
+      {
+         return -1;
+      }
+
+      /* the failed command is executed too, return its result */
+      for (i = 0; (i < num) && (i <= (IFX_uint32_t)nRet); i++)
+      {
+         pResults[done + i] = (IFX_int32_t)cmds[i].ret;
+      }
+
+      done += (IFX_uint32_t)nRet;
+      if ((IFX_uint32_t)nRet < num)
+      {
+         break;
+      }
+   }
+
+   return (IFX_int32_t)done;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) && (IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) )
+
+/** max number of ready devices returned by a single DEVIO_poll_wait call */
+#define IFXOS_DEVPOLL_DEVIO_MAX_EVENTS    64
+
+/**
+   DEV_IO - Create a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set created.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollCreate(
+               IFXOS_devPoll_t *pDevPoll)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+
+   pDevPoll->bValid = IFX_FALSE;
+   pDevPoll->pSet = DEVIO_poll_create();
+   if (pDevPoll->pSet == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   pDevPoll->bValid = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   DEV_IO - Delete a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set deleted.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollDelete(
+               IFXOS_devPoll_t *pDevPoll)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+
+   if (pDevPoll->bValid != IFX_TRUE)
+   {
+      return IFX_ERROR;
+   }
+   pDevPoll->bValid = IFX_FALSE;
+
+   DEVIO_poll_delete(pDevPoll->pSet);
+   pDevPoll->pSet = IFX_NULL;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   DEV_IO - Add a device to a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+\param
+   events      events to wait for, only IFXOS_DEVPOLL_IN is supported.
+\param
+   pUser       user data, returned with the ready device.
+
+\return
+   IFX_SUCCESS device added.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollAdd(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd,
+               const IFX_uint32_t   events,
+               IFX_void_t           *pUser)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, IFX_ERROR);
+
+   /* the driver poll reports the read readiness only */
+   if ((pDevPoll->bValid != IFX_TRUE) || (events != IFXOS_DEVPOLL_IN))
+   {
+      return IFX_ERROR;
+   }
+
+   return (DEVIO_poll_add(pDevPoll->pSet, devFd, pUser) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   DEV_IO - Remove a device from a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+
+\return
+   IFX_SUCCESS device removed.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollRemove(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, IFX_ERROR);
+
+   if (pDevPoll->bValid != IFX_TRUE)
+   {
+      return IFX_ERROR;
+   }
+
+   return (DEVIO_poll_remove(pDevPoll->pSet, devFd) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   DEV_IO - Wait for ready devices of a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   pEvents     returns the ready devices.
+\param
+   maxEvents   max number of entries of pEvents.
+\param
+   timeout_ms  max time to wait [ms].
+
+\return
+   Number of ready devices (0: timeout).
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DevPollWait(
+               IFXOS_devPoll_t      *pDevPoll,
+               IFXOS_DevPollEvent_t *pEvents,
+               const IFX_uint32_t   maxEvents,
+               const IFX_uint32_t   timeout_ms)
+{
+   DEVIO_poll_event_t ev[IFXOS_DEVPOLL_DEVIO_MAX_EVENTS];
+   int i, nReady;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pEvents, -1);
+
+   if (pDevPoll->bValid != IFX_TRUE)
+   {
+      return -1;
+   }
+
+   nReady = DEVIO_poll_wait(pDevPoll->pSet, ev,
+               (maxEvents < IFXOS_DEVPOLL_DEVIO_MAX_EVENTS) ?
+                  (unsigned int)maxEvents : IFXOS_DEVPOLL_DEVIO_MAX_EVENTS,
+               timeout_ms);
+
+   for (i = 0; i < nReady; i++)
+   {
+      pEvents[i].devFd  = ev[i].fd;
+      pEvents[i].events = IFXOS_DEVPOLL_IN;
+      pEvents[i].pUser  = ev[i].pUser;
+   }
+
+   return nReady;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) && (IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) ) */
+
 /** @} */
 
 #endif      /* #if defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1) */
@@ -0,0 +1,769 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+
+/** \file
+   This file contains the Device IO loopback driver and the Device IO
+   benchmark.
+
+\par Loopback driver
+   The data written to a loopback device is kept within a ring buffer and
+   returned by the following reads (from any descriptor of the device).
+   Latency and readiness of each device are configurable, a device without
+   buffer is a null device. Two driver instances are installed, one with
+   readiness notification (DEVIO_device_notify) and one which is polled by
+   DEVIO_select().
+
+\par Benchmark
+   The benchmark measures the Device IO layer itself (zero latency null
+   devices), so the results are a baseline without hardware access.
+*/
+#include <string.h>     /* memcpy */
+
+#include "ifx_types.h"
+
+#if (defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1))
+
+/* ============================================================================
+   Device IO loopback - Includes
+   ========================================================================= */
+#include "ifxos_device_io.h"
+#include "ifxos_debug.h"
+#include "ifxos_time.h"
+#include "ifxos_mutex.h"
+#include "ifxos_thread.h"
+#include "ifxos_memory_alloc.h"
+
+#if (defined(DEVIO_HAVE_LOOP_DRIVER) && (DEVIO_HAVE_LOOP_DRIVER == 1))
+
+/* ============================================================================
+   Device IO loopback - Local Defines and Types
+   ========================================================================= */
+
+/** Loopback driver instance - polled by DEVIO_select() */
+#define DEVIO_LOOP_DRV_POLL               0
+/** Loopback driver instance - readiness notification */
+#define DEVIO_LOOP_DRV_NOTIFY             1
+
+/** Benchmark - max time to wait for the end of the threads [ms] */
+#define DEVIO_BENCHMARK_WAIT_MS           600000
+/** Benchmark - number of commands per ioctl batch */
+#define DEVIO_BENCHMARK_BATCH_SIZE        16
+/** Benchmark - data size of a read / write [byte] */
+#define DEVIO_BENCHMARK_DATA_SIZE         64
+
+/** Benchmark - operation, open / close */
+#define DEVIO_BENCHMARK_OP_OPEN_CLOSE     0
+/** Benchmark - operation, write */
+#define DEVIO_BENCHMARK_OP_WRITE          1
+/** Benchmark - operation, read */
+#define DEVIO_BENCHMARK_OP_READ           2
+/** Benchmark - operation, ioctl */
+#define DEVIO_BENCHMARK_OP_IOCTL          3
+/** Benchmark - operation, ioctl batch */
+#define DEVIO_BENCHMARK_OP_IOCTL_BATCH    4
+
+/**
+   Loopback device.
+*/
+struct DEVIO_loop_dev_s
+{
+   /** configuration */
+   DEVIO_loop_cfg_t  cfg;
+   /** protects the buffer */
+   IFXOS_mutex_t     mutex;
+   /** loopback buffer, IFX_NULL: null device */
+   IFX_uint8_t       *pBuf;
+   /** read / write position and fill level of the buffer */
+   unsigned int      rd_pos;
+   unsigned int      wr_pos;
+   unsigned int      fill;
+};
+
+/**
+   Benchmark - control of a single run.
+*/
+typedef struct
+{
+   /** device name */
+   const char              *pDevName;
+   /** operation, see DEVIO_BENCHMARK_OP_xxx */
+   unsigned int            op;
+   /** number of loops per thread */
+   unsigned int            nLoops;
+   /** start trigger for all threads */
+   volatile IFX_boolean_t  bStart;
+} DEVIO_benchmark_t;
+
+/**
+   Benchmark - per thread data.
+*/
+typedef struct
+{
+   /** thread control */
+   IFXOS_ThreadCtrl_t      thrCntrl;
+   /** common benchmark control */
+   DEVIO_benchmark_t       *pBench;
+   /** measured time [ms] */
+   IFX_time_t              time_ms;
+   /** number of failed calls */
+   unsigned int            nFails;
+} DEVIO_benchmark_thr_t;
+
+/** Loopback driver numbers, see DEVIO_LOOP_DRV_xxx */
+static unsigned int DEVIO_loop_drv[2] = { (unsigned int)-1, (unsigned int)-1 };
+
+/* ============================================================================
+   Device IO loopback - Driver functions
+   ========================================================================= */
+
+/**
+   Loopback driver - add the configured latency.
+*/
+static void DEVIO_loop_latency ( DEVIO_loop_dev_t *pDev )
+{
+   if ( pDev->cfg.latency_us == 0 )
+   {
+      return;
+   }
+
+#if ( defined(IFXOS_HAVE_TIME_SLEEP_US) && (IFXOS_HAVE_TIME_SLEEP_US == 1) )
+   IFXOS_USecSleep(pDev->cfg.latency_us);
+#else
+   IFXOS_MSecSleep((pDev->cfg.latency_us + 999) / 1000);
+#endif
+}
+
+/**
+   Loopback driver - open, all descriptors share the device.
+*/
+static IFX_long_t DEVIO_loop_open ( void *device, const IFX_char_t *appendix )
+{
+   (void)appendix;
+
+   return (IFX_long_t)device;
+}
+
+/**
+   Loopback driver - close.
+*/
+static IFX_int_t DEVIO_loop_close ( void *pprivate )
+{
+   (void)pprivate;
+
+   return 0;
+}
+
+/**
+   Loopback driver - read the buffered data.
+*/
+static IFX_int_t DEVIO_loop_read ( void *pprivate, IFX_char_t *buf, const IFX_int_t len )
+{
+   DEVIO_loop_dev_t *pDev = (DEVIO_loop_dev_t *)pprivate;
+   unsigned int n, part;
+
+   DEVIO_loop_latency(pDev);
+
+   if ( pDev->pBuf == IFX_NULL )
+   {
+      return len;
+   }
+
+   IFXOS_MutexGet(&pDev->mutex);
+
+   n = ( (unsigned int)len < pDev->fill ) ? (unsigned int)len : pDev->fill;
+   part = pDev->cfg.buf_size - pDev->rd_pos;
+   if ( part > n )
+      part = n;
+
+   memcpy(buf, &pDev->pBuf[pDev->rd_pos], part);
+   memcpy(buf + part, &pDev->pBuf[0], n - part);
+   pDev->rd_pos = ( pDev->rd_pos + n ) % pDev->cfg.buf_size;
+   pDev->fill  -= n;
+
+   IFXOS_MutexRelease(&pDev->mutex);
+
+   return (IFX_int_t)n;
+}
+
+/**
+   Loopback driver - write into the buffer, signals the readiness.
+*/
+static IFX_int_t DEVIO_loop_write ( void *pprivate, const IFX_char_t *buf, const IFX_int_t len )
+{
+   DEVIO_loop_dev_t *pDev = (DEVIO_loop_dev_t *)pprivate;
+   unsigned int n, part;
+
+   DEVIO_loop_latency(pDev);
+
+   if ( pDev->pBuf == IFX_NULL )
+   {
+      return len;
+   }
+
+   IFXOS_MutexGet(&pDev->mutex);
+
+   n = pDev->cfg.buf_size - pDev->fill;
+   if ( (unsigned int)len < n )
+      n = (unsigned int)len;
+   part = pDev->cfg.buf_size - pDev->wr_pos;
+   if ( part > n )
+      part = n;
+
+   memcpy(&pDev->pBuf[pDev->wr_pos], buf, part);
+   memcpy(&pDev->pBuf[0], buf + part, n - part);
+   pDev->wr_pos = ( pDev->wr_pos + n ) % pDev->cfg.buf_size;
+   pDev->fill  += n;
+
+   IFXOS_MutexRelease(&pDev->mutex);
+
+   if ( ( n > 0 ) && ( pDev->cfg.notify ) )
+   {
+      DEVIO_device_notify(pDev);
+   }
+
+   return (IFX_int_t)n;
+}
+
+/**
+   Loopback driver - execute a command (lock taken).
+*/
+static IFX_int_t DEVIO_loop_cmd ( DEVIO_loop_dev_t *pDev, IFX_uint_t cmd, IFX_ulong_t arg )
+{
+   switch ( cmd )
+   {
+      case DEVIO_LOOP_IOCTL_ECHO:
+         return (IFX_int_t)arg;
+
+      case DEVIO_LOOP_IOCTL_FLUSH:
+         pDev->rd_pos = 0;
+         pDev->wr_pos = 0;
+         pDev->fill   = 0;
+         return 0;
+
+      default:
+         return -1;
+   }
+}
+
+/**
+   Loopback driver - ioctl.
+*/
+static IFX_int_t DEVIO_loop_ioctl ( void *pprivate, IFX_uint_t cmd, IFX_ulong_t arg )
+{
+   DEVIO_loop_dev_t *pDev = (DEVIO_loop_dev_t *)pprivate;
+   IFX_int_t nRet;
+
+   DEVIO_loop_latency(pDev);
+
+   IFXOS_MutexGet(&pDev->mutex);
+   nRet = DEVIO_loop_cmd(pDev, cmd, arg);
+   IFXOS_MutexRelease(&pDev->mutex);
+
+   return nRet;
+}
+
+/**
+   Loopback driver - ioctl batch, one latency and lock for all commands.
+*/
+static IFX_int_t DEVIO_loop_ioctl_batch ( void *pprivate, DEVIO_ioctl_cmd_t *cmds, const IFX_uint_t num )
+{
+   DEVIO_loop_dev_t *pDev = (DEVIO_loop_dev_t *)pprivate;
+   IFX_int_t nRet = 0;
+   IFX_uint_t i;
+
+   DEVIO_loop_latency(pDev);
+
+   IFXOS_MutexGet(&pDev->mutex);
+   for ( i = 0; i < num; i++ )
+   {
+      cmds[i].ret = DEVIO_loop_cmd(pDev, cmds[i].cmd, cmds[i].param);
+      if ( cmds[i].ret < 0 )
+         break;
+
+      nRet++;
+   }
+   IFXOS_MutexRelease(&pDev->mutex);
+
+   return nRet;
+}
+
+/**
+   Loopback driver - poll the readiness.
+*/
+static IFX_int_t DEVIO_loop_poll ( void *pprivate )
+{
+   DEVIO_loop_dev_t *pDev = (DEVIO_loop_dev_t *)pprivate;
+
+   switch ( pDev->cfg.ready_mode )
+   {
+      case DEVIO_LOOP_READY_ALWAYS:
+         return 1;
+
+      case DEVIO_LOOP_READY_DATA:
+         return ( ( pDev->pBuf == IFX_NULL ) || ( pDev->fill > 0 ) ) ? 1 : 0;
+
+      default:
+         return 0;
+   }
+}
+
+/* ============================================================================
+   Device IO loopback - Global functions
+   ========================================================================= */
+
+/**
+   Device IO loopback - Install the loopback driver.
+*/
+IFX_int32_t DEVIO_loop_driver_install ( void )
+{
+   unsigned int i;
+
+   for ( i = 0; i < 2; i++ )
+   {
+      if ( DEVIO_loop_drv[i] != (unsigned int)-1 )
+      {
+         continue;
+      }
+
+      DEVIO_loop_drv[i] = DEVIO_driver_install(DEVIO_loop_open, DEVIO_loop_close,
+                                               DEVIO_loop_read, DEVIO_loop_write,
+                                               DEVIO_loop_ioctl, DEVIO_loop_poll);
+      if ( DEVIO_loop_drv[i] == (unsigned int)-1 )
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - DEVIO loop driver install failed" IFXOS_CRLF));
+
+         (void)DEVIO_loop_driver_remove();
+         return IFX_ERROR;
+      }
+
+      DEVIO_driver_batch_set(DEVIO_loop_drv[i], NULL, NULL, DEVIO_loop_ioctl_batch);
+      if ( i == DEVIO_LOOP_DRV_NOTIFY )
+      {
+         DEVIO_driver_notify_enable(DEVIO_loop_drv[i]);
+      }
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Device IO loopback - Remove the loopback driver.
+*/
+IFX_int32_t DEVIO_loop_driver_remove ( void )
+{
+   unsigned int i;
+   IFX_int32_t nRet = IFX_SUCCESS;
+
+   for ( i = 0; i < 2; i++ )
+   {
+      if ( DEVIO_loop_drv[i] != (unsigned int)-1 )
+      {
+         /* refused - keep the handle, the driver is still installed */
+         if ( DEVIO_driver_remove(DEVIO_loop_drv[i], 0) != 0 )
+         {
+            nRet = IFX_ERROR;
+            continue;
+         }
+         DEVIO_loop_drv[i] = (unsigned int)-1;
+      }
+   }
+
+   return nRet;
+}
+
+/**
+   Device IO loopback - Add a loopback device.
+*/
+DEVIO_loop_dev_t *DEVIO_loop_device_add ( const char *name, const DEVIO_loop_cfg_t *pCfg )
+{
+   DEVIO_loop_dev_t *pDev;
+   unsigned int drv_no;
+
+   if ( ( name == IFX_NULL ) || ( pCfg == IFX_NULL ) )
+   {
+      return IFX_NULL;
+   }
+
+   drv_no = DEVIO_loop_drv[ ( pCfg->notify ) ? DEVIO_LOOP_DRV_NOTIFY : DEVIO_LOOP_DRV_POLL ];
+   if ( drv_no == (unsigned int)-1 )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO loop device <%s> add, driver not installed" IFXOS_CRLF,
+           name));
+
+      return IFX_NULL;
+   }
+
+   pDev = (DEVIO_loop_dev_t *)IFXOS_MemAlloc(sizeof(DEVIO_loop_dev_t) + pCfg->buf_size);
+   if ( pDev == IFX_NULL )
+   {
+      return IFX_NULL;
+   }
+   memset(pDev, 0x00, sizeof(DEVIO_loop_dev_t));
+
+   pDev->cfg  = *pCfg;
+   pDev->pBuf = ( pCfg->buf_size > 0 ) ? (IFX_uint8_t *)(pDev + 1) : IFX_NULL;
+
+   if ( IFXOS_MutexInit(&pDev->mutex) != IFX_SUCCESS )
+   {
+      IFXOS_MemFree(pDev);
+      return IFX_NULL;
+   }
+
+   if ( DEVIO_device_add(pDev, name, drv_no) != 0 )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO loop device <%s> add failed" IFXOS_CRLF, name));
+
+      IFXOS_MutexDelete(&pDev->mutex);
+      IFXOS_MemFree(pDev);
+      return IFX_NULL;
+   }
+
+   return pDev;
+}
+
+/**
+   Device IO loopback - Delete a loopback device.
+*/
+void DEVIO_loop_device_delete ( DEVIO_loop_dev_t *pDev )
+{
+   if ( pDev == IFX_NULL )
+   {
+      return;
+   }
+
+   DEVIO_device_delete(pDev);
+   IFXOS_MutexDelete(&pDev->mutex);
+   IFXOS_MemFree(pDev);
+}
+
+/* ============================================================================
+   Device IO loopback - Benchmark
+   ========================================================================= */
+
+/**
+   Benchmark - thread function.
+*/
+static IFX_int32_t DEVIO_benchmark_thread ( IFXOS_ThreadParams_t *pThrParams )
+{
+   DEVIO_benchmark_thr_t   *pThr   = (DEVIO_benchmark_thr_t *)pThrParams->nArg1;
+   DEVIO_benchmark_t       *pBench = pThr->pBench;
+   DEVIO_ioctl_cmd_t       cmds[DEVIO_BENCHMARK_BATCH_SIZE];
+   IFX_uint8_t             data[DEVIO_BENCHMARK_DATA_SIZE];
+   IFX_time_t              startTime_ms;
+   unsigned int            loop, i;
+   int                     fd = -1;
+
+   memset(data, 0x00, sizeof(data));
+   for ( i = 0; i < DEVIO_BENCHMARK_BATCH_SIZE; i++ )
+   {
+      cmds[i].cmd   = DEVIO_LOOP_IOCTL_ECHO;
+      cmds[i].param = i;
+   }
+
+   if ( pBench->op != DEVIO_BENCHMARK_OP_OPEN_CLOSE )
+   {
+      fd = DEVIO_open(pBench->pDevName);
+      if ( fd < 0 )
+      {
+         pThr->nFails = pBench->nLoops;
+         return IFX_ERROR;
+      }
+   }
+
+   while ( pBench->bStart == IFX_FALSE )
+   {
+      IFXOS_MSecSleep(1);
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+   for ( loop = 0; loop < pBench->nLoops; loop++ )
+   {
+      switch ( pBench->op )
+      {
+         case DEVIO_BENCHMARK_OP_OPEN_CLOSE:
+            fd = DEVIO_open(pBench->pDevName);
+            if ( ( fd < 0 ) || ( DEVIO_close(fd) < 0 ) )
+               pThr->nFails++;
+            break;
+
+         case DEVIO_BENCHMARK_OP_WRITE:
+            if ( DEVIO_write(fd, data, sizeof(data)) != (int)sizeof(data) )
+               pThr->nFails++;
+            break;
+
+         case DEVIO_BENCHMARK_OP_READ:
+            if ( DEVIO_read(fd, data, sizeof(data)) != (int)sizeof(data) )
+               pThr->nFails++;
+            break;
+
+         case DEVIO_BENCHMARK_OP_IOCTL:
+            if ( DEVIO_ioctl(fd, DEVIO_LOOP_IOCTL_ECHO, loop) != (int)loop )
+               pThr->nFails++;
+            break;
+
+         default:
+            if ( DEVIO_ioctl_batch(fd, cmds, DEVIO_BENCHMARK_BATCH_SIZE) != DEVIO_BENCHMARK_BATCH_SIZE )
+               pThr->nFails++;
+            break;
+      }
+   }
+
+   pThr->time_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+
+   if ( pBench->op != DEVIO_BENCHMARK_OP_OPEN_CLOSE )
+   {
+      (void)DEVIO_close(fd);
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Benchmark - run the threads for one operation and print the result.
+*/
+static IFX_int32_t DEVIO_benchmark_run (
+                        const char           *pName,
+                        const char           *pDevName,
+                        const unsigned int   op,
+                        const unsigned int   nThreads,
+                        const unsigned int   nLoops )
+{
+   DEVIO_benchmark_t       bench;
+   DEVIO_benchmark_thr_t   *pThr;
+   unsigned int            i, nStarted = 0, nFails = 0, nOps;
+   IFX_time_t              maxTime_ms = 0;
+   IFX_int32_t             retVal = IFX_SUCCESS;
+
+   pThr = (DEVIO_benchmark_thr_t *)IFXOS_MemAlloc(sizeof(DEVIO_benchmark_thr_t) * nThreads);
+   if ( pThr == IFX_NULL )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO Benchmark, no memory for %u threads" IFXOS_CRLF, nThreads));
+
+      return IFX_ERROR;
+   }
+   memset(pThr, 0x00, sizeof(DEVIO_benchmark_thr_t) * nThreads);
+
+   bench.pDevName = pDevName;
+   bench.op       = op;
+   bench.nLoops   = nLoops;
+   bench.bStart   = IFX_FALSE;
+
+   for ( i = 0; i < nThreads; i++ )
+   {
+      pThr[i].pBench = &bench;
+      if ( IFXOS_ThreadInit(&pThr[i].thrCntrl, "deviobm",
+                            DEVIO_benchmark_thread,
+                            IFXOS_DEFAULT_STACK_SIZE, 0,
+                            (IFX_ulong_t)&pThr[i], 0) != IFX_SUCCESS )
+      {
+         retVal = IFX_ERROR;
+         break;
+      }
+      nStarted++;
+   }
+
+   bench.bStart = IFX_TRUE;
+
+   for ( i = 0; i < nStarted; i++ )
+   {
+      if ( IFXOS_ThreadDelete(&pThr[i].thrCntrl, DEVIO_BENCHMARK_WAIT_MS) != IFX_SUCCESS )
+      {
+         retVal = IFX_ERROR;
+      }
+   }
+
+   if ( retVal == IFX_SUCCESS )
+   {
+      for ( i = 0; i < nThreads; i++ )
+      {
+         if ( pThr[i].time_ms > maxTime_ms )
+            maxTime_ms = pThr[i].time_ms;
+         nFails += pThr[i].nFails;
+      }
+
+      nOps = ( op == DEVIO_BENCHMARK_OP_IOCTL_BATCH ) ?
+                  nLoops * DEVIO_BENCHMARK_BATCH_SIZE : nLoops;
+
+      IFXOS_DBG_PRINT_USR(
+         "DEVIO Benchmark - %-13s: %u threads x %u ops, %u ms (%u ops per ms), fails %u" IFXOS_CRLF,
+         pName, nThreads, nOps, (IFX_uint32_t)maxTime_ms,
+         (maxTime_ms > 0) ?
+            (IFX_uint32_t)(((IFX_ulong_t)nThreads * nOps) / maxTime_ms) : 0,
+         nFails);
+   }
+   else
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO Benchmark, %s run failed (%u of %u threads started)" IFXOS_CRLF,
+           pName, nStarted, nThreads));
+   }
+
+   IFXOS_MemFree(pThr);
+
+   return retVal;
+}
+
+/**
+   Benchmark - ping thread, returns the data of the ping device to the pong
+   device.
+*/
+static IFX_int32_t DEVIO_benchmark_pong_thread ( IFXOS_ThreadParams_t *pThrParams )
+{
+   int            fd_ping = (int)pThrParams->nArg1;
+   int            fd_pong = (int)pThrParams->nArg2;
+   DEVIO_fd_set_t fds_in, fds_out;
+   IFX_uint8_t    data;
+
+   DEVIO_fd_zero(&fds_in);
+   DEVIO_fd_set((unsigned int)fd_ping, &fds_in);
+
+   while ( pThrParams->bShutDown == IFX_FALSE )
+   {
+      if ( DEVIO_select((unsigned int)fd_ping + 1, &fds_in, &fds_out, 100) <= 0 )
+         continue;
+
+      if ( DEVIO_read(fd_ping, &data, 1) == 1 )
+         (void)DEVIO_write(fd_pong, &data, 1);
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Benchmark - DEVIO_select() wakeup latency, measured as round trip
+   between two threads (two wakeups per loop).
+*/
+static IFX_int32_t DEVIO_benchmark_wakeup ( const unsigned int nLoops )
+{
+   DEVIO_loop_cfg_t     cfg;
+   DEVIO_loop_dev_t     *pPing, *pPong;
+   IFXOS_ThreadCtrl_t   thrCntrl;
+   DEVIO_fd_set_t       fds_in, fds_out;
+   IFX_time_t           startTime_ms, time_ms;
+   IFX_uint8_t          data = 0;
+   unsigned int         loop, nFails = 0;
+   int                  fd_ping, fd_pong;
+   IFX_int32_t          retVal = IFX_ERROR;
+
+   memset(&thrCntrl, 0x00, sizeof(thrCntrl));
+   memset(&cfg, 0x00, sizeof(cfg));
+   cfg.buf_size   = 16;
+   cfg.ready_mode = DEVIO_LOOP_READY_DATA;
+   cfg.notify     = 1;
+
+   pPing = DEVIO_loop_device_add("/dev/devio_bm_ping", &cfg);
+   pPong = DEVIO_loop_device_add("/dev/devio_bm_pong", &cfg);
+   fd_ping = DEVIO_open("/dev/devio_bm_ping");
+   fd_pong = DEVIO_open("/dev/devio_bm_pong");
+
+   if ( ( pPing != IFX_NULL ) && ( pPong != IFX_NULL ) && ( fd_ping >= 0 ) && ( fd_pong >= 0 ) &&
+        ( IFXOS_ThreadInit(&thrCntrl, "deviobm", DEVIO_benchmark_pong_thread,
+                           IFXOS_DEFAULT_STACK_SIZE, 0,
+                           (IFX_ulong_t)fd_ping, (IFX_ulong_t)fd_pong) == IFX_SUCCESS ) )
+   {
+      DEVIO_fd_zero(&fds_in);
+      DEVIO_fd_set((unsigned int)fd_pong, &fds_in);
+
+      startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+      for ( loop = 0; loop < nLoops; loop++ )
+      {
+         data = (IFX_uint8_t)loop;
+         if ( ( DEVIO_write(fd_ping, &data, 1) != 1 ) ||
+              ( DEVIO_select((unsigned int)fd_pong + 1, &fds_in, &fds_out, 1000) <= 0 ) ||
+              ( DEVIO_read(fd_pong, &data, 1) != 1 ) )
+         {
+            nFails++;
+         }
+      }
+
+      time_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+
+      IFXOS_DBG_PRINT_USR(
+         "DEVIO Benchmark - %-13s: %u round trips, %u ms (%u us per wakeup), fails %u" IFXOS_CRLF,
+         "select wakeup", nLoops, (IFX_uint32_t)time_ms,
+         (IFX_uint32_t)(((IFX_ulong_t)time_ms * 1000) / (2 * nLoops)), nFails);
+
+      retVal = IFXOS_ThreadDelete(&thrCntrl, DEVIO_BENCHMARK_WAIT_MS);
+   }
+   else
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO Benchmark, select wakeup setup failed" IFXOS_CRLF));
+   }
+
+   if ( fd_ping >= 0 )
+      (void)DEVIO_close(fd_ping);
+   if ( fd_pong >= 0 )
+      (void)DEVIO_close(fd_pong);
+   DEVIO_loop_device_delete(pPing);
+   DEVIO_loop_device_delete(pPong);
+
+   return retVal;
+}
+
+/**
+   Device IO loopback - Benchmark.
+*/
+IFX_int32_t DEVIO_benchmark ( const unsigned int nThreads, const unsigned int nLoops )
+{
+   DEVIO_loop_cfg_t  cfg;
+   DEVIO_loop_dev_t  *pNull;
+   IFX_int32_t       retVal = IFX_SUCCESS;
+
+   if ( ( nThreads == 0 ) || ( nLoops == 0 ) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - DEVIO Benchmark, invalid args" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   if ( DEVIO_loop_driver_install() != IFX_SUCCESS )
+   {
+      return IFX_ERROR;
+   }
+
+   memset(&cfg, 0x00, sizeof(cfg));
+   cfg.ready_mode = DEVIO_LOOP_READY_ALWAYS;
+
+   pNull = DEVIO_loop_device_add("/dev/devio_bm_null", &cfg);
+   if ( pNull == IFX_NULL )
+   {
+      return IFX_ERROR;
+   }
+
+   if ( ( DEVIO_benchmark_run("open/close", "/dev/devio_bm_null",
+                              DEVIO_BENCHMARK_OP_OPEN_CLOSE, nThreads, nLoops) != IFX_SUCCESS ) ||
+        ( DEVIO_benchmark_run("write", "/dev/devio_bm_null",
+                              DEVIO_BENCHMARK_OP_WRITE, nThreads, nLoops) != IFX_SUCCESS ) ||
+        ( DEVIO_benchmark_run("read", "/dev/devio_bm_null",
+                              DEVIO_BENCHMARK_OP_READ, nThreads, nLoops) != IFX_SUCCESS ) ||
+        ( DEVIO_benchmark_run("ioctl", "/dev/devio_bm_null",
+                              DEVIO_BENCHMARK_OP_IOCTL, nThreads, nLoops) != IFX_SUCCESS ) ||
+        ( DEVIO_benchmark_run("ioctl batch", "/dev/devio_bm_null",
+                              DEVIO_BENCHMARK_OP_IOCTL_BATCH, nThreads, nLoops) != IFX_SUCCESS ) ||
+        ( DEVIO_benchmark_wakeup(nLoops) != IFX_SUCCESS ) )
+   {
+      retVal = IFX_ERROR;
+   }
+
+   DEVIO_loop_device_delete(pNull);
+
+   return retVal;
+}
+
+#endif      /* #if (defined(DEVIO_HAVE_LOOP_DRIVER) && (DEVIO_HAVE_LOOP_DRIVER == 1)) */
+
+#endif      /* #if (defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1)) */
@@ -22,6 +22,7 @@
    Includes
    =========================== */
 #include "ifx_types.h"
+#include "ifxos_memory_alloc.h"
 
 /* ===========================
    Defines
@@ -40,6 +41,13 @@ IFX_int32_t GetKeyString(const IFX_char_t* pSectionName, const IFX_char_t* pKeyN
 IFX_int32_t GetKeyInt(const IFX_char_t* pSectionName, const IFX_char_t* pKeyName, IFX_int32_t nDefault, const IFX_char_t* pFile);
 IFX_int32_t GetSection(const IFX_char_t *pSection, IFX_char_t *pBuffer, IFX_int32_t nBufferSize, const IFX_char_t* filein);
 
+#if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) )
+/* same as above, the temporary line buffer is taken from the given arena */
+IFX_int32_t GetKeyStringArena(IFXOS_Arena_t *pArena, const IFX_char_t* pSectionName, const IFX_char_t* pKeyName, const IFX_char_t* pDefault, IFX_char_t* pRetString, IFX_int32_t nSize, const IFX_char_t* pFile);
+IFX_int32_t GetKeyIntArena(IFXOS_Arena_t *pArena, const IFX_char_t* pSectionName, const IFX_char_t* pKeyName, IFX_int32_t nDefault, const IFX_char_t* pFile);
+IFX_int32_t GetSectionArena(IFXOS_Arena_t *pArena, const IFX_char_t *pSection, IFX_char_t *pBuffer, IFX_int32_t nBufferSize, const IFX_char_t* filein);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
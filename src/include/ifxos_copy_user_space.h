@@ -41,6 +41,17 @@
    IFX OS adaptation - Global Includes
    ========================================================================= */
 #include "ifx_types.h"
+#include "ifxos_memory_alloc.h"
+
+#if ( !defined(IFXOS_FLAT_HIRACHY) || (IFXOS_FLAT_HIRACHY == 0) )
+#  if defined(LINUX)
+#     include "linux/ifxos_linux_copy_user_space.h"
+#  endif
+#else
+#  if defined(LINUX)
+#     include "ifxos_linux_copy_user_space.h"
+#  endif
+#endif
 
 /* ============================================================================
    IFX OS adaptation - copy between user and driver space.
@@ -94,6 +105,227 @@ IFX_void_t *IFXOS_CpyToUser(
                const IFX_void_t  *pFrom,
                IFX_uint32_t      size_byte);
 
+#if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) )
+
+/**
+   Copy a fixed size object (struct) FROM USER space, for example the
+   argument of an ioctl. The size is known at compile time, so the copy
+   can be done inline.
+
+\param
+   pTo      Points to the object (in driver space), the object size is copied.
+\param
+   pFrom    Points to the source (in user space).
+
+\return
+   IFX_SUCCESS if the object has been copied, else IFX_ERROR.
+*/
+#define IFXOS_CpyFromUserStruct(pTo, pFrom) \
+            IFXOS_CPY_FROM_USER_FIXED((pTo), (pFrom), sizeof(*(pTo)))
+
+/**
+   Copy a fixed size object (struct) TO USER space.
+
+\param
+   pTo      Points to the destination (in user space).
+\param
+   pFrom    Points to the object (in driver space), the object size is copied.
+
+\return
+   IFX_SUCCESS if the object has been copied, else IFX_ERROR.
+*/
+#define IFXOS_CpyToUserStruct(pTo, pFrom) \
+            IFXOS_CPY_TO_USER_FIXED((pTo), (pFrom), sizeof(*(pFrom)))
+
+/**
+   Vectored copy - single block.
+*/
+typedef struct
+{
+   /** block within driver space */
+   IFX_void_t     *pDrv;
+   /** block within user space */
+   IFX_void_t     *pUser;
+   /** block size [byte], 0: the entry is skipped */
+   IFX_uint32_t   size_byte;
+} IFXOS_CpyUserVec_t;
+
+/**
+   Copy a set of blocks FROM USER space (application) to driver space (kernel).
+   The user blocks are validated once for the whole set, blocks which are
+   contiguous in user and driver space are copied at once.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyFromUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec);
+
+/**
+   Copy a set of blocks from driver space (kernel) TO USER space (application).
+   The user blocks are validated once for the whole set, blocks which are
+   contiguous in user and driver space are copied at once.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyToUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec);
+
+#endif
+
+#if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH) && (IFXOS_HAVE_DEV_CTRL_BATCH == 1) )
+
+/** Device control batch - ioctl magic of the batch command */
+#ifndef IFXOS_DEV_CTRL_BATCH_MAGIC
+#  define IFXOS_DEV_CTRL_BATCH_MAGIC         0xF9
+#endif
+
+/** Device control batch - max number of commands per batch command,
+    larger batches are split by the application side */
+#ifndef IFXOS_DEV_CTRL_BATCH_MAX_CMDS
+#  define IFXOS_DEV_CTRL_BATCH_MAX_CMDS      1024
+#endif
+
+/**
+   Device control batch - ioctl command (multiplexed), the argument points to
+   a \ref IFXOS_DevCtrlBatch_t. The driver returns the number of executed
+   commands, see \ref IFXOS_DevCtrlBatchExec.
+
+\remark
+   The command is expanded at the point of use, there the ioctl definitions
+   of the OS are required.
+*/
+#define IFXOS_DEV_CTRL_BATCH_CMD \
+            _IOWR(IFXOS_DEV_CTRL_BATCH_MAGIC, 0x01, IFXOS_DevCtrlBatch_t)
+
+/**
+   Device control batch - capability query (ioctl command), the argument
+   points to a \ref IFXOS_DevCtrlBatchCaps_t. A driver which supports
+   \ref IFXOS_DEV_CTRL_BATCH_CMD answers via \ref IFXOS_DevCtrlBatchCaps.
+   The batch command is only sent to a driver which has answered the query.
+*/
+#define IFXOS_DEV_CTRL_BATCH_CAPS_CMD \
+            _IOR(IFXOS_DEV_CTRL_BATCH_MAGIC, 0x02, IFXOS_DevCtrlBatchCaps_t)
+
+/** Device control batch - capability query, identification of a driver
+    with batch support ("BTCH") */
+#define IFXOS_DEV_CTRL_BATCH_CAPS_ID         0x42544348
+
+/**
+   Device control batch - single command.
+*/
+typedef struct
+{
+   /** device command */
+   IFX_uint32_t   devCmd;
+   /** command parameter */
+   IFX_ulong_t    param;
+} IFXOS_DevCtrlCmd_t;
+
+/**
+   Device control batch - argument of the batch command.
+*/
+typedef struct
+{
+   /** commands (in user space) */
+   const IFXOS_DevCtrlCmd_t   *pCmds;
+   /** results of the commands (in user space) */
+   IFX_int32_t                *pResults;
+   /** number of commands, max IFXOS_DEV_CTRL_BATCH_MAX_CMDS */
+   IFX_uint32_t               nCmds;
+} IFXOS_DevCtrlBatch_t;
+
+/**
+   Device control batch - capabilities of the driver.
+*/
+typedef struct
+{
+   /** identification, IFXOS_DEV_CTRL_BATCH_CAPS_ID */
+   IFX_uint32_t               id;
+   /** max number of commands per batch command */
+   IFX_uint32_t               maxCmds;
+} IFXOS_DevCtrlBatchCaps_t;
+
+#endif      /* #if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH) && (IFXOS_HAVE_DEV_CTRL_BATCH == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH_EXEC) && (IFXOS_HAVE_DEV_CTRL_BATCH_EXEC == 1) )
+
+/**
+   Device control batch - driver control function, executes a single command.
+
+\param
+   pCtx     driver context given with \ref IFXOS_DevCtrlBatchExec.
+\param
+   devCmd   device command.
+\param
+   param    command parameter.
+
+\return
+   Result of the command (negative value: error).
+*/
+typedef IFX_int32_t (*IFXOS_DevCtrlFct_t)(
+               IFX_void_t     *pCtx,
+               IFX_uint32_t   devCmd,
+               IFX_ulong_t    param);
+
+/**
+   Execute a device control batch, to be called by the driver on
+   \ref IFXOS_DEV_CTRL_BATCH_CMD.
+
+   The commands are copied FROM USER space at once, executed via the given
+   control function up to the first negative result, and the results are
+   copied TO USER space at once.
+
+\param
+   arg         ioctl argument, points to the \ref IFXOS_DevCtrlBatch_t
+               (in user space).
+\param
+   pCtrlFct    driver control function.
+\param
+   pCtx        driver context, passed to the control function.
+
+\return
+   Number of executed commands (the last one failed if the execution stopped
+   before the end of the batch), else
+   IFX_ERROR   in case of a copy or memory error.
+*/
+IFX_int32_t IFXOS_DevCtrlBatchExec(
+               IFX_ulong_t          arg,
+               IFXOS_DevCtrlFct_t   pCtrlFct,
+               IFX_void_t           *pCtx);
+
+/**
+   Answer the device control batch capability query, to be called by the
+   driver on \ref IFXOS_DEV_CTRL_BATCH_CAPS_CMD.
+
+\param
+   arg         ioctl argument, points to the \ref IFXOS_DevCtrlBatchCaps_t
+               (in user space).
+
+\return
+   IFX_SUCCESS capabilities returned.
+   IFX_ERROR   in case of a copy error.
+*/
+IFX_int32_t IFXOS_DevCtrlBatchCaps(
+               IFX_ulong_t          arg);
+
+#endif      /* #if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH_EXEC) && (IFXOS_HAVE_DEV_CTRL_BATCH_EXEC == 1) ) */
+
 /** @} */
 
 #ifdef __cplusplus
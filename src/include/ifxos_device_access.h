@@ -77,6 +77,14 @@
 
 #include "ifx_types.h"
 
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) )
+#  include "ifxos_copy_user_space.h"
+#endif
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING) && (IFXOS_HAVE_DEVICE_ACCESS_SHM_RING == 1) )
+#  include "ifxos_memory_map.h"
+#endif
+
 /* ============================================================================
    IFX OS adaptation - Device Access
    ========================================================================= */
@@ -256,6 +264,226 @@ IFX_void_t IFXOS_DevFdZero(
 #endif /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SELECT) &&
 (IFXOS_HAVE_DEVICE_ACCESS_SELECT == 1) ) */
 
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) )
+
+/**
+   Control a device with a set of commands.
+
+   If the driver answers the capability query \ref IFXOS_DEV_CTRL_BATCH_CAPS_CMD
+   (Linux: cached per descriptor, reset by IFXOS_DeviceOpen / IFXOS_DeviceClose),
+   the commands are passed via \ref IFXOS_DEV_CTRL_BATCH_CMD with a single
+   system call (per IFXOS_DEV_CTRL_BATCH_MAX_CMDS commands), else each
+   command is executed via \ref IFXOS_DeviceControl.
+
+\param
+   devFd       device file descriptor.
+\param
+   pCmds       commands to execute.
+\param
+   nCmds       number of commands.
+\param
+   pResults    returns the result of each executed command.
+
+\return
+   Number of successful commands, the execution stops on the first command
+   with a negative result (its result is returned within pResults).
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DeviceControlBatch(
+               const IFX_int32_t          devFd,
+               const IFXOS_DevCtrlCmd_t   *pCmds,
+               const IFX_uint32_t         nCmds,
+               IFX_int32_t                *pResults);
+
+#endif /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) &&
+(IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING) && (IFXOS_HAVE_DEVICE_ACCESS_SHM_RING == 1) )
+
+/**
+   Map a shared ring of a driver (see \ref IFXOS_DrvShmRingCreate).
+
+   The records are exchanged in place (see \ref IFXOS_ShmRingPeek,
+   \ref IFXOS_ShmRingReserve), without a copy and without a system call as
+   long as the ring is not empty.
+
+\param
+   devFd          device file descriptor.
+\param
+   offset         mmap offset, page aligned (driver specific ring selection).
+\param
+   memSize_byte   size of the ring memory (header and data area).
+\param
+   pRing          returns the ring handle.
+
+\return
+   IFX_SUCCESS ring mapped.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingMap(
+               const IFX_int32_t    devFd,
+               const IFX_ulong_t    offset,
+               const IFX_uint32_t   memSize_byte,
+               IFXOS_ShmRing_t      *pRing);
+
+/**
+   Unmap a shared ring.
+
+\param
+   pRing    ring handle, see \ref IFXOS_DeviceShmRingMap.
+
+\return
+   IFX_SUCCESS ring unmapped.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingUnmap(
+               IFXOS_ShmRing_t      *pRing);
+
+/**
+   Wait for a record of a shared ring (consumer).
+
+   A system call is only done if the ring is empty, the driver signals
+   the next record via \ref IFXOS_DrvSelectQueueWakeUp, its poll reports
+   the device readable if the ring is not empty.
+
+\param
+   devFd       device file descriptor.
+\param
+   pRing       ring handle, see \ref IFXOS_DeviceShmRingMap.
+\param
+   timeout_ms  max time to wait [ms] (IFXOS_WAIT_FOREVER).
+
+\return
+   1  records available.
+   0  timeout.
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingWait(
+               const IFX_int32_t    devFd,
+               IFXOS_ShmRing_t      *pRing,
+               const IFX_uint32_t   timeout_ms);
+
+#endif /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING) &&
+(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) && (IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) )
+
+/** Poll set event - device ready for reading */
+#define IFXOS_DEVPOLL_IN               0x00000001
+/** Poll set event - device ready for writing */
+#define IFXOS_DEVPOLL_OUT              0x00000002
+/** Poll set event - error condition on the device */
+#define IFXOS_DEVPOLL_ERR              0x00000004
+
+/**
+   Poll set - ready device, returned by \ref IFXOS_DevPollWait.
+*/
+typedef struct
+{
+   /** ready device file descriptor */
+   IFX_int32_t    devFd;
+   /** ready events (IFXOS_DEVPOLL_xxx) */
+   IFX_uint32_t   events;
+   /** user data given with \ref IFXOS_DevPollAdd */
+   IFX_void_t     *pUser;
+} IFXOS_DevPollEvent_t;
+
+/**
+   Create a poll set.
+
+   In contrast to \ref IFXOS_DeviceSelect the devices are registered once and
+   the wait returns only the ready devices, the cost of a wait does not grow
+   with the number of registered devices.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set created.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollCreate(
+               IFXOS_devPoll_t *pDevPoll);
+
+/**
+   Delete a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set deleted.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollDelete(
+               IFXOS_devPoll_t *pDevPoll);
+
+/**
+   Add a device to a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+\param
+   events      events to wait for (IFXOS_DEVPOLL_xxx).
+\param
+   pUser       user data, returned with the ready device.
+
+\return
+   IFX_SUCCESS device added.
+   IFX_ERROR   in case of error (also if already added).
+*/
+IFX_int32_t IFXOS_DevPollAdd(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd,
+               const IFX_uint32_t   events,
+               IFX_void_t           *pUser);
+
+/**
+   Remove a device from a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+
+\return
+   IFX_SUCCESS device removed.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollRemove(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd);
+
+/**
+   Wait for ready devices of a poll set (level triggered).
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   pEvents     returns the ready devices.
+\param
+   maxEvents   max number of entries of pEvents.
+\param
+   timeout_ms  max time to wait [ms] (IFXOS_WAIT_FOREVER, 0: no wait).
+
+\return
+   Number of ready devices (0: timeout).
+   -1 in case of error.
+
+\remark
+   Only one wait per poll set is allowed at a time.
+*/
+IFX_int32_t IFXOS_DevPollWait(
+               IFXOS_devPoll_t      *pDevPoll,
+               IFXOS_DevPollEvent_t *pEvents,
+               const IFX_uint32_t   maxEvents,
+               const IFX_uint32_t   timeout_ms);
+
+#endif /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) &&
+(IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) ) */
+
 
 /** @} */
 
@@ -15,6 +15,9 @@ extern "C" {
 #endif
 
 #include "ifx_types.h"
+#include "ifxos_mutex.h"
+#include "ifxos_event.h"
+#include "ifxos_thread.h"
 
 #if (defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1))
 /*!
@@ -32,27 +35,68 @@ extern "C" {
 #define DEVIO_MAXDEVNAME       (64)
 #endif
 
-/** Maximum number of drivers supported by LIB_IO extension. */
+/** Obsolete - the driver table grows on demand, kept for compatibility. */
 #ifndef DEVIO_MAXDRIVERS
 #define DEVIO_MAXDRIVERS       (6)
 #endif
 
-/** Maximum number of devices supported by LIB_IO extension. */
+/** Obsolete - the device table grows on demand, kept for compatibility. */
 #ifndef DEVIO_MAXDEVICES
 #define DEVIO_MAXDEVICES       (200)
 #endif
 
-/** Maximum number of device descriptors supported by LIB_IO extension. */
+/** Lock-free descriptor dispatch of DEVIO_read(), DEVIO_write() and
+    DEVIO_ioctl() (GCC __atomic builtins), else the table mutex is taken. */
+#ifndef DEVIO_LOCKFREE_DISPATCH
+#  if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+#     define DEVIO_LOCKFREE_DISPATCH (1)
+#  else
+#     define DEVIO_LOCKFREE_DISPATCH (0)
+#  endif
+#endif
+
+/** Number of hash buckets of the device name index (power of 2). */
+#ifndef DEVIO_DEVNAME_HASH_SIZE
+#define DEVIO_DEVNAME_HASH_SIZE  (256)
+#endif
+
+/** Number of table index bits of a device descriptor, the upper bits keep
+    the generation of the entry (stale descriptors are rejected). The tables
+    grow on demand up to (1 << DEVIO_FD_INDEX_BITS) entries. */
+#ifndef DEVIO_FD_INDEX_BITS
+#define DEVIO_FD_INDEX_BITS    (16)
+#endif
+
+/** Size of the descriptor set, DEVIO_select() handles the descriptors with
+    a table index less then DEVIO_MAXFDS. A descriptor with a higher table
+    index is refused by DEVIO_fd_set() and fails the DEVIO_select(). */
 #ifndef DEVIO_MAXFDS
 #define DEVIO_MAXFDS           (300)
 #endif
 
 
-/** Polling time (msec) for DEVIO_select() implementation. */
+/** Polling time (msec) for DEVIO_select() implementation, used for the devices
+    of drivers which do not signal the readiness via DEVIO_device_notify(). */
 #ifndef DEVIO_SELECT_POLLING_TIME
 #define DEVIO_SELECT_POLLING_TIME 	(100)
 #endif
 
+/** Number of hash buckets of the poll set index (power of 2), used by
+    DEVIO_device_notify() to find the poll set entries of an instance. */
+#ifndef DEVIO_POLL_HASH_SIZE
+#define DEVIO_POLL_HASH_SIZE        (64)
+#endif
+
+/** Idle wait time (msec) of the asynchronous worker threads. */
+#ifndef DEVIO_ASYNC_IDLE_WAIT_MS
+#define DEVIO_ASYNC_IDLE_WAIT_MS    (1000)
+#endif
+
+/** Wait time (msec) for the end of an asynchronous worker thread. */
+#ifndef DEVIO_ASYNC_THREAD_DELETE_WAIT_MS
+#define DEVIO_ASYNC_THREAD_DELETE_WAIT_MS (3000)
+#endif
+
 /** @} */
 
 /* ============================================================================
@@ -79,6 +123,47 @@ typedef IFX_int_t ( *DEVIO_device_write ) ( void *pprivate, const IFX_char_t *bu
 /** Driver poll interface. */
 typedef IFX_int_t ( *DEVIO_device_poll ) ( void *pprivate );
 
+/** Buffer of a vectored read / write. */
+typedef struct
+{
+   /** buffer */
+   void           *iov_base;
+   /** buffer size [byte] */
+   unsigned int   iov_len;
+} DEVIO_iovec_t;
+
+/** Command of an ioctl batch. */
+typedef struct
+{
+   /** command to be executed */
+   unsigned int   cmd;
+   /** optional parameter */
+   IFX_ulong_t    param;
+   /** result of the command (device specific) */
+   IFX_int_t      ret;
+} DEVIO_ioctl_cmd_t;
+
+/** Driver vectored read interface, returns the number of read bytes
+    (stops on a short read) or a negative value. */
+typedef IFX_int_t ( *DEVIO_device_readv ) ( void *pprivate, const DEVIO_iovec_t *iov, const IFX_uint_t iovcnt );
+
+/** Driver vectored write interface, returns the number of written bytes
+    (stops on a short write) or a negative value. */
+typedef IFX_int_t ( *DEVIO_device_writev ) ( void *pprivate, const DEVIO_iovec_t *iov, const IFX_uint_t iovcnt );
+
+/** Driver ioctl batch interface, sets the result of each executed command
+    and returns the number of successful commands (stops on the first
+    negative result). */
+typedef IFX_int_t ( *DEVIO_device_ioctl_batch ) ( void *pprivate, DEVIO_ioctl_cmd_t *cmds, const IFX_uint_t num );
+
+/** Asynchronous operation, see DEVIO_async_submit(). */
+typedef struct DEVIO_async_op_s DEVIO_async_op_t;
+
+/** Driver asynchronous operation interface, starts the operation and returns
+    0 (the driver calls DEVIO_async_done() on completion) or a negative value
+    if the operation is not started. */
+typedef IFX_int_t ( *DEVIO_device_async ) ( void *pprivate, DEVIO_async_op_t *op );
+
 /** @} */
 
 /* ============================================================================
@@ -92,7 +177,7 @@ typedef IFX_int_t ( *DEVIO_device_poll ) ( void *pprivate );
 
    \return
    - -1 in case of error
-   - positive value less then DEVIO_MAXDRIVERS
+   - driver number (table index)
 */
 unsigned int DEVIO_driver_install(
 	DEVIO_device_open   device_open,
@@ -107,8 +192,16 @@ unsigned int DEVIO_driver_install(
 
    \param driver_num    driver number
    \param force         force operation even if the driver is used
+
+   \return
+   0 if the driver is removed, -1 if the remove is refused
+
+   \remark
+   Without force the driver is not removed while a device instance of it is
+   open. With force the open instances are detached, their calls fail. The
+   forced remove is refused while a call of an instance is running.
 */
-void DEVIO_driver_remove ( unsigned int driver_num, int force );
+int DEVIO_driver_remove ( unsigned int driver_num, int force );
 
 /**
    Add a device to the IO sub system.
@@ -126,6 +219,52 @@ IFX_uint_t DEVIO_device_add ( void *device, const char *name, unsigned int drive
 */
 void DEVIO_device_delete ( void *device );
 
+/**
+   Enable the readiness notification of a driver.
+   The driver signals the readiness of its devices via DEVIO_device_notify(),
+   so DEVIO_select() waits for its devices without polling.
+
+   \param driver_num    driver number
+*/
+void DEVIO_driver_notify_enable ( unsigned int driver_num );
+
+/**
+   Set the optional batch callbacks of a driver, a missing callback is
+   emulated by a loop over the single call (read, write, ioctl).
+   The callbacks are taken by the following DEVIO_open() calls.
+
+   \param driver_num    driver number
+   \param device_readv  vectored read, may be NULL
+   \param device_writev vectored write, may be NULL
+   \param device_ioctl_batch  ioctl batch, may be NULL
+*/
+void DEVIO_driver_batch_set (
+   unsigned int               driver_num,
+   DEVIO_device_readv         device_readv,
+   DEVIO_device_writev        device_writev,
+   DEVIO_device_ioctl_batch   device_ioctl_batch );
+
+/**
+   Set the optional asynchronous operation callback of a driver, without
+   callback the asynchronous operations are executed by the worker threads
+   of the context (see DEVIO_async_ctx_init()).
+   The callback is taken by the following DEVIO_open() calls.
+
+   \param driver_num    driver number
+   \param device_async  asynchronous operation, may be NULL
+*/
+void DEVIO_driver_async_set (
+   unsigned int               driver_num,
+   DEVIO_device_async         device_async );
+
+/**
+   Signal the readiness of an open device instance, wakes up the
+   DEVIO_select() calls which wait for this instance.
+
+   \param pprivate      private data of the instance, returned by device_open
+*/
+void DEVIO_device_notify ( void *pprivate );
+
 /** @} */
 
 /* ============================================================================
@@ -141,7 +280,7 @@ void DEVIO_device_delete ( void *device );
 
    \return
    - -1 in case of a failure
-   - any other positive value less then DEVIO_MAXDEVICES
+   - any other positive value, the descriptor
 */
 IFX_int_t DEVIO_open ( const char *name );
 
@@ -188,6 +327,46 @@ IFX_int_t DEVIO_read ( const IFX_int_t fd, void *pData, const unsigned int nSize
 */
 IFX_int_t DEVIO_ioctl ( const IFX_int_t fd, const unsigned int cmd, IFX_ulong_t param );
 
+/**
+   Read from the specified device into several buffers (one dispatch).
+
+   \param fd      device descriptor, returned by DEVIO_open() call
+   \param iov     buffers
+   \param iovcnt  number of buffers
+
+   \return
+   - -1 in case of a failure
+   - number of read bytes, the buffers are filled in order
+*/
+IFX_int_t DEVIO_readv ( const IFX_int_t fd, const DEVIO_iovec_t *iov, const unsigned int iovcnt );
+
+/**
+   Write several buffers to the specified device (one dispatch).
+
+   \param fd      device descriptor, returned by DEVIO_open() call
+   \param iov     buffers
+   \param iovcnt  number of buffers
+
+   \return
+   - -1 in case of a failure
+   - number of written bytes
+*/
+IFX_int_t DEVIO_writev ( const IFX_int_t fd, const DEVIO_iovec_t *iov, const unsigned int iovcnt );
+
+/**
+   Execute several control commands on the specified device (one dispatch).
+
+   \param fd      device descriptor, returned by DEVIO_open() call
+   \param cmds    commands, returns the result of each executed command
+   \param num     number of commands
+
+   \return
+   - -1 in case of a failure
+   - number of successful commands, the execution stops on the first
+     command with a negative result
+*/
+IFX_int_t DEVIO_ioctl_batch ( const IFX_int_t fd, DEVIO_ioctl_cmd_t *cmds, const unsigned int num );
+
 /** @} */
 
 /* ============================================================================
@@ -202,10 +381,15 @@ IFX_int_t DEVIO_ioctl ( const IFX_int_t fd, const unsigned int cmd, IFX_ulong_t
 typedef struct
 {
    /**
-    * - set to 1 if device is marked
+    * - descriptor plus 1 if device is marked (at the table index)
     * - set to 0 if device is not selected
     */
    unsigned int fds[DEVIO_MAXFDS];
+   /**
+    * - set if a descriptor with a table index of DEVIO_MAXFDS or higher
+    *   has been refused, DEVIO_select() fails for this set
+    */
+   unsigned int overflow;
 } DEVIO_fd_set_t;
 
 /**
@@ -213,13 +397,21 @@ typedef struct
 
    \param fd   descriptor, returned by \ref DEVIO_open [I]
    \param set  pointer to the descriptor set [IO]
+
+   \return
+   0 if the descriptor is set, -1 if the table index of the descriptor is
+   out of the set range (DEVIO_MAXFDS), the set is marked as overflowed
 */
-void DEVIO_fd_set(const unsigned int  fd, DEVIO_fd_set_t *set);
+int DEVIO_fd_set(const unsigned int  fd, DEVIO_fd_set_t *set);
 
 /**
    Check if the descriptor in the set structure is enabled.
    \param fd   descriptor, returned by \ref DEVIO_open [I]
    \param set  pointer to the descriptor set [I]
+
+   \return
+   1 if the descriptor is set, else 0 (also for a descriptor out of the
+   set range, it is never set)
 */
 int DEVIO_fd_isset(const unsigned int  fd, const DEVIO_fd_set_t *set);
 
@@ -239,14 +431,354 @@ void DEVIO_fd_zero(DEVIO_fd_set_t *set);
 /**
 	Emulation of the select() call.
 
-	All devices marked in the read_fd_in structure will be polled. The polling
-	granularity is defined by DEVIO_SELECT_POLLING_TIME .
+	All devices marked in the read_fd_in structure will be polled. The call
+	sleeps up to a notification (see DEVIO_device_notify) or the timeout.
+	If a marked device belongs to a driver without notification support,
+	the polling granularity is defined by DEVIO_SELECT_POLLING_TIME .
+	The call fails (-1) if a descriptor has been refused by DEVIO_fd_set().
 */
 int DEVIO_select ( const unsigned int max_fd, const DEVIO_fd_set_t * read_fd_in,
                   DEVIO_fd_set_t * read_fd_out, const unsigned int timeout_msec );
 
 /** @} */
 
+/* ============================================================================
+   Device IO - Poll sets
+   ========================================================================= */
+/** \addtogroup DEVIO_DEVICE_IO_LAYER
+@{ */
+
+/** Poll set (opaque), see DEVIO_poll_create(). */
+typedef struct DEVIO_poll_set_s DEVIO_poll_set_t;
+
+/**
+   Ready descriptor, returned by DEVIO_poll_wait().
+*/
+typedef struct
+{
+   /** device descriptor */
+   IFX_int_t   fd;
+   /** user data, given by DEVIO_poll_add() */
+   void        *pUser;
+} DEVIO_poll_event_t;
+
+/**
+   Create a poll set. The descriptors are registered once, a wait checks
+   only the descriptors which have been signaled via DEVIO_device_notify()
+   (or which are still ready) and the descriptors of drivers without
+   notification support.
+
+   \return
+   - NULL in case of a failure
+   - poll set
+*/
+DEVIO_poll_set_t *DEVIO_poll_create ( void );
+
+/**
+   Delete a poll set, no DEVIO_poll_wait() call must be active.
+
+   \param set     poll set
+*/
+void DEVIO_poll_delete ( DEVIO_poll_set_t *set );
+
+/**
+   Add a descriptor to a poll set (readable).
+
+   \param set     poll set
+   \param fd      device descriptor, returned by DEVIO_open() call
+   \param pUser   user data, returned with the ready descriptor
+
+   \return
+   - 0 if the descriptor has been added
+   - -1 in case of a failure (invalid or already added descriptor)
+*/
+int DEVIO_poll_add ( DEVIO_poll_set_t *set, const int fd, void *pUser );
+
+/**
+   Remove a descriptor from a poll set, has to be done before the descriptor
+   is closed.
+
+   \param set     poll set
+   \param fd      device descriptor
+
+   \return
+   - 0 if the descriptor has been removed
+   - -1 in case of a failure (descriptor not added)
+*/
+int DEVIO_poll_remove ( DEVIO_poll_set_t *set, const int fd );
+
+/**
+   Wait for ready (readable) descriptors of a poll set, a descriptor is
+   returned as long as it is ready (level triggered).
+
+   \param set           poll set
+   \param events        returns the ready descriptors
+   \param max_events    size of the events array
+   \param timeout_msec  wait time in [msec]
+                        0: used for poll, returns immediately.
+                        -1 (0xFFFFFFFF): wait forever.
+
+   \return
+   - -1 in case of a failure
+   - number of ready descriptors, 0 on timeout
+*/
+int DEVIO_poll_wait ( DEVIO_poll_set_t *set, DEVIO_poll_event_t *events,
+                      const unsigned int max_events, const unsigned int timeout_msec );
+
+/** @} */
+
+/* ============================================================================
+   Device IO - Asynchronous operations
+   ========================================================================= */
+/** \addtogroup DEVIO_DEVICE_IO_LAYER
+@{ */
+
+/** Asynchronous operation - read (DEVIO_read) */
+#define DEVIO_ASYNC_OP_READ            0
+/** Asynchronous operation - write (DEVIO_write) */
+#define DEVIO_ASYNC_OP_WRITE           1
+/** Asynchronous operation - control (DEVIO_ioctl) */
+#define DEVIO_ASYNC_OP_IOCTL           2
+
+typedef struct DEVIO_async_ctx_s DEVIO_async_ctx_t;
+
+/**
+   Asynchronous operation, allocated by the caller and owned by the
+   context from DEVIO_async_submit() up to its return by DEVIO_async_wait().
+*/
+struct DEVIO_async_op_s
+{
+   /** device descriptor, returned by DEVIO_open() call */
+   IFX_int_t            fd;
+   /** operation, see DEVIO_ASYNC_OP_xxx */
+   unsigned int         op;
+   /** read / write - data pointer */
+   void                 *pData;
+   /** read / write - data size */
+   unsigned int         nSize;
+   /** ioctl - command to be executed */
+   unsigned int         cmd;
+   /** ioctl - optional parameter */
+   IFX_ulong_t          param;
+   /** user cookie, not used by the device IO layer */
+   void                 *cookie;
+   /** result of the operation (device specific, -1: descriptor closed) */
+   IFX_int_t            ret;
+
+   /** internal - next operation of the queue */
+   DEVIO_async_op_t     *pNext;
+   /** internal - context of the operation */
+   DEVIO_async_ctx_t    *pCtx;
+   /** internal - open instance of the descriptor */
+   void                 *pInstance;
+};
+
+/**
+   Asynchronous operation context - submission and completion queue.
+*/
+struct DEVIO_async_ctx_s
+{
+   /** valid flag */
+   IFX_boolean_t        bValid;
+   /** shutdown request for the worker threads */
+   volatile IFX_boolean_t bShutDown;
+   /** protects the queues */
+   IFXOS_mutex_t        mutex;
+   /** submitted operations, waiting for a worker thread */
+   DEVIO_async_op_t     *pPendHead;
+   DEVIO_async_op_t     *pPendTail;
+   /** completed operations, waiting for DEVIO_async_wait() */
+   DEVIO_async_op_t     *pDoneHead;
+   DEVIO_async_op_t     *pDoneTail;
+   /** number of submitted, not completed operations */
+   unsigned int         nInFlight;
+   /** wakeup of the worker threads */
+   IFXOS_event_t        workerEvent;
+   /** wakeup of DEVIO_async_wait() */
+   IFXOS_event_t        doneEvent;
+   /** number of worker threads */
+   unsigned int         nWorkers;
+   /** worker threads */
+   IFXOS_ThreadCtrl_t   *pWorkerThreads;
+};
+
+/**
+   Create an asynchronous operation context and start its worker threads.
+
+   \param ctx        context object
+   \param pName      name of the worker threads
+   \param nWorkers   number of worker threads for the drivers without
+                     asynchronous operation callback,
+                     0: these operations are executed within DEVIO_async_submit()
+   \param nPriority  priority of the worker threads
+
+   \return
+   - IFX_SUCCESS if the context has been created
+   - IFX_ERROR in case of a failure
+*/
+IFX_int32_t DEVIO_async_ctx_init ( DEVIO_async_ctx_t *ctx, const IFX_char_t *pName,
+                                   const unsigned int nWorkers, const unsigned int nPriority );
+
+/**
+   Stop the worker threads and delete an asynchronous operation context.
+   All submitted operations must be completed, the completed operations which
+   are not collected by DEVIO_async_wait() are dropped.
+
+   \param ctx        context object
+
+   \return
+   - IFX_SUCCESS if the context has been deleted
+   - IFX_ERROR in case of a failure (operations in flight)
+*/
+IFX_int32_t DEVIO_async_ctx_delete ( DEVIO_async_ctx_t *ctx );
+
+/**
+   Submit an asynchronous operation, the completion is returned by
+   DEVIO_async_wait(). The descriptor instance is kept up to the completion,
+   a queued operation of a closed descriptor completes with -1.
+
+   \param ctx        context object
+   \param op         operation, set fd, op, the operation parameters and cookie
+
+   \return
+   - 0 if the operation has been submitted
+   - -1 in case of a failure (invalid descriptor or operation)
+*/
+IFX_int_t DEVIO_async_submit ( DEVIO_async_ctx_t *ctx, DEVIO_async_op_t *op );
+
+/**
+   Collect completed asynchronous operations.
+
+   \param ctx           context object
+   \param ops           returns the completed operations (in completion order)
+   \param max_ops       size of the ops array
+   \param timeout_msec  wait time in [msec] if no operation is completed
+                        0: returns immediately.
+                        -1 (0xFFFFFFFF): wait forever.
+
+   \return
+   - -1 in case of a failure
+   - number of returned operations, 0 on timeout
+*/
+IFX_int_t DEVIO_async_wait ( DEVIO_async_ctx_t *ctx, DEVIO_async_op_t **ops,
+                             const unsigned int max_ops, const unsigned int timeout_msec );
+
+/**
+   Complete an asynchronous operation, called by a driver which has accepted
+   the operation via its DEVIO_device_async callback (not from interrupt
+   context).
+
+   \param op         operation
+   \param ret        result of the operation
+*/
+void DEVIO_async_done ( DEVIO_async_op_t *op, const IFX_int_t ret );
+
+/** @} */
+
+/* ============================================================================
+   Device IO - Loopback driver and benchmark
+   ========================================================================= */
+/** \addtogroup DEVIO_DEVICE_IO_LAYER
+@{ */
+
+/** Loopback driver and DEVIO_benchmark() support (test only, disabled by
+    default - set to 1 to build it into the library). */
+#ifndef DEVIO_HAVE_LOOP_DRIVER
+#define DEVIO_HAVE_LOOP_DRIVER      (0)
+#endif
+
+#if (defined(DEVIO_HAVE_LOOP_DRIVER) && (DEVIO_HAVE_LOOP_DRIVER == 1))
+
+/** Loopback device readiness (poll) - always ready */
+#define DEVIO_LOOP_READY_ALWAYS     0
+/** Loopback device readiness (poll) - ready if data is available */
+#define DEVIO_LOOP_READY_DATA       1
+/** Loopback device readiness (poll) - never ready */
+#define DEVIO_LOOP_READY_NEVER      2
+
+/** Loopback device ioctl - returns the parameter */
+#define DEVIO_LOOP_IOCTL_ECHO       0
+/** Loopback device ioctl - discard the buffered data */
+#define DEVIO_LOOP_IOCTL_FLUSH      1
+
+/**
+   Loopback device configuration.
+*/
+typedef struct
+{
+   /** size of the loopback buffer [byte], 0: null device (data is
+       discarded on write, read returns the requested size) */
+   unsigned int   buf_size;
+   /** added latency of each read / write / ioctl (batch) call [usec] */
+   unsigned int   latency_us;
+   /** readiness, see DEVIO_LOOP_READY_xxx */
+   unsigned int   ready_mode;
+   /** signal the readiness via DEVIO_device_notify() on write, else the
+       device is polled by DEVIO_select() */
+   unsigned int   notify;
+} DEVIO_loop_cfg_t;
+
+/** Loopback device (opaque). */
+typedef struct DEVIO_loop_dev_s DEVIO_loop_dev_t;
+
+/**
+   Install the loopback driver.
+
+   \return
+   - IFX_SUCCESS if the driver has been installed
+   - IFX_ERROR in case of a failure
+*/
+IFX_int32_t DEVIO_loop_driver_install ( void );
+
+/**
+   Remove the loopback driver, all loopback devices must be deleted before.
+
+   \return
+   - IFX_SUCCESS if the driver has been removed
+   - IFX_ERROR if the remove is refused (descriptors still open), the
+     driver stays installed
+*/
+IFX_int32_t DEVIO_loop_driver_remove ( void );
+
+/**
+   Add a loopback device, the written data is returned by the following
+   reads (from any descriptor of the device).
+
+   \param name    device name
+   \param pCfg    device configuration
+
+   \return
+   - IFX_NULL in case of a failure
+   - device handle
+*/
+DEVIO_loop_dev_t *DEVIO_loop_device_add ( const char *name, const DEVIO_loop_cfg_t *pCfg );
+
+/**
+   Delete a loopback device, all descriptors of the device must be closed
+   before.
+
+   \param pDev    device handle
+*/
+void DEVIO_loop_device_delete ( DEVIO_loop_dev_t *pDev );
+
+/**
+   Device IO benchmark based on the loopback driver, prints the open / close
+   rate, the read / write / ioctl rate of concurrent threads and the
+   DEVIO_select() wakeup latency.
+
+   \param nThreads   number of concurrent threads
+   \param nLoops     number of loops per thread
+
+   \return
+   - IFX_SUCCESS if the benchmark has been done
+   - IFX_ERROR in case of a failure
+*/
+IFX_int32_t DEVIO_benchmark ( const unsigned int nThreads, const unsigned int nLoops );
+
+#endif      /* #if (defined(DEVIO_HAVE_LOOP_DRIVER) && (DEVIO_HAVE_LOOP_DRIVER == 1)) */
+
+/** @} */
+
 /* ============================================================================
    Device IO - Device IO Layer control functions
    ========================================================================= */
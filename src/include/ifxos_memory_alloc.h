@@ -101,6 +101,8 @@
 #endif
 
 #include "ifx_types.h"
+#include "ifxos_thread.h"
+#include "ifxos_time.h"
 
 /* ============================================================================
    IFX OS adaptation - memory allocation
@@ -164,6 +166,839 @@ IFX_void_t IFXOS_MemFree(
 
 #endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) */
 
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_FLAGS) && (IFXOS_HAVE_MEM_ALLOC_FLAGS == 1) )
+/**
+   Allocate Memory Space from the OS with the given allocation flags.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   allocFlags     Allocation flags, IFXOS_MEM_ALLOC_FLAGS_DEFAULT,
+                  IFXOS_MEM_ALLOC_FLAGS_ATOMIC (usable within atomic context)
+                  or OS specific flags (Linux Kernel: GFP flags).
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+
+\remarks
+   The memory block is freed via \ref IFXOS_MemFree.
+*/
+IFX_void_t *IFXOS_MemAllocFlags(
+               IFX_size_t              memSize_byte,
+               IFXOS_MemAllocFlags_t   allocFlags);
+
+/** Allocate Memory Space within atomic context (interrupt, spinlock held) */
+#define IFXOS_MemAllocAtomic(memSize_byte) \
+            IFXOS_MemAllocFlags(memSize_byte, IFXOS_MEM_ALLOC_FLAGS_ATOMIC)
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_FLAGS) && (IFXOS_HAVE_MEM_ALLOC_FLAGS == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) )
+/**
+   Allocate an aligned Memory Space from the OS.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   align_byte     Alignment of the memory block [byte], power of 2
+                  (for example IFXOS_MEM_CACHE_LINE_SIZE).
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+
+\remarks
+   The memory block is freed via \ref IFXOS_MemFreeAligned.
+*/
+IFX_void_t *IFXOS_MemAllocAligned(
+               IFX_size_t  memSize_byte,
+               IFX_size_t  align_byte);
+
+/**
+   Free an aligned Memory Space.
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeAligned(
+               IFX_void_t  *pMemBlock);
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) )
+
+/** Large memory flag - zero the memory block */
+#define IFXOS_MEM_LARGE_FLAG_ZERO         0x00000001
+/** Large memory flag - prefer huge page backing (fewer TLB misses)
+    - User space: explicit huge pages (hugetlbfs), else transparent huge pages
+    - Linux Kernel: linear mapping, see IFXOS_MEM_LARGE_FLAG_CONTIGUOUS */
+#define IFXOS_MEM_LARGE_FLAG_HUGE_PAGE    0x00000002
+/** Large memory flag - physically contiguous (Linux Kernel only) */
+#define IFXOS_MEM_LARGE_FLAG_CONTIGUOUS   0x00000004
+/** Large memory flag - physically contiguous and DMA addressable
+    (Linux Kernel only, the streaming DMA mapping is up to the driver) */
+#define IFXOS_MEM_LARGE_FLAG_DMA          0x00000008
+
+/**
+   Allocate a large, page aligned Memory Space from the OS.
+
+\param
+   memSize_byte   Size of the requested memory block [byte], rounded up to
+                  the page size.
+\param
+   flags          Large memory flags, see IFXOS_MEM_LARGE_FLAG_xxx.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+
+\remarks
+   The memory block is freed via \ref IFXOS_MemFreeLarge.
+   Huge page backing is only a preference, the allocation falls back to
+   normal pages.
+*/
+IFX_void_t *IFXOS_MemAllocLarge(
+               IFX_size_t     memSize_byte,
+               IFX_uint32_t   flags);
+
+/**
+   Free a large Memory Space.
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeLarge(
+               IFX_void_t     *pMemBlock);
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) && \
+    ( defined(IFXOS_HAVE_MEM_COUNTER) && (IFXOS_HAVE_MEM_COUNTER == 1) )
+#  ifndef IFXOS_HAVE_MEM_TAG
+#     define IFXOS_HAVE_MEM_TAG                       1
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) )
+
+/** Memory tag - number of counter slots (power of 2), the slot is selected
+    by the current CPU */
+#ifndef IFXOS_MEM_TAG_CPU_SLOTS
+#  define IFXOS_MEM_TAG_CPU_SLOTS         8
+#endif
+
+/**
+   Memory tag - counters of a CPU slot, padded to a cache line.
+*/
+typedef union
+{
+   struct
+   {
+      /** allocated minus freed bytes of this slot (a block is freed to the
+          slot of its allocation) */
+      IFXOS_MemCounter_t   liveBytes;
+      /** max live bytes of this slot (high-water mark) */
+      IFXOS_MemCounter_t   peakBytes;
+      /** number of allocations */
+      IFXOS_MemCounter_t   numOfAlloc;
+      /** number of frees */
+      IFXOS_MemCounter_t   numOfFree;
+   } cnt;
+   /** padding - avoid false sharing between the slots */
+   IFX_uint8_t pad[IFXOS_MEM_CACHE_LINE_SIZE];
+} IFXOS_MemTagSlot_t;
+
+/**
+   Memory tag - attribution of the allocated bytes to an owner (module).
+
+\remarks
+   The counters are kept per CPU slot, an allocation only updates the slot
+   of the current CPU, a free the slot of the allocation. The sums are built
+   on read.
+*/
+typedef struct
+{
+   /** counters per CPU slot */
+   IFXOS_MemTagSlot_t   slot[IFXOS_MEM_TAG_CPU_SLOTS];
+   /** name of the tag */
+   const IFX_char_t     *pName;
+   /** valid flag */
+   IFX_boolean_t        bValid;
+   /** points to the internal system object - for debugging */
+   IFX_void_t           *pSysObject;
+} IFXOS_MemTag_t;
+
+/**
+   Memory tag - statistics.
+*/
+typedef struct
+{
+   /** currently allocated bytes */
+   IFX_size_t     liveBytes;
+   /** max allocated bytes (high-water mark), sum of the slot peaks - exact
+       for a single slot, else an upper bound */
+   IFX_size_t     peakBytes;
+   /** number of allocations */
+   IFX_ulong_t    numOfAlloc;
+   /** number of frees */
+   IFX_ulong_t    numOfFree;
+} IFXOS_MemTagStats_t;
+
+/**
+   Initialize a memory tag.
+
+\param
+   pTag     Points to the tag object.
+\param
+   pName    Name of the tag, the string is referenced (not copied).
+
+\return
+   IFX_SUCCESS if the tag has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTagInit(
+               IFXOS_MemTag_t    *pTag,
+               const IFX_char_t  *pName);
+
+/**
+   Delete a memory tag.
+
+\param
+   pTag     Points to the tag object.
+
+\return
+   IFX_SUCCESS if the tag has been deleted, else
+   IFX_ERROR.
+
+\remarks
+   All blocks of the tag must be freed before, a warning is printed else.
+*/
+IFX_int32_t IFXOS_MemTagDelete(
+               IFXOS_MemTag_t    *pTag);
+
+/**
+   Allocate Memory Space from the OS and account it to a tag.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   pTag           Points to the tag object.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+
+\remarks
+   The memory block must be freed via \ref IFXOS_MemFreeTagged. A single
+   tagged block is limited to 4 GByte.
+*/
+IFX_void_t *IFXOS_MemAllocTagged(
+               IFX_size_t     memSize_byte,
+               IFXOS_MemTag_t *pTag);
+
+/**
+   Free a Memory Space allocated via \ref IFXOS_MemAllocTagged.
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeTagged(
+               IFX_void_t     *pMemBlock);
+
+/**
+   Get the statistics of a memory tag.
+
+\param
+   pTag     Points to the tag object.
+\param
+   pStats   Returns the statistics.
+
+\return
+   IFX_SUCCESS if the statistics are returned, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTagStatsGet(
+               IFXOS_MemTag_t       *pTag,
+               IFXOS_MemTagStats_t  *pStats);
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) && \
+    ( defined(IFXOS_HAVE_BLOCK_ALLOC) && (IFXOS_HAVE_BLOCK_ALLOC == 1) ) && \
+    ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) ) && \
+    defined(IFXOS_MEM_TRACK_CALLER)
+#  ifndef IFXOS_HAVE_MEM_TRACK
+#     define IFXOS_HAVE_MEM_TRACK                     1
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_TRACK) && (IFXOS_HAVE_MEM_TRACK == 1) )
+
+/** Leak tracker - number of hash table shards (power of 2), one lock each */
+#define IFXOS_MEM_TRACK_SHARDS            16
+/** Leak tracker - number of hash buckets per shard (power of 2) */
+#define IFXOS_MEM_TRACK_BUCKETS           256
+/** Leak tracker - max number of different call sites for the show */
+#define IFXOS_MEM_TRACK_SITES_MAX         1024
+
+/** Leak tracker - enabled flag, checked by the allocation functions */
+extern volatile IFX_boolean_t IFXOS_memTrackEnabled;
+
+/**
+   Start the leak tracker - all following \ref IFXOS_MemAlloc and
+   \ref IFXOS_BlockAlloc calls are recorded with call site and size up to the
+   free.
+
+\param
+   maxEntries  Max number of recorded live allocations, the entries are
+               preallocated (no allocation within the tracker afterwards).
+
+\return
+   IFX_SUCCESS if the tracker has been started, else
+   IFX_ERROR.
+
+\remarks
+   Allocations done before the start are not recorded, further allocations
+   beyond maxEntries are only counted.
+*/
+IFX_int32_t IFXOS_MemTrackInit(
+               IFX_uint32_t   maxEntries);
+
+/**
+   Stop the leak tracker and release the entries.
+
+\return
+   IFX_SUCCESS if the tracker has been stopped, else
+   IFX_ERROR.
+
+\remarks
+   Allocations and frees of other threads may run concurrently, the tracker
+   tables are kept up to \ref IFXOS_MemTrackRelease.
+*/
+IFX_int32_t IFXOS_MemTrackCleanup(IFX_void_t);
+
+/**
+   Release the leak tracker tables, stops a running tracker.
+
+\return
+   IFX_SUCCESS if the tables have been released, else
+   IFX_ERROR.
+
+\remarks
+   Only at process / module exit, no other thread may allocate or free
+   memory at this time.
+*/
+IFX_int32_t IFXOS_MemTrackRelease(IFX_void_t);
+
+/**
+   Record a live allocation (called via IFXOS_MEM_TRACK_ADD).
+
+\param
+   pBlock   Points to the allocated block.
+\param
+   size     Size of the block [byte].
+\param
+   pCaller  Call site of the allocation.
+*/
+IFX_void_t IFXOS_MemTrackAdd(
+               IFX_void_t        *pBlock,
+               IFX_size_t        size,
+               IFX_void_t        *pCaller);
+
+/**
+   Remove the record of a freed allocation (called via IFXOS_MEM_TRACK_REMOVE).
+
+\param
+   pBlock   Points to the freed block.
+*/
+IFX_void_t IFXOS_MemTrackRemove(
+               IFX_void_t        *pBlock);
+
+/**
+   Print the call sites with the most live bytes.
+
+\param
+   topN     Number of call sites to print, 0 selects all.
+
+\return
+   IFX_SUCCESS if the call sites have been printed, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_MemTrackShow(
+               IFX_uint32_t   topN);
+
+/** record an allocation of the given call site if the tracker is enabled */
+#define IFXOS_MEM_TRACK_ADD_CALLER(pBlock, size, pCaller) \
+            do { \
+               if ((IFXOS_memTrackEnabled == IFX_TRUE) && ((pBlock) != IFX_NULL)) \
+                  { IFXOS_MemTrackAdd(pBlock, size, pCaller); } \
+            } while (0)
+
+/** record an allocation of the calling function if the tracker is enabled */
+#define IFXOS_MEM_TRACK_ADD(pBlock, size) \
+            IFXOS_MEM_TRACK_ADD_CALLER(pBlock, size, IFXOS_MEM_TRACK_CALLER())
+
+/** remove the record of an allocation if the tracker is enabled */
+#define IFXOS_MEM_TRACK_REMOVE(pBlock) \
+            do { \
+               if (IFXOS_memTrackEnabled == IFX_TRUE) \
+                  { IFXOS_MemTrackRemove(pBlock); } \
+            } while (0)
+
+#else
+
+#define IFXOS_MEM_TRACK_ADD_CALLER(pBlock, size, pCaller)   ((void)(pCaller))
+#define IFXOS_MEM_TRACK_ADD(pBlock, size)       /*lint -e{19} */
+#define IFXOS_MEM_TRACK_REMOVE(pBlock)          /*lint -e{19} */
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_TRACK) && (IFXOS_HAVE_MEM_TRACK == 1) ) */
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_CALLER) && (IFXOS_HAVE_MEM_ALLOC_CALLER == 1) )
+/**
+   Allocate Memory Space from the OS on behalf of the given call site
+   (internal, for allocation wrappers).
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   pCaller        Call site the allocation is recorded for (leak tracker),
+                  captured by the public entry point.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+
+\remarks
+   The memory block is freed via \ref IFXOS_MemFree.
+*/
+IFX_void_t *IFXOS_MemAllocCaller(
+               IFX_size_t  memSize_byte,
+               IFX_void_t  *pCaller);
+
+/** allocate memory on behalf of the caller of the calling function */
+#  define IFXOS_MEM_ALLOC_CALLER(memSize_byte) \
+            IFXOS_MemAllocCaller(memSize_byte, IFXOS_MEM_TRACK_CALLER())
+#else
+#  define IFXOS_MEM_ALLOC_CALLER(memSize_byte)  IFXOS_MemAlloc(memSize_byte)
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_CALLER) && (IFXOS_HAVE_MEM_ALLOC_CALLER == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) ) && \
+    ( ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && (IFXOS_HAVE_MEM_POOL_CPU_CACHE == 1) ) || \
+      ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) ) )
+#  ifndef IFXOS_HAVE_MEM_POOL_THREAD_CACHE
+#     define IFXOS_HAVE_MEM_POOL_THREAD_CACHE         1
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) ) && \
+    ( defined(IFXOS_HAVE_BLOCK_ALLOC) && (IFXOS_HAVE_BLOCK_ALLOC == 1) ) && \
+    ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) ) && \
+    ( defined(IFXOS_HAVE_TIME_SLEEP_MS) && (IFXOS_HAVE_TIME_SLEEP_MS == 1) ) && \
+    ( defined(IFXOS_HAVE_TIME_ELAPSED_TIME_GET_MS) && (IFXOS_HAVE_TIME_ELAPSED_TIME_GET_MS == 1) )
+   /* pool benchmark - test only, set to 1 to build it into the library */
+#  ifndef IFXOS_HAVE_MEM_POOL_BENCHMARK
+#     define IFXOS_HAVE_MEM_POOL_BENCHMARK            0
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) )
+
+/** Memory pool flag - zero the element on allocation */
+#define IFXOS_POOL_FLAG_ZERO              0x00000001
+/** Memory pool flag - align each element to a cache line (avoid false sharing) */
+#define IFXOS_POOL_FLAG_CACHE_ALIGN       0x00000002
+/** Memory pool flag - add a further slab if the pool is empty
+    (Linux Kernel: only from process context) */
+#define IFXOS_POOL_FLAG_GROW              0x00000004
+/** Memory pool flag - per thread (Linux Kernel: per CPU) cache in front of
+    the shared free list (ignored without IFXOS_HAVE_MEM_POOL_THREAD_CACHE) */
+#define IFXOS_POOL_FLAG_THREAD_CACHE      0x00000008
+
+/** Memory pool thread cache - number of elements moved on refill / drain */
+#define IFXOS_POOL_CACHE_BATCH            16
+/** Memory pool thread cache - max number of elements within a thread cache */
+#define IFXOS_POOL_CACHE_SIZE             (2 * IFXOS_POOL_CACHE_BATCH)
+
+/**
+   Memory pool - free list element, placed within the free element.
+*/
+typedef struct IFXOS_PoolElem_s
+{
+   /** next free element */
+   struct IFXOS_PoolElem_s *pNext;
+} IFXOS_PoolElem_t;
+
+/**
+   Memory pool - slab header, placed at the start of each slab block.
+*/
+typedef struct IFXOS_PoolSlab_s
+{
+   /** next slab of the pool */
+   struct IFXOS_PoolSlab_s *pNext;
+} IFXOS_PoolSlab_t;
+
+/** forward declaration of the pool thread cache */
+struct IFXOS_PoolCache_s;
+
+/**
+   Memory pool - fixed size elements from preallocated, cache line aligned
+   slabs.
+
+\remarks
+   With \ref IFXOS_POOL_FLAG_THREAD_CACHE the free list and the statistics
+   are the depot behind the thread caches: elements within a thread cache are
+   counted as "in use" and the counters are updated per refill / drain.
+*/
+typedef struct
+{
+   /** requested element size [byte] */
+   IFX_size_t           elemSize;
+   /** element distance within the slab [byte] */
+   IFX_size_t           elemStride;
+   /** number of elements per slab */
+   IFX_uint32_t         slabElems;
+   /** pool flags, see IFXOS_POOL_FLAG_xxx */
+   IFX_uint32_t         flags;
+   /** free list */
+   IFXOS_PoolElem_t     *pFreeList;
+   /** slab list */
+   IFXOS_PoolSlab_t     *pSlabList;
+   /** number of slabs */
+   IFX_uint32_t         numOfSlabs;
+   /** number of elements */
+   IFX_uint32_t         numOfElem;
+   /** number of free elements */
+   IFX_uint32_t         numOfFree;
+   /** max number of elements in use (high-water mark) */
+   IFX_uint32_t         maxInUse;
+   /** number of failed allocations (pool empty) */
+   IFX_uint32_t         numOfAllocFails;
+   /** protects the free list and the statistics */
+   IFXOS_PoolLock_t     lock;
+#if ( defined(IFXOS_HAVE_MEM_POOL_CPU_CACHE) && (IFXOS_HAVE_MEM_POOL_CPU_CACHE == 1) )
+   /** per CPU caches (array) */
+   struct IFXOS_PoolCache_s *pCpuCache;
+#elif ( defined(IFXOS_HAVE_MEM_POOL_THREAD_CACHE) && (IFXOS_HAVE_MEM_POOL_THREAD_CACHE == 1) )
+   /** thread local storage key of the thread caches */
+   IFXOS_TlsKey_t       cacheKey;
+   /** list of the thread caches */
+   struct IFXOS_PoolCache_s *pCacheList;
+#endif
+   /** points to the internal system object - for debugging */
+   IFX_void_t           *pSysObject;
+} IFXOS_Pool_t;
+
+/**
+   Memory pool - per thread / per CPU cache ("magazine").
+*/
+typedef struct IFXOS_PoolCache_s
+{
+   /** next thread cache of the pool */
+   struct IFXOS_PoolCache_s   *pNext;
+   /** pool of this cache */
+   IFXOS_Pool_t               *pPool;
+   /** number of cached elements */
+   IFX_uint32_t               count;
+   /** cached elements */
+   IFX_void_t                 *pElem[IFXOS_POOL_CACHE_SIZE];
+} IFXOS_PoolCache_t;
+
+/**
+   Memory pool - statistics.
+*/
+typedef struct
+{
+   /** requested element size [byte] */
+   IFX_size_t     elemSize;
+   /** number of slabs */
+   IFX_uint32_t   numOfSlabs;
+   /** number of elements */
+   IFX_uint32_t   numOfElem;
+   /** number of free elements */
+   IFX_uint32_t   numOfFree;
+   /** number of free elements within the thread caches */
+   IFX_uint32_t   numOfCached;
+   /** number of elements in use */
+   IFX_uint32_t   numOfInUse;
+   /** max number of elements in use (high-water mark) */
+   IFX_uint32_t   maxInUse;
+   /** number of failed allocations (pool empty) */
+   IFX_uint32_t   numOfAllocFails;
+} IFXOS_PoolStats_t;
+
+/**
+   Create a memory pool with fixed size elements.
+
+\param
+   elemSize    Size of an element [byte].
+\param
+   count       Number of preallocated elements (also the slab size for growing).
+\param
+   flags       Pool flags, see IFXOS_POOL_FLAG_xxx.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the pool.
+
+\remarks
+   The pool memory is allocated via \ref IFXOS_BlockAlloc.
+\remarks
+   With \ref IFXOS_POOL_FLAG_THREAD_CACHE each thread allocates and frees via
+   its own cache and only accesses the shared free list to refill or drain
+   \ref IFXOS_POOL_CACHE_BATCH elements at once. The cache is returned on
+   thread end. Linux Kernel: a cache per CPU, usable from any context.
+*/
+IFXOS_Pool_t *IFXOS_PoolCreate(
+               IFX_size_t     elemSize,
+               IFX_uint32_t   count,
+               IFX_uint32_t   flags);
+
+/**
+   Delete a memory pool and release all slabs.
+
+\param
+   pPool    Points to the pool.
+
+\return
+   IFX_SUCCESS if the pool is deleted, else
+   IFX_ERROR.
+
+\remarks
+   The pool must not be used anymore, also threads which hold a thread cache
+   must not end while the pool is deleted.
+   Elements within the thread caches are released with the pool.
+*/
+IFX_int32_t IFXOS_PoolDelete(
+               IFXOS_Pool_t   *pPool);
+
+/**
+   Allocate an element from a memory pool - O(1).
+
+\param
+   pPool    Points to the pool.
+
+\return
+   IFX_NULL if the pool is empty, else
+   pointer to the element.
+*/
+IFX_void_t *IFXOS_PoolAlloc(
+               IFXOS_Pool_t   *pPool);
+
+/**
+   Return an element to its memory pool - O(1).
+
+\param
+   pPool    Points to the pool.
+\param
+   pElem    Points to the element.
+*/
+IFX_void_t IFXOS_PoolFree(
+               IFXOS_Pool_t   *pPool,
+               IFX_void_t     *pElem);
+
+/**
+   Get the statistics of a memory pool.
+
+\param
+   pPool    Points to the pool.
+\param
+   pStats   Returns the statistics.
+
+\return
+   IFX_SUCCESS if the statistics are returned, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_PoolStatsGet(
+               IFXOS_Pool_t      *pPool,
+               IFXOS_PoolStats_t *pStats);
+
+#if ( defined(IFXOS_HAVE_MEM_POOL_BENCHMARK) && (IFXOS_HAVE_MEM_POOL_BENCHMARK == 1) )
+/**
+   Multi-threaded alloc / free benchmark, compares \ref IFXOS_BlockAlloc
+   with the memory pool (shared free list and thread caches).
+   The results are printed.
+
+\param
+   nThreads    Number of concurrent threads.
+\param
+   nLoops      Number of loops per thread, each loop allocates and frees
+               \ref IFXOS_POOL_CACHE_SIZE elements.
+\param
+   elemSize    Element size [byte].
+
+\return
+   IFX_SUCCESS if the benchmark has been done, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_PoolBenchmark(
+               IFX_uint32_t   nThreads,
+               IFX_uint32_t   nLoops,
+               IFX_size_t     elemSize);
+#endif
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) ) */
+
+
+#if ( defined(IFXOS_HAVE_BLOCK_ALLOC) && (IFXOS_HAVE_BLOCK_ALLOC == 1) )
+#  ifndef IFXOS_HAVE_MEM_ARENA
+#     define IFXOS_HAVE_MEM_ARENA                     1
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) )
+
+/** Memory arena - alignment of the allocated blocks [byte] */
+#define IFXOS_ARENA_ALIGN                 8
+/** Memory arena - default chunk size [byte] */
+#define IFXOS_ARENA_DEFAULT_CHUNK_SIZE    4096
+
+/**
+   Memory arena - chunk header, placed at the start of each chunk.
+*/
+typedef struct IFXOS_ArenaChunk_s
+{
+   /** next chunk of the arena */
+   struct IFXOS_ArenaChunk_s *pNext;
+   /** usable size of the chunk [byte] */
+   IFX_size_t  size;
+   /** used part of the chunk [byte] */
+   IFX_size_t  used;
+} IFXOS_ArenaChunk_t;
+
+/**
+   Memory arena (region) - bump pointer allocation for temporary data, all
+   blocks are released at once.
+
+\remarks
+   An arena is not protected against concurrent access, use one arena per
+   thread / request.
+*/
+typedef struct
+{
+   /** first chunk */
+   IFXOS_ArenaChunk_t   *pFirst;
+   /** current chunk, IFX_NULL: nothing allocated,
+       the following chunks are kept for reuse */
+   IFXOS_ArenaChunk_t   *pCurr;
+   /** size of a new chunk [byte] */
+   IFX_size_t           chunkSize;
+   /** number of chunks */
+   IFX_uint32_t         numOfChunks;
+   /** valid flag */
+   IFX_boolean_t        bValid;
+} IFXOS_Arena_t;
+
+/**
+   Memory arena - allocation state, see \ref IFXOS_ArenaMarkGet.
+*/
+typedef struct
+{
+   /** current chunk */
+   IFXOS_ArenaChunk_t   *pChunk;
+   /** used part of the current chunk [byte] */
+   IFX_size_t           used;
+} IFXOS_ArenaMark_t;
+
+/**
+   Initialize a memory arena, no memory is allocated up to the first
+   \ref IFXOS_ArenaAlloc.
+
+\param
+   pArena      Points to the arena object.
+\param
+   chunkSize   Size of the chunks which are allocated via \ref IFXOS_BlockAlloc
+               [byte], 0 selects \ref IFXOS_ARENA_DEFAULT_CHUNK_SIZE.
+
+\return
+   IFX_SUCCESS if the arena has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_ArenaInit(
+               IFXOS_Arena_t  *pArena,
+               IFX_size_t     chunkSize);
+
+/**
+   Delete a memory arena and free all chunks.
+
+\param
+   pArena      Points to the arena object.
+
+\return
+   IFX_SUCCESS if the arena has been deleted, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_ArenaDelete(
+               IFXOS_Arena_t  *pArena);
+
+/**
+   Allocate a block from a memory arena (bump pointer).
+
+\param
+   pArena      Points to the arena object.
+\param
+   memSize_byte   Size of the requested block [byte].
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the block (aligned to \ref IFXOS_ARENA_ALIGN).
+
+\remarks
+   Single blocks can not be freed, see \ref IFXOS_ArenaRewind and
+   \ref IFXOS_ArenaReset.
+*/
+IFX_void_t *IFXOS_ArenaAlloc(
+               IFXOS_Arena_t  *pArena,
+               IFX_size_t     memSize_byte);
+
+/**
+   Get the current allocation state of a memory arena.
+
+\param
+   pArena      Points to the arena object.
+\param
+   pMark       Returns the allocation state.
+*/
+IFX_void_t IFXOS_ArenaMarkGet(
+               IFXOS_Arena_t     *pArena,
+               IFXOS_ArenaMark_t *pMark);
+
+/**
+   Release all blocks which have been allocated after the given mark - O(1).
+
+\param
+   pArena      Points to the arena object.
+\param
+   pMark       Allocation state, see \ref IFXOS_ArenaMarkGet.
+
+\remarks
+   The chunks are kept for the following allocations.
+*/
+IFX_void_t IFXOS_ArenaRewind(
+               IFXOS_Arena_t     *pArena,
+               const IFXOS_ArenaMark_t *pMark);
+
+/**
+   Release all blocks of a memory arena - O(1).
+
+\param
+   pArena      Points to the arena object.
+
+\remarks
+   The chunks are kept for the following allocations, use
+   \ref IFXOS_ArenaDelete to free them.
+*/
+IFX_void_t IFXOS_ArenaReset(
+               IFXOS_Arena_t  *pArena);
+
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ARENA) && (IFXOS_HAVE_MEM_ARENA == 1) ) */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -40,6 +40,17 @@
    IFX OS adaptation - Global Includes
    ========================================================================= */
 #include "ifx_types.h"
+#include "ifxos_memory_alloc.h"
+
+#if ( !defined(IFXOS_FLAT_HIRACHY) || (IFXOS_FLAT_HIRACHY == 0) )
+#  if defined(LINUX)
+#     include "linux/ifxos_linux_memory_map.h"
+#  endif
+#else
+#  if defined(LINUX)
+#     include "ifxos_linux_memory_map.h"
+#  endif
+#endif
 
 /* ============================================================================
    IFX OS adaptation - copy between user and driver space.
@@ -97,6 +108,338 @@ IFX_int32_t IFXOS_Phy2VirtUnmap(
                IFX_ulong_t    addrRangeSize_byte,
                IFX_uint8_t    **ppVirtAddr);
 
+#if ( defined(IFXOS_HAVE_MEMORY_MAP_DEVICE) && (IFXOS_HAVE_MEMORY_MAP_DEVICE == 1) )
+/**
+   Set the device used for the physical to virtual address mapping.
+
+\param
+   pDevName    Name of the device, for example "/dev/mem" or "/dev/uio0".
+               A regular file can be used as stand-in of the physical memory.
+               IFX_NULL selects the direct assignment of the physical address.
+
+\return
+   IFX_SUCCESS if the device has been set, else
+   IFX_ERROR   if a mapping is still active or the name is too long.
+*/
+IFX_int32_t IFXOS_Phy2VirtDeviceSet(
+               const IFX_char_t  *pDevName);
+#endif
+
+#if ( defined(IFXOS_HAVE_REG_BATCH) && (IFXOS_HAVE_REG_BATCH == 1) )
+
+/** Register batch - mask value, all bits of the register */
+#define IFXOS_REG_MASK_ALL                0xFFFFFFFF
+
+/** Register batch write flag - read back and compare each written register */
+#define IFXOS_REG_BATCH_FLAG_VERIFY       0x00000001
+/** Register batch write flag - barrier after each write (strict ordering) */
+#define IFXOS_REG_BATCH_FLAG_ORDERED      0x00000002
+
+/**
+   Register batch - single 32 bit register access.
+*/
+typedef struct
+{
+   /** offset of the register to the mapped base address [byte], 32 bit aligned */
+   IFX_uint32_t   offset;
+   /** write: value to write, read: returns the (masked) register value */
+   IFX_uint32_t   value;
+   /** affected bits, 0 or IFXOS_REG_MASK_ALL select the whole register
+       (write without a read-modify-write) */
+   IFX_uint32_t   mask;
+} IFXOS_RegAccess_t;
+
+/**
+   Write a table of registers of a mapped address range.
+
+\param
+   pBase       Base address, see \ref IFXOS_Phy2VirtMap [I]
+\param
+   pRegs       Points to the register table [I]
+\param
+   numOfRegs   Number of table entries [I]
+\param
+   flags       Write flags, see IFXOS_REG_BATCH_FLAG_xxx [I]
+
+\return
+   IFX_SUCCESS if all registers have been written (and verified), else
+   IFX_ERROR   if something was wrong.
+
+\remark
+   Subsequent entries with the same offset are combined to a single access.
+   Without IFXOS_REG_BATCH_FLAG_ORDERED a barrier is only placed in front of
+   a read (read-modify-write, verification) which follows a write, and at the
+   end of the batch.
+*/
+IFX_int32_t IFXOS_RegWriteBatch(
+               IFX_uint8_t             *pBase,
+               const IFXOS_RegAccess_t *pRegs,
+               IFX_uint32_t            numOfRegs,
+               IFX_uint32_t            flags);
+
+/**
+   Read a table of registers of a mapped address range.
+
+\param
+   pBase       Base address, see \ref IFXOS_Phy2VirtMap [I]
+\param
+   pRegs       Points to the register table, returns the masked values [IO]
+\param
+   numOfRegs   Number of table entries [I]
+
+\return
+   IFX_SUCCESS if all registers have been read, else
+   IFX_ERROR   if something was wrong.
+*/
+IFX_int32_t IFXOS_RegReadBatch(
+               IFX_uint8_t             *pBase,
+               IFXOS_RegAccess_t       *pRegs,
+               IFX_uint32_t            numOfRegs);
+
+#endif
+
+#if ( defined(IFXOS_HAVE_SHM_RING) && (IFXOS_HAVE_SHM_RING == 1) )
+
+/** Shared ring - cache line size for the header layout [byte] */
+#define IFXOS_SHM_RING_CACHE_LINE         64
+/** Shared ring - magic of a formatted ring */
+#define IFXOS_SHM_RING_MAGIC              0x52494E47
+/** Shared ring - record alignment and size of the record header [byte] */
+#define IFXOS_SHM_RING_REC_ALIGN          8
+/** Shared ring - record length of a padding record (wrap around) */
+#define IFXOS_SHM_RING_REC_PAD            0xFFFFFFFF
+
+/**
+   Shared ring - header, located in front of the data area within the shared
+   memory. The indices are free running byte counters, each written by one
+   side only and placed within an own cache line.
+*/
+typedef struct
+{
+   /** magic, IFXOS_SHM_RING_MAGIC */
+   IFX_uint32_t            magic;
+   /** size of the data area [byte], power of 2 */
+   IFX_uint32_t            size;
+   /** reserved */
+   IFX_uint8_t             res0[IFXOS_SHM_RING_CACHE_LINE - 2 * sizeof(IFX_uint32_t)];
+   /** producer index, written by the producer only */
+   volatile IFX_uint32_t   head;
+   /** reserved */
+   IFX_uint8_t             res1[IFXOS_SHM_RING_CACHE_LINE - sizeof(IFX_uint32_t)];
+   /** consumer index, written by the consumer only */
+   volatile IFX_uint32_t   tail;
+   /** reserved */
+   IFX_uint8_t             res2[IFXOS_SHM_RING_CACHE_LINE - sizeof(IFX_uint32_t)];
+   /** consumer waits for a wakeup, written by the consumer only */
+   volatile IFX_uint32_t   waiting;
+   /** reserved */
+   IFX_uint8_t             res3[IFXOS_SHM_RING_CACHE_LINE - sizeof(IFX_uint32_t)];
+} IFXOS_ShmRingHdr_t;
+
+/**
+   Shared ring - local handle of one side, a handle is used either as
+   producer or as consumer.
+*/
+typedef struct
+{
+   /** shared header */
+   IFXOS_ShmRingHdr_t   *pHdr;
+   /** shared data area */
+   IFX_uint8_t          *pData;
+   /** size of the data area [byte], taken on init (not from the shared memory) */
+   IFX_uint32_t         size;
+   /** own index, producer: head, consumer: tail (not taken from the shared
+       memory, which can be written by the other side) */
+   IFX_uint32_t         idx;
+   /** producer: reserved record, consumer: current record (start index) */
+   IFX_uint32_t         pos;
+   /** producer: reserved payload size, consumer: current payload size [byte] */
+   IFX_uint32_t         len;
+   /** consumer: index behind the current record */
+   IFX_uint32_t         next;
+   /** size of the shared memory (header and data area) [byte] */
+   IFX_uint32_t         memSize_byte;
+} IFXOS_ShmRing_t;
+
+/**
+   Shared ring - attach a handle to the shared memory.
+
+\param
+   pRing          Points to the ring handle [O]
+\param
+   pMem           Shared memory, header followed by the data area [I]
+\param
+   memSize_byte   Size of the shared memory [I]
+\param
+   bFormat        IFX_TRUE: initialize the header (owner of the ring, the data
+                  area is the largest power of 2 within the memory), else
+                  the header is checked [I]
+
+\return
+   IFX_SUCCESS if the handle is attached, else
+   IFX_ERROR   invalid memory or header.
+*/
+IFX_int32_t IFXOS_ShmRingInit(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_void_t        *pMem,
+               IFX_uint32_t      memSize_byte,
+               IFX_boolean_t     bFormat);
+
+/**
+   Shared ring - producer, reserve a record within the ring.
+   The payload is written in place, see \ref IFXOS_ShmRingCommit.
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   size_byte   Payload size, max half of the data area minus the record
+               header [I]
+
+\return
+   Payload of the reserved record, else
+   IFX_NULL    ring full or invalid size.
+*/
+IFX_void_t *IFXOS_ShmRingReserve(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      size_byte);
+
+/**
+   Shared ring - producer, publish the reserved record.
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   size_byte   Written payload size, up to the reserved size [I]
+
+\return
+   IFX_TRUE if the consumer waits and has to be waked up (driver: see
+   \ref IFXOS_DrvSelectQueueWakeUp), else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_ShmRingCommit(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      size_byte);
+
+/**
+   Shared ring - consumer, get the next record (in place).
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   pSize_byte  Returns the payload size [O]
+
+\return
+   Payload of the next record, else
+   IFX_NULL    ring empty (or corrupted).
+*/
+IFX_void_t *IFXOS_ShmRingPeek(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      *pSize_byte);
+
+/**
+   Shared ring - consumer, free the record returned by \ref IFXOS_ShmRingPeek.
+
+\param
+   pRing       Points to the ring handle [I]
+*/
+IFX_void_t IFXOS_ShmRingRelease(
+               IFXOS_ShmRing_t   *pRing);
+
+/**
+   Shared ring - check if the ring contains a record.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_TRUE if the ring is empty, else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_ShmRingIsEmpty(
+               IFXOS_ShmRing_t   *pRing);
+
+/**
+   Shared ring - consumer, announce a wait for the next record.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_TRUE if the ring is still empty and the consumer has to sleep (the
+   producer signals the next commit), else IFX_FALSE (records available, no
+   wait announced).
+
+\remark
+   The wait has to be finished with \ref IFXOS_ShmRingWaitDone.
+*/
+IFX_boolean_t IFXOS_ShmRingWaitPrepare(
+               IFXOS_ShmRing_t   *pRing);
+
+/**
+   Shared ring - consumer, finish a wait announced by
+   \ref IFXOS_ShmRingWaitPrepare.
+
+\param
+   pRing       Points to the ring handle [I]
+*/
+IFX_void_t IFXOS_ShmRingWaitDone(
+               IFXOS_ShmRing_t   *pRing);
+
+#if ( defined(IFXOS_HAVE_DRV_SHM_RING) && (IFXOS_HAVE_DRV_SHM_RING == 1) )
+
+/**
+   Shared ring - driver, allocate and format a ring which can be mapped to
+   user space, see \ref IFXOS_DrvShmRingMmap.
+
+\param
+   pRing          Points to the ring handle [O]
+\param
+   dataSize_byte  Size of the data area, power of 2 [I]
+
+\return
+   IFX_SUCCESS if the ring has been created, else
+   IFX_ERROR   invalid size or no memory.
+*/
+IFX_int32_t IFXOS_DrvShmRingCreate(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      dataSize_byte);
+
+/**
+   Shared ring - driver, free a ring created by \ref IFXOS_DrvShmRingCreate.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_SUCCESS if the ring has been freed, else
+   IFX_ERROR.
+
+\attention
+   The ring must not be mapped any more, delete the ring within the release
+   (close) of the device.
+*/
+IFX_int32_t IFXOS_DrvShmRingDelete(
+               IFXOS_ShmRing_t   *pRing);
+
+/**
+   Shared ring - driver, map the ring into the user address space, to be
+   called within the mmap of the driver.
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   pMmapArg    OS specific mmap argument (Linux: virtual memory area) [I]
+
+\return
+   IFX_SUCCESS if the ring has been mapped, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_DrvShmRingMmap(
+               IFXOS_ShmRing_t      *pRing,
+               IFXOS_drvMmapArg_t   *pMmapArg);
+
+#endif      /* #if ( defined(IFXOS_HAVE_DRV_SHM_RING) && (IFXOS_HAVE_DRV_SHM_RING == 1) ) */
+
+#endif      /* #if ( defined(IFXOS_HAVE_SHM_RING) && (IFXOS_HAVE_SHM_RING == 1) ) */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -297,6 +297,27 @@ typedef struct
    /** number of Inits / Init Attempts */
    IFX_uint_t           numOfInit;
 
+   /** system task ID of the thread (0 if not available) */
+   IFX_int_t            taskId;
+
+   /** CPU time [ms] in user mode (sampled at thread end) */
+   IFX_uint_t           cpuUserTime_ms;
+   /** CPU time [ms] in system mode (sampled at thread end) */
+   IFX_uint_t           cpuSysTime_ms;
+   /** number of voluntary context switches (sampled at thread end) */
+   IFX_uint_t           numOfVolCtxSwitch;
+   /** number of involuntary context switches (sampled at thread end) */
+   IFX_uint_t           numOfInvolCtxSwitch;
+
+   /** number of event wakeups */
+   IFX_uint_t           numOfWakeup;
+   /** last wakeup latency [us] - event wakeup until the thread runs */
+   IFX_uint_t           wakeupLatencyLast_us;
+   /** average wakeup latency [us] (smoothed over the last wakeups) */
+   IFX_uint_t           wakeupLatencyAvg_us;
+   /** max wakeup latency [us] */
+   IFX_uint_t           wakeupLatencyMax_us;
+
 #if ( defined(HAVE_IFXOS_SYSOBJ_EXT_TRACE_SUPPORT) && (HAVE_IFXOS_SYSOBJ_EXT_TRACE_SUPPORT == 1))
    /** running count */
    volatile IFX_uint_t  runCount;
@@ -323,10 +344,60 @@ typedef struct
                      { ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjThread.numOfInit++; } \
                } while (0)
 
+#  define IFXOS_SYS_THREAD_TASK_ID_SET(pIFXOS_SysObject, nTaskId)\
+               /*lint -e{19} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjThread.taskId = (IFX_int_t)(nTaskId); } \
+               } while (0)
+
+#  define IFXOS_SYS_THREAD_USAGE_SET(pIFXOS_SysObject, usrTime_ms, sysTime_ms, nVolCtxSw, nInvolCtxSw)\
+               /*lint -e{19} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                  { \
+                     IFXOS_sys_object_thread_t *pSysObjThr = &((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjThread; \
+                     pSysObjThr->cpuUserTime_ms      = (IFX_uint_t)(usrTime_ms); \
+                     pSysObjThr->cpuSysTime_ms       = (IFX_uint_t)(sysTime_ms); \
+                     pSysObjThr->numOfVolCtxSwitch   = (IFX_uint_t)(nVolCtxSw); \
+                     pSysObjThr->numOfInvolCtxSwitch = (IFX_uint_t)(nInvolCtxSw); \
+                  } \
+               } while (0)
+
+#  define IFXOS_SYS_THREAD_WAKEUP_LATENCY_ADD(pIFXOS_SysObject, latency_us)\
+               /*lint -e{19} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                  { \
+                     IFXOS_sys_object_thread_t *pSysObjThr = &((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjThread; \
+                     pSysObjThr->numOfWakeup++; \
+                     pSysObjThr->wakeupLatencyLast_us = (IFX_uint_t)(latency_us); \
+                     pSysObjThr->wakeupLatencyAvg_us  = pSysObjThr->wakeupLatencyAvg_us - \
+                        (pSysObjThr->wakeupLatencyAvg_us >> 3) + ((IFX_uint_t)(latency_us) >> 3); \
+                     if (pSysObjThr->wakeupLatencyMax_us < (IFX_uint_t)(latency_us)) \
+                        { pSysObjThr->wakeupLatencyMax_us = (IFX_uint_t)(latency_us); } \
+                  } \
+               } while (0)
+
+#  if defined(LINUX) && !defined(__KERNEL__)
+/** points to the sys object of the current IFXOS user thread (IFX_NULL for other threads) */
+extern __thread IFX_void_t *IFXOS_pSysObjectThreadSelf;
+#     define IFXOS_SYS_THREAD_SELF_SET(pIFXOS_SysObject)   IFXOS_pSysObjectThreadSelf = (pIFXOS_SysObject)
+#     define IFXOS_SYS_THREAD_SELF_GET()                   IFXOS_pSysObjectThreadSelf
+#  else
+#     define IFXOS_SYS_THREAD_SELF_SET(pIFXOS_SysObject)   /*lint -e{19} */
+#     define IFXOS_SYS_THREAD_SELF_GET()                   IFX_NULL
+#  endif
+
 #else
 
 #  define IFXOS_SYS_THREAD_PARAMS_SET(pIFXOS_SysObject, pParams)     /*lint -e{19} */
 #  define IFXOS_SYS_THREAD_INIT_COUNT_INC(pIFXOS_SysObject)          /*lint -e{19} */
+#  define IFXOS_SYS_THREAD_TASK_ID_SET(pIFXOS_SysObject, nTaskId)    /*lint -e{19} */
+#  define IFXOS_SYS_THREAD_USAGE_SET(pIFXOS_SysObject, usrTime_ms, sysTime_ms, nVolCtxSw, nInvolCtxSw) /*lint -e{19} */
+#  define IFXOS_SYS_THREAD_WAKEUP_LATENCY_ADD(pIFXOS_SysObject, latency_us) /*lint -e{19} */
+#  define IFXOS_SYS_THREAD_SELF_SET(pIFXOS_SysObject)                /*lint -e{19} */
+#  define IFXOS_SYS_THREAD_SELF_GET()                                IFX_NULL
 #endif
 
 
@@ -334,6 +405,18 @@ typedef struct
    IFX OS SYS debug / trace Memory handling
    ========================================================================= */
 
+#if ( defined(IFXOS_HAVE_MEM_COUNTER) && (IFXOS_HAVE_MEM_COUNTER == 1) )
+/** SysObj memory counter, updated concurrently by the allocations (atomic) */
+typedef IFXOS_MemCounter_t    IFXOS_SysMemCounter_t;
+#  define IFXOS_SYS_MEM_COUNTER_ADD(P_CNT, VAL)    IFXOS_MEM_COUNTER_ADD(P_CNT, VAL)
+#  define IFXOS_SYS_MEM_COUNTER_GET(P_CNT)         IFXOS_MEM_COUNTER_GET(P_CNT)
+#else
+/** SysObj memory counter, no atomic counter available */
+typedef IFX_long_t            IFXOS_SysMemCounter_t;
+#  define IFXOS_SYS_MEM_COUNTER_ADD(P_CNT, VAL)    ((void)(*(P_CNT) += (IFX_long_t)(VAL)))
+#  define IFXOS_SYS_MEM_COUNTER_GET(P_CNT)         (*(P_CNT))
+#endif
+
 /**
    Struct to debug/trace the IFXOS MEM ALLOC handling.
 */
@@ -346,9 +429,9 @@ typedef struct
       statistics
    */
    /** number of mem allocation calls */
-   IFX_uint_t  numOfMemAlloc;
+   IFXOS_SysMemCounter_t   numOfMemAlloc;
    /** number of mem free calls */
-   IFX_uint_t  numOfMemFree;
+   IFXOS_SysMemCounter_t   numOfMemFree;
 
    /**  current size of allocated memory */
    IFX_uint_t  currMemSize;
@@ -360,6 +443,20 @@ typedef struct
    /**  max block size of allocated memory */
    IFX_uint_t  minMemBlockSize;
 
+   /** number of allocations from the slab allocator (Linux Kernel) */
+   IFXOS_SysMemCounter_t   numOfSlabAlloc;
+   /** number of allocations from the virtual memory allocator (Linux Kernel) */
+   IFXOS_SysMemCounter_t   numOfVirtAlloc;
+
+   /** number of large block allocations */
+   IFXOS_SysMemCounter_t   numOfLargeAlloc;
+   /** number of large block frees */
+   IFXOS_SysMemCounter_t   numOfLargeFree;
+   /** number of large block allocations with huge page backing */
+   IFXOS_SysMemCounter_t   numOfLargeHuge;
+   /** current size of the large blocks [byte] */
+   IFXOS_SysMemCounter_t   currLargeSize;
+
 } IFXOS_sys_object_mem_t;
 
 #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) && defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1) )
@@ -368,14 +465,48 @@ typedef struct
                /*lint -e{717} */ \
                do { \
                   if (IFXOS_sysObjectControl.initDone == IFX_TRUE) \
-                     { IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfMemAlloc++; } \
+                     { IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfMemAlloc, 1); } \
                } while (0)
 
 #  define IFXOS_SYS_MEM_FREE_COUNT_INC(pIFXOS_SysObject)\
                /*lint -e{717} */ \
                do { \
                   if (IFXOS_sysObjectControl.initDone == IFX_TRUE) \
-                     { IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfMemFree++; } \
+                     { IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfMemFree, 1); } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_BACKING_COUNT_INC(pIFXOS_SysObject, bVirtual)\
+               /*lint -e{717} */ \
+               do { \
+                  if (IFXOS_sysObjectControl.initDone == IFX_TRUE) \
+                     { \
+                        if (bVirtual) \
+                           { IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfVirtAlloc, 1); } \
+                        else \
+                           { IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfSlabAlloc, 1); } \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_LARGE_ALLOC_ADD(pIFXOS_SysObject, blockSize, bHuge)\
+               /*lint -e{717} */ \
+               do { \
+                  if (IFXOS_sysObjectControl.initDone == IFX_TRUE) \
+                     { \
+                        IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfLargeAlloc, 1); \
+                        IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.currLargeSize, (blockSize)); \
+                        if (bHuge) \
+                           { IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfLargeHuge, 1); } \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_LARGE_FREE_ADD(pIFXOS_SysObject, blockSize)\
+               /*lint -e{717} */ \
+               do { \
+                  if (IFXOS_sysObjectControl.initDone == IFX_TRUE) \
+                     { \
+                        IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.numOfLargeFree, 1); \
+                        IFXOS_SYS_MEM_COUNTER_ADD(&IFXOS_sysObjectBuffer[IFXOS_SYS_OBJECT_IDX_MEMORY].uSysObject.sysObjMemory.currLargeSize, -(IFX_long_t)(blockSize)); \
+                     } \
                } while (0)
 
 #  define IFXOS_SYS_MEM_MAX_BLOCK_SET(pIFXOS_SysObject, blockSize) \
@@ -397,10 +528,132 @@ typedef struct
 
 #  define IFXOS_SYS_MEM_ALLOC_COUNT_INC(pIFXOS_SysObject)            /*lint -e{19} */
 #  define IFXOS_SYS_MEM_FREE_COUNT_INC(pIFXOS_SysObject)             /*lint -e{19} */
+#  define IFXOS_SYS_MEM_BACKING_COUNT_INC(pIFXOS_SysObject, bVirtual)   /*lint -e{19} */
+#  define IFXOS_SYS_MEM_LARGE_ALLOC_ADD(pIFXOS_SysObject, blockSize, bHuge) /*lint -e{19} */
+#  define IFXOS_SYS_MEM_LARGE_FREE_ADD(pIFXOS_SysObject, blockSize)      /*lint -e{19} */
 #  define IFXOS_SYS_MEM_MAX_BLOCK_SET(pIFXOS_SysObject, blockSize)   /*lint -e{19} */
 #  define IFXOS_SYS_MEM_MIN_BLOCK_SET(pIFXOS_SysObject, blockSize)   /*lint -e{19} */
 #endif
 
+/**
+   Struct to debug/trace the IFXOS MEM POOL handling.
+*/
+typedef struct
+{
+   /** points to the pool object */
+   IFX_void_t *pThis;
+
+   /** element size [byte] */
+   IFX_uint_t  elemSize;
+
+   /*
+      statistics
+   */
+   /** number of slabs */
+   IFX_uint_t  numOfSlabs;
+   /** number of elements */
+   IFX_uint_t  numOfElem;
+   /** current number of elements in use */
+   IFX_uint_t  currInUse;
+   /** max number of elements in use (high-water mark) */
+   IFX_uint_t  maxInUse;
+   /** number of allocated elements (from the shared free list) */
+   IFX_uint_t  numOfAlloc;
+   /** number of freed elements (to the shared free list) */
+   IFX_uint_t  numOfFree;
+   /** number of failed alloc calls (pool empty) */
+   IFX_uint_t  numOfAllocFails;
+
+} IFXOS_sys_object_mem_pool_t;
+
+#if ( defined(IFXOS_HAVE_MEM_POOL) && (IFXOS_HAVE_MEM_POOL == 1) && defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1) )
+
+#  define IFXOS_SYS_MEM_POOL_PARAMS_SET(pIFXOS_SysObject, pPool, nElemSize)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.pThis    = (IFX_void_t *)(pPool); \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.elemSize = (IFX_uint_t)(nElemSize); \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_POOL_SLAB_ADD(pIFXOS_SysObject, nElem)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.numOfSlabs++; \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.numOfElem += (nElem); \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_POOL_ALLOC_COUNT_ADD(pIFXOS_SysObject, nCount, nInUse, nMaxInUse)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.numOfAlloc += (nCount); \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.currInUse = (nInUse); \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.maxInUse  = (nMaxInUse); \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_POOL_FREE_COUNT_ADD(pIFXOS_SysObject, nCount, nInUse)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.numOfFree += (nCount); \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.currInUse = (nInUse); \
+                     } \
+               } while (0)
+
+#  define IFXOS_SYS_MEM_POOL_FAIL_COUNT_INC(pIFXOS_SysObject)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemPool.numOfAllocFails++; } \
+               } while (0)
+
+#else
+
+#  define IFXOS_SYS_MEM_POOL_PARAMS_SET(pIFXOS_SysObject, pPool, nElemSize)         /*lint -e{19} */
+#  define IFXOS_SYS_MEM_POOL_SLAB_ADD(pIFXOS_SysObject, nElem)                      /*lint -e{19} */
+#  define IFXOS_SYS_MEM_POOL_ALLOC_COUNT_ADD(pIFXOS_SysObject, nCount, nInUse, nMaxInUse)   /*lint -e{19} */
+#  define IFXOS_SYS_MEM_POOL_FREE_COUNT_ADD(pIFXOS_SysObject, nCount, nInUse)               /*lint -e{19} */
+#  define IFXOS_SYS_MEM_POOL_FAIL_COUNT_INC(pIFXOS_SysObject)                       /*lint -e{19} */
+#endif
+
+
+/**
+   Struct to debug/trace IFXOS memory tags.
+   The counters are kept within the tag (per CPU) and read on show.
+*/
+typedef struct
+{
+   /** points to the user tag object */
+   IFX_void_t  *pThis;
+
+} IFXOS_sys_object_mem_tag_t;
+
+#if ( defined(IFXOS_HAVE_MEM_TAG) && (IFXOS_HAVE_MEM_TAG == 1) && defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1) )
+
+#  define IFXOS_SYS_MEM_TAG_PARAMS_SET(pIFXOS_SysObject, pTag)\
+               /*lint -e{717} */ \
+               do {\
+                  if (pIFXOS_SysObject != IFX_NULL) \
+                     { \
+                        ((IFXOS_sys_object_t *)(pIFXOS_SysObject))->uSysObject.sysObjMemTag.pThis = (IFX_void_t *)(pTag); \
+                        IFXOS_SYS_OBJECT_USER_DESRC_SET(pIFXOS_SysObject, (pTag)->pName, -1); \
+                     } \
+               } while (0)
+
+#else
+
+#  define IFXOS_SYS_MEM_TAG_PARAMS_SET(pIFXOS_SysObject, pTag)                     /*lint -e{19} */
+#endif
+
 /* ============================================================================
    IFX OS SYS debug / trace FIFO handling
    ========================================================================= */
@@ -533,6 +786,12 @@ typedef union
    /** IFXOS MEM debug object */
    IFXOS_sys_object_mem_t      sysObjMemory;
 
+   /** IFXOS MEM POOL debug object */
+   IFXOS_sys_object_mem_pool_t sysObjMemPool;
+
+   /** IFXOS MEM TAG debug object */
+   IFXOS_sys_object_mem_tag_t  sysObjMemTag;
+
 } IFXOS_sys_object_u;
 
 /**
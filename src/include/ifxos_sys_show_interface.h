@@ -48,6 +48,8 @@
 #define IFXOS_SYS_OBJECT_NOT_USED               0x00000000
 #define IFXOS_SYS_OBJECT_OWN                    0x00000001
 #define IFXOS_SYS_OBJECT_MEM_ALLOC              0x00000002
+#define IFXOS_SYS_OBJECT_MEM_POOL               0x00000003
+#define IFXOS_SYS_OBJECT_MEM_TAG                0x00000004
 
 #define IFXOS_SYS_OBJECT_LOCK                   0x00000100
 #define IFXOS_SYS_OBJECT_MUTEX                  0x00000101
@@ -243,6 +243,126 @@ IFX_int32_t IFXOS_ThreadShutdown(
                IFXOS_ThreadCtrl_t *pThrCntrl,
                IFX_uint32_t       waitTime_ms);
 
+#if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) )
+/**
+   Shutdown and terminate a set of threads.
+   All threads are triggered to shutdown first, afterwards the function waits
+   for the end of all threads. So the threads are going down in parallel and
+   the overall wait time is limited by the slowest thread.
+
+\param
+   pThrCntrl   - Array of pointers to the thread control structs.
+                 IFX_NULL entries and not initialized threads are skipped.
+\param
+   nThreads    - Number of entries within the array.
+\param
+   waitTime_ms - Overall time [ms] to wait for "self-shutdown" of the threads.
+
+\return
+   - IFX_SUCCESS all threads were successful deleted.
+   - IFX_ERROR at least one thread was not deleted.
+*/
+IFX_int32_t IFXOS_ThreadDeleteAll(
+               IFXOS_ThreadCtrl_t *pThrCntrl[],
+               IFX_uint32_t       nThreads,
+               IFX_uint32_t       waitTime_ms);
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) ) */
+
+#if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) )
+/**
+   Thread start parameters for the creation of a set of threads
+   (see "IFXOS_ThreadInitBatch").
+*/
+typedef struct
+{
+   /** points to the thread control structure to initialize */
+   IFXOS_ThreadCtrl_t      *pThrCntrl;
+   /** thread / task name */
+   const IFX_char_t        *pName;
+   /** user entry function of the thread / task */
+   IFXOS_ThreadFunction_t  pThreadFunction;
+   /** size of the thread stack */
+   IFX_uint32_t            nStackSize;
+   /** thread priority, 0 will be ignored */
+   IFX_uint32_t            nPriority;
+   /** first argument passed to thread / task entry function */
+   IFX_ulong_t             nArg1;
+   /** second argument passed to thread / task entry function */
+   IFX_ulong_t             nArg2;
+} IFXOS_ThreadStartParams_t;
+
+/**
+   Creates a new thread / task without waiting for the startup of the thread.
+   The startup can be synchronized later (see "IFXOS_ThreadStartWait").
+
+\param
+   pThrCntrl         - Pointer to thread control structure. This structure has to
+                       be allocated outside and will be initialized.
+\param
+   pName             - specifies the 8-char thread / task name
+\param
+   pThreadFunction   - specifies the user entry function of the thread / task
+\param
+   nStackSize        - specifies the size of the thread stack
+\param
+   nPriority         - specifies the thread priority, 0 will be ignored
+\param
+   nArg1             - first argument passed to thread / task entry function
+\param
+   nArg2             - second argument passed to thread / task entry function
+
+\return
+   - IFX_SUCCESS thread was successful created.
+   - IFX_ERROR thread was not created
+*/
+IFX_int32_t IFXOS_ThreadInitAsync(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               const IFX_char_t   *pName,
+               IFXOS_ThreadFunction_t pThreadFunction,
+               IFX_uint32_t   nStackSize,
+               IFX_uint32_t   nPriority,
+               IFX_ulong_t    nArg1,
+               IFX_ulong_t    nArg2);
+
+/**
+   Wait for the startup of a thread created via "IFXOS_ThreadInitAsync".
+
+\param
+   pThrCntrl   - Thread control struct.
+\param
+   waitTime_ms - Time [ms] to wait for the thread startup.
+
+\return
+   - IFX_SUCCESS the thread has been started.
+   - IFX_ERROR invalid thread or startup timeout.
+*/
+IFX_int32_t IFXOS_ThreadStartWait(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               IFX_uint32_t       waitTime_ms);
+
+/**
+   Creates a set of threads / tasks.
+   All threads are created first, afterwards the function waits once for the
+   startup of all threads.
+
+\param
+   pParams     - Array of thread start parameters.
+\param
+   nThreads    - Number of entries within the array.
+\param
+   waitTime_ms - Overall time [ms] to wait for the startup of the threads.
+
+\return
+   - IFX_SUCCESS all threads were successful started.
+   - IFX_ERROR at least one thread was not started, the already created
+     threads are shut down and deleted (within waitTime_ms).
+*/
+IFX_int32_t IFXOS_ThreadInitBatch(
+               const IFXOS_ThreadStartParams_t *pParams,
+               IFX_uint32_t                    nThreads,
+               IFX_uint32_t                    waitTime_ms);
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) ) */
+
 /**
    Set own thread / task priority
 
@@ -291,6 +411,77 @@ IFXOS_thread_t IFXOS_ThreadIdGet(void);
 */
 IFXOS_process_t IFXOS_ProcessIdGet(void);
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+/**
+   Destructor of a thread local storage value, called on thread end for
+   each key with a non-NULL value of the thread.
+*/
+typedef IFX_void_t (*IFXOS_TlsDestructor_t)(IFX_void_t *pValue);
+
+/**
+   Create a thread local storage key.
+
+\param
+   pKey           Returns the new key.
+\param
+   pDestructor    Destructor for the thread values on thread end, optional.
+
+\return
+   - IFX_SUCCESS key created.
+   - IFX_ERROR no more keys available.
+*/
+IFX_int32_t IFXOS_TlsKeyCreate(
+               IFXOS_TlsKey_t          *pKey,
+               IFXOS_TlsDestructor_t   pDestructor);
+
+/**
+   Delete a thread local storage key.
+
+\param
+   key            Key to delete.
+
+\return
+   - IFX_SUCCESS key deleted.
+   - IFX_ERROR invalid key.
+
+\remarks
+   The destructor is not called for the current values of the key.
+*/
+IFX_int32_t IFXOS_TlsKeyDelete(
+               IFXOS_TlsKey_t          key);
+
+/**
+   Get the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+
+\return
+   The value of the thread, IFX_NULL if not set.
+*/
+IFX_void_t *IFXOS_TlsGet(
+               IFXOS_TlsKey_t          key);
+
+/**
+   Set the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+\param
+   pValue         Value to set.
+
+\return
+   - IFX_SUCCESS value set.
+   - IFX_ERROR invalid key or no thread local storage for this thread.
+
+\remarks
+   In Linux kernel space the thread local storage is only available for
+   threads which have been created via \ref IFXOS_ThreadInit.
+*/
+IFX_int32_t IFXOS_TlsSet(
+               IFXOS_TlsKey_t          key,
+               IFX_void_t              *pValue);
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) ) */
 
 #endif      /* #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) ) */
 
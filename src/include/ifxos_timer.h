@@ -0,0 +1,347 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+#ifndef _IFXOS_TIMER_H
+#define _IFXOS_TIMER_H
+
+/** \file
+   This file contains definitions for the timer service (callback timers).
+*/
+
+/** \defgroup IFXOS_IF_TIMER Timer Service.
+
+   This Group contains the timer service definitions and functions.
+
+\par IFXOS Timer Concept
+
+   A timer service runs any number of one-shot and periodic callback timers
+   without a thread per timer. The timers are kept in a hierarchical timing
+   wheel (\ref IFXOS_TIMER_WHEEL_LEVELS levels with
+   \ref IFXOS_TIMER_WHEEL_SLOTS slots each) so start and stop of a timer are
+   O(1) operations independent of the number of running timers.
+
+   The timer objects are provided by the user (no memory allocation on start),
+   the service itself uses a single dispatch thread which sleeps until the
+   next timer slot is due. Optionally a pool of worker threads executes the
+   callbacks so a long running callback does not delay other timers.
+
+   The service is based on the IFXOS thread, event, lock and elapsed time
+   functions. Timeouts are rounded up to the tick resolution of the service,
+   periodic timers are re-armed based on their previous expiry time, so they
+   do not drift.
+
+\remarks
+   The callbacks are called without any service lock held, a timer may be
+   started or stopped from within its own callback.
+   A stop does not wait for a callback which is currently executed, therefore
+   a timer must not be released while its callback is running.
+
+\ingroup IFXOS_INTERFACE
+*/
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/* ============================================================================
+   IFX OS adaptation - Includes
+   ========================================================================= */
+#include "ifx_types.h"
+#include "ifxos_thread.h"
+#include "ifxos_event.h"
+#include "ifxos_lock.h"
+#include "ifxos_time.h"
+#include "ifxos_memory_alloc.h"
+
+/* ============================================================================
+   IFX OS adaptation - timer service, defines
+   ========================================================================= */
+/** \addtogroup IFXOS_IF_TIMER
+@{ */
+
+#if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) ) && \
+    ( defined(IFXOS_HAVE_EVENT) && (IFXOS_HAVE_EVENT == 1) ) && \
+    ( defined(IFXOS_HAVE_LOCK) && (IFXOS_HAVE_LOCK == 1) ) && \
+    ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) && \
+    ( defined(IFXOS_HAVE_TIME_ELAPSED_TIME_GET_MS) && (IFXOS_HAVE_TIME_ELAPSED_TIME_GET_MS == 1) )
+#  ifndef IFXOS_HAVE_TIMER
+#     define IFXOS_HAVE_TIMER                        1
+#  endif
+#endif
+
+#if ( defined(IFXOS_HAVE_TIMER) && (IFXOS_HAVE_TIMER == 1) )
+
+/** Number of bits of a timing wheel level index */
+#define IFXOS_TIMER_WHEEL_BITS                  6
+/** Number of slots per timing wheel level */
+#define IFXOS_TIMER_WHEEL_SLOTS                 (1 << IFXOS_TIMER_WHEEL_BITS)
+/** Number of timing wheel levels, max timeout is 2^24 ticks */
+#define IFXOS_TIMER_WHEEL_LEVELS                4
+
+/** Default tick resolution of a timer service [ms] */
+#define IFXOS_TIMER_DEFAULT_TICK_MS             10
+/** Max sleep time of the service threads if no timer is pending [ms] */
+#define IFXOS_TIMER_IDLE_WAIT_MS                1000
+/** Max time to wait for the service threads on delete [ms] */
+#define IFXOS_TIMER_THREAD_DELETE_WAIT_MS       3000
+
+/** Timer state - not started */
+#define IFXOS_TIMER_STATE_IDLE                  0
+/** Timer state - pending within the timing wheel */
+#define IFXOS_TIMER_STATE_PENDING               1
+/** Timer state - expired, callback is queued */
+#define IFXOS_TIMER_STATE_READY                 2
+/** Timer state - callback of a periodic timer is running, re-armed afterwards */
+#define IFXOS_TIMER_STATE_RUNNING               3
+
+/* ============================================================================
+   IFX OS adaptation - timer service, typedefs
+   ========================================================================= */
+
+/** forward declaration of the timer object */
+struct IFXOS_Timer_s;
+/** forward declaration of the timer service object */
+struct IFXOS_TimerService_s;
+
+/**
+   Timer callback function.
+
+\param
+   pTimer   Points to the expired timer.
+\param
+   nArg     User argument given with \ref IFXOS_TimerInit.
+*/
+typedef IFX_void_t (*IFXOS_TimerCallback_t)(
+               struct IFXOS_Timer_s *pTimer,
+               IFX_ulong_t          nArg);
+
+/**
+   Double linked list node / head of the timer lists (intrusive).
+*/
+typedef struct IFXOS_TimerList_s
+{
+   /** next list element */
+   struct IFXOS_TimerList_s *pNext;
+   /** previous list element */
+   struct IFXOS_TimerList_s *pPrev;
+} IFXOS_TimerList_t;
+
+/**
+   Running callback, kept on the stack of the calling service thread.
+   The timer object is not accessed after the callback return, except for
+   the re-arm of a periodic timer which has not been stopped.
+*/
+typedef struct IFXOS_TimerRun_s
+{
+   /** next running callback */
+   struct IFXOS_TimerRun_s       *pNext;
+   /** timer of the callback */
+   struct IFXOS_Timer_s          *pTimer;
+   /** re-arm the periodic timer after the callback */
+   IFX_boolean_t                 bRearm;
+} IFXOS_TimerRun_t;
+
+/**
+   Timer object, provided by the user.
+*/
+typedef struct IFXOS_Timer_s
+{
+   /** list node - timing wheel slot or ready list, must be the first element */
+   IFXOS_TimerList_t             node;
+   /** timer service which runs this timer */
+   struct IFXOS_TimerService_s   *pService;
+   /** user callback */
+   IFXOS_TimerCallback_t         pCallback;
+   /** user callback argument */
+   IFX_ulong_t                   nArg;
+   /** expiry time [ticks] */
+   IFX_uint32_t                  expires;
+   /** period [ticks], 0 for a one-shot timer */
+   IFX_uint32_t                  period;
+   /** timer state, see IFXOS_TIMER_STATE_xxx */
+   IFX_int_t                     state;
+   /** valid flag */
+   IFX_boolean_t                 bValid;
+} IFXOS_Timer_t;
+
+/**
+   Timer service object.
+*/
+typedef struct IFXOS_TimerService_s
+{
+   /** valid flag */
+   IFX_boolean_t        bValid;
+   /** shutdown request for the service threads */
+   volatile IFX_boolean_t bShutDown;
+   /** tick resolution [ms] */
+   IFX_uint32_t         tick_ms;
+   /** current time [ticks] */
+   IFX_uint32_t         nowTick;
+   /** part of the current tick which is already elapsed [ms] */
+   IFX_uint32_t         partTick_ms;
+   /** time of the last time update [ms] */
+   IFX_time_t           lastTime_ms;
+   /** next tick to be processed by the timing wheel */
+   IFX_uint32_t         runTick;
+   /** tick the dispatch thread waits for */
+   IFX_uint32_t         wakeTick;
+   /** number of timers pending within the timing wheel */
+   IFX_uint32_t         nPending;
+   /** timing wheel */
+   IFXOS_TimerList_t    wheel[IFXOS_TIMER_WHEEL_LEVELS][IFXOS_TIMER_WHEEL_SLOTS];
+   /** expired timers, callback not yet called */
+   IFXOS_TimerList_t    readyList;
+   /** running callbacks */
+   IFXOS_TimerRun_t     *pRunList;
+   /** protects the timing wheel and the timer states */
+   IFXOS_lock_t         lock;
+   /** wakeup of the dispatch thread */
+   IFXOS_event_t        dispatchEvent;
+   /** wakeup of the worker threads */
+   IFXOS_event_t        workerEvent;
+   /** dispatch thread */
+   IFXOS_ThreadCtrl_t   dispatchThread;
+   /** number of worker threads, 0: callbacks are called by the dispatch thread */
+   IFX_uint32_t         nWorkers;
+   /** worker threads */
+   IFXOS_ThreadCtrl_t   *pWorkerThreads;
+} IFXOS_TimerService_t;
+
+/* ============================================================================
+   IFX OS adaptation - timer service, functions
+   ========================================================================= */
+
+/**
+   Create a timer service and start the service threads.
+
+\param
+   pService    Points to the timer service object.
+\param
+   pName       Name of the service threads.
+\param
+   tick_ms     Tick resolution of the service [ms],
+               0 selects \ref IFXOS_TIMER_DEFAULT_TICK_MS.
+\param
+   nWorkers    Number of worker threads for the callbacks,
+               0: the callbacks are called by the dispatch thread.
+\param
+   nPriority   Priority of the service threads.
+
+\return
+   IFX_SUCCESS if the service has been started, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerServiceInit(
+               IFXOS_TimerService_t *pService,
+               const IFX_char_t     *pName,
+               IFX_uint32_t         tick_ms,
+               IFX_uint32_t         nWorkers,
+               IFX_uint32_t         nPriority);
+
+/**
+   Stop the service threads and delete the timer service.
+
+\param
+   pService    Points to the timer service object.
+
+\return
+   IFX_SUCCESS if the service has been deleted, else
+   IFX_ERROR.
+
+\remarks
+   Timers which are still running are stopped, the callbacks are not called.
+*/
+IFX_int32_t IFXOS_TimerServiceDelete(
+               IFXOS_TimerService_t *pService);
+
+/**
+   Initialize a timer object.
+
+\param
+   pTimer      Points to the timer object.
+\param
+   pService    Points to the timer service which runs the timer.
+\param
+   pCallback   Callback which is called on expiry.
+\param
+   nArg        User argument for the callback.
+
+\return
+   IFX_SUCCESS if the timer has been initialized, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_TimerInit(
+               IFXOS_Timer_t           *pTimer,
+               IFXOS_TimerService_t    *pService,
+               IFXOS_TimerCallback_t   pCallback,
+               IFX_ulong_t             nArg);
+
+/**
+   Start (or restart) a timer.
+
+\param
+   pTimer      Points to the timer object.
+\param
+   timeout_ms  Time until the first expiry [ms].
+\param
+   period_ms   Period of the following expiries [ms],
+               0 for a one-shot timer.
+
+\return
+   IFX_SUCCESS if the timer has been started, else
+   IFX_ERROR.
+
+\remarks
+   A pending timer is restarted with the new values.
+*/
+IFX_int32_t IFXOS_TimerStart(
+               IFXOS_Timer_t  *pTimer,
+               IFX_uint32_t   timeout_ms,
+               IFX_uint32_t   period_ms);
+
+/**
+   Stop a timer.
+
+\param
+   pTimer      Points to the timer object.
+
+\return
+   IFX_SUCCESS if the timer has been stopped, else
+   IFX_ERROR.
+
+\remarks
+   A callback which is currently running is not waited for, but a periodic
+   timer is not re-armed afterwards. The timer object can be freed within
+   its callback after the stop (one-shot timer without a stop), else after
+   \ref IFXOS_TimerIsActive reports the end of the callback.
+*/
+IFX_int32_t IFXOS_TimerStop(
+               IFXOS_Timer_t  *pTimer);
+
+/**
+   Check if a timer is pending or its callback is queued / running.
+
+\param
+   pTimer      Points to the timer object.
+
+\return
+   IFX_TRUE if the timer is active, else IFX_FALSE.
+*/
+IFX_boolean_t IFXOS_TimerIsActive(
+               IFXOS_Timer_t  *pTimer);
+
+#endif      /* #if ( defined(IFXOS_HAVE_TIMER) && (IFXOS_HAVE_TIMER == 1) ) */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif      /* #ifndef _IFXOS_TIMER_H */
+
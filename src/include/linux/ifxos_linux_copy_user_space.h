@@ -0,0 +1,107 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+         Copyright (c) 2009 Lantiq Deutschland GmbH
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+#ifndef _IFXOS_LINUX_COPY_USER_SPACE_H
+#define _IFXOS_LINUX_COPY_USER_SPACE_H
+
+#ifdef LINUX
+
+/** \file
+   This file contains LINUX definitions for Data Exchange between Driver and
+   User Space.
+*/
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - Includes
+   ========================================================================= */
+#include "ifx_types.h"
+
+#ifdef __KERNEL__
+#include <linux/version.h>
+#if LINUX_VERSION_CODE < KERNEL_VERSION(4, 12, 0)
+#include <asm/uaccess.h>
+#else
+#include <linux/uaccess.h>
+#endif
+#else
+#include <string.h>
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - supported features
+   ========================================================================= */
+#ifdef __KERNEL__
+
+   /** IFX LINUX adaptation - Kernel support "vectored copy from / to user" */
+#  ifndef IFXOS_HAVE_CPY_USER_VEC
+#     define IFXOS_HAVE_CPY_USER_VEC                  1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "device control batch" (layout) */
+#  ifndef IFXOS_HAVE_DEV_CTRL_BATCH
+#     define IFXOS_HAVE_DEV_CTRL_BATCH                1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "device control batch execution" */
+#  ifndef IFXOS_HAVE_DEV_CTRL_BATCH_EXEC
+#     define IFXOS_HAVE_DEV_CTRL_BATCH_EXEC           1
+#  endif
+
+#else
+
+   /** IFX LINUX adaptation - User support "vectored copy from / to user" */
+#  ifndef IFXOS_HAVE_CPY_USER_VEC
+#     define IFXOS_HAVE_CPY_USER_VEC                  1
+#  endif
+
+   /** IFX LINUX adaptation - User support "device control batch" (layout) */
+#  ifndef IFXOS_HAVE_DEV_CTRL_BATCH
+#     define IFXOS_HAVE_DEV_CTRL_BATCH                1
+#  endif
+
+#endif
+
+#ifdef __KERNEL__
+/* ============================================================================
+   IFX LINUX adaptation - copy from / to user, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - copy of a fixed size block from user space, the constant
+    size allows the inline copy of "copy_from_user" */
+#define IFXOS_CPY_FROM_USER_FIXED(P_TO, P_FROM, SIZE) \
+            ((copy_from_user((P_TO), (P_FROM), (SIZE)) == 0) ? IFX_SUCCESS : IFX_ERROR)
+/** LINUX Kernel - copy of a fixed size block to user space, the constant
+    size allows the inline copy of "copy_to_user" */
+#define IFXOS_CPY_TO_USER_FIXED(P_TO, P_FROM, SIZE) \
+            ((copy_to_user((P_TO), (P_FROM), (SIZE)) == 0) ? IFX_SUCCESS : IFX_ERROR)
+
+#else
+/* ============================================================================
+   IFX LINUX adaptation - copy from / to user, User
+   ========================================================================= */
+
+/** LINUX User - copy of a fixed size block from user space (simulation) */
+#define IFXOS_CPY_FROM_USER_FIXED(P_TO, P_FROM, SIZE) \
+            ((void)memcpy((P_TO), (P_FROM), (SIZE)), IFX_SUCCESS)
+/** LINUX User - copy of a fixed size block to user space (simulation) */
+#define IFXOS_CPY_TO_USER_FIXED(P_TO, P_FROM, SIZE) \
+            ((void)memcpy((P_TO), (P_FROM), (SIZE)), IFX_SUCCESS)
+
+#endif      /* #ifdef __KERNEL__ */
+
+#ifdef __cplusplus
+}
+#endif
+#endif      /* #ifdef LINUX */
+#endif      /* #ifndef _IFXOS_LINUX_COPY_USER_SPACE_H */
+
@@ -40,6 +40,8 @@
 #  include "ifxos_device_io.h"
 #else
 #  include <sys/select.h>
+#  include <sys/epoll.h>
+#  include "ifxos_mutex.h"
 #endif
 
 #include <sys/ioctl.h>
@@ -58,6 +60,23 @@
 #  define IFXOS_HAVE_DEVICE_ACCESS_SELECT          1
 #endif
 
+/** IFX LINUX adaptation - User support "device access - poll set" */
+#ifndef IFXOS_HAVE_DEVICE_ACCESS_POLL
+#  define IFXOS_HAVE_DEVICE_ACCESS_POLL            1
+#endif
+
+/** IFX LINUX adaptation - User support "device access - control batch" */
+#ifndef IFXOS_HAVE_DEVICE_ACCESS_BATCH
+#  define IFXOS_HAVE_DEVICE_ACCESS_BATCH           1
+#endif
+
+#if !(defined(IFXOS_USE_DEV_IO) && (IFXOS_USE_DEV_IO == 1))
+/** IFX LINUX adaptation - User support "device access - shared ring" (device mmap) */
+#ifndef IFXOS_HAVE_DEVICE_ACCESS_SHM_RING
+#  define IFXOS_HAVE_DEVICE_ACCESS_SHM_RING        1
+#endif
+#endif
+
 /* ============================================================================
    IFX LINUX adaptation - types
    ========================================================================= */
@@ -72,11 +91,35 @@
 /** eCos User - select, type fd_set for device select. */
 typedef DEVIO_fd_set_t       IFXOS_devFd_set_t;
 
+/** LINUX User - poll set, based on a DEVIO poll set. */
+typedef struct
+{
+   /** DEVIO poll set */
+   DEVIO_poll_set_t  *pSet;
+   /** valid flag */
+   IFX_boolean_t     bValid;
+} IFXOS_devPoll_t;
+
 #else
 
 /** LINUX User - select, type fd_set for device select. */
 typedef fd_set       IFXOS_devFd_set_t;
 
+/** LINUX User - poll set, based on epoll. */
+typedef struct
+{
+   /** epoll descriptor */
+   IFX_int_t         epFd;
+   /** registered devices, indexed by the device file descriptor */
+   IFX_void_t        *pEntries;
+   /** number of entries of pEntries */
+   IFX_uint32_t      nEntries;
+   /** protects the table against a concurrent wait */
+   IFXOS_mutex_t     mutex;
+   /** valid flag */
+   IFX_boolean_t     bValid;
+} IFXOS_devPoll_t;
+
 #endif
 
 #ifdef __cplusplus
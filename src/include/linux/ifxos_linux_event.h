@@ -146,6 +146,9 @@ typedef struct
 
    /** points to the internal system object - for debugging */
    IFX_void_t    *pSysObject;
+
+   /** time stamp [us] of the last wakeup - for debugging */
+   IFX_uint32_t  wakeupTime_us;
 } IFXOS_event_t;
 
 /** @} */
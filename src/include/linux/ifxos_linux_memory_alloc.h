@@ -42,6 +42,11 @@
 \par Implementation - Memory allocation
    The standard memory allocation "malloc" and "free" is used.
 
+\par Implementation - Physical to virtual address mapping
+   If a mapping device is set (see \ref IFXOS_Phy2VirtDeviceSet), the physical
+   address range is mapped via "mmap" of the device ("/dev/mem", an UIO device
+   or a file as stand-in), else the physical address is assigned directly.
+
 \ingroup IFXOS_MEMORY_LINUX
 */
 
@@ -54,8 +59,13 @@
    returns a continuous memory space (important for HW interfaces).
 
 \par Implementation - Standard memory allocation
-   For standard memory allocation the virtual memory alloc function is used
-   see "vmalloc"
+   For standard memory allocation the kernel memory alloc function is used
+   for small blocks, see "kmalloc", and the virtual memory alloc function for
+   large blocks, see "vmalloc"
+
+\par Implementation - Large memory allocation
+   Large blocks are allocated with "vmalloc" or, if physically contiguous
+   memory is requested, with "alloc_pages_exact"
 
 \par Implementation - Block memory allocation
    For block memory allocation the kernel memory alloc function is used
@@ -118,9 +128,14 @@
 
 #ifdef __KERNEL__
 #include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/cache.h>
+#include <linux/irqflags.h>
+#include <linux/smp.h>
+#include <linux/cpumask.h>
 #include <asm/io.h>
 #else
-
+#include <pthread.h>
 #endif
 
 /* ============================================================================
@@ -136,6 +151,41 @@
    /** IFX LINUX adaptation - Kernel support "mem space alloc" */
 #  ifndef IFXOS_HAVE_MEM_ALLOC
 #     define IFXOS_HAVE_MEM_ALLOC                     1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "mem space alloc for a given call site" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_CALLER
+#     define IFXOS_HAVE_MEM_ALLOC_CALLER              1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "mem space alloc with flags" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_FLAGS
+#     define IFXOS_HAVE_MEM_ALLOC_FLAGS               1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "aligned mem space alloc" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_ALIGNED
+#     define IFXOS_HAVE_MEM_ALLOC_ALIGNED             1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "large mem space alloc" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_LARGE
+#     define IFXOS_HAVE_MEM_ALLOC_LARGE               1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "fixed size memory pool" */
+#  ifndef IFXOS_HAVE_MEM_POOL
+#     define IFXOS_HAVE_MEM_POOL                      1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "memory pool per CPU cache" */
+#  ifndef IFXOS_HAVE_MEM_POOL_CPU_CACHE
+#     define IFXOS_HAVE_MEM_POOL_CPU_CACHE            1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "atomic memory counter" */
+#  ifndef IFXOS_HAVE_MEM_COUNTER
+#     define IFXOS_HAVE_MEM_COUNTER                   1
 #  endif
 
 #else
@@ -150,8 +200,166 @@
 #     define IFXOS_HAVE_MEM_ALLOC                     1
 #  endif
 
+   /** IFX LINUX adaptation - User support "mem space alloc for a given call site" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_CALLER
+#     define IFXOS_HAVE_MEM_ALLOC_CALLER              1
+#  endif
+
+   /** IFX LINUX adaptation - User support "mem space alloc with flags" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_FLAGS
+#     define IFXOS_HAVE_MEM_ALLOC_FLAGS               1
+#  endif
+
+   /** IFX LINUX adaptation - User support "aligned mem space alloc" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_ALIGNED
+#     define IFXOS_HAVE_MEM_ALLOC_ALIGNED             1
+#  endif
+
+   /** IFX LINUX adaptation - User support "large mem space alloc" */
+#  ifndef IFXOS_HAVE_MEM_ALLOC_LARGE
+#     define IFXOS_HAVE_MEM_ALLOC_LARGE               1
+#  endif
+
+   /** IFX LINUX adaptation - User support "fixed size memory pool" */
+#  ifndef IFXOS_HAVE_MEM_POOL
+#     define IFXOS_HAVE_MEM_POOL                      1
+#  endif
+
+   /** IFX LINUX adaptation - User support "atomic memory counter" */
+#  ifndef IFXOS_HAVE_MEM_COUNTER
+#     define IFXOS_HAVE_MEM_COUNTER                   1
+#  endif
+
+#endif
+
+#ifdef __KERNEL__
+/* ============================================================================
+   IFX LINUX adaptation - memory allocation flags, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - allocation flags for IFXOS_MemAllocFlags (GFP flags) */
+typedef gfp_t           IFXOS_MemAllocFlags_t;
+
+/** LINUX Kernel - allocation flags, normal context (may sleep) */
+#define IFXOS_MEM_ALLOC_FLAGS_DEFAULT                 GFP_KERNEL
+/** LINUX Kernel - allocation flags, atomic context (no sleep, slab only) */
+#define IFXOS_MEM_ALLOC_FLAGS_ATOMIC                  GFP_ATOMIC
+
+/** LINUX Kernel - IFXOS_MemAlloc uses the slab allocator (kmalloc) up to
+    this size [byte] and vmalloc above */
+#ifndef IFXOS_MEM_ALLOC_SLAB_MAX_SIZE
+#  define IFXOS_MEM_ALLOC_SLAB_MAX_SIZE               (4 * PAGE_SIZE)
+#endif
+
+/** LINUX Kernel - GFP zone of IFXOS_MemAllocLarge with IFXOS_MEM_LARGE_FLAG_DMA */
+#ifndef IFXOS_MEM_LARGE_GFP_DMA
+#  ifdef CONFIG_ZONE_DMA32
+#     define IFXOS_MEM_LARGE_GFP_DMA                  GFP_DMA32
+#  else
+#     define IFXOS_MEM_LARGE_GFP_DMA                  0
+#  endif
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - memory pool lock, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - cache line size for the memory pool alignment */
+#define IFXOS_MEM_CACHE_LINE_SIZE                     L1_CACHE_BYTES
+
+/** LINUX Kernel - memory pool lock, spinlock (usable within atomic context) */
+typedef spinlock_t      IFXOS_PoolLock_t;
+/** LINUX Kernel - memory pool lock, saved interrupt state */
+typedef unsigned long   IFXOS_PoolLockFlags_t;
+
+#define IFXOS_POOL_LOCK_INIT(P_LOCK)                  spin_lock_init(P_LOCK)
+#define IFXOS_POOL_LOCK_DELETE(P_LOCK)                do {} while (0)
+#define IFXOS_POOL_LOCK_GET(P_LOCK, FLAGS)            spin_lock_irqsave(P_LOCK, FLAGS)
+#define IFXOS_POOL_LOCK_RELEASE(P_LOCK, FLAGS)        spin_unlock_irqrestore(P_LOCK, FLAGS)
+
+/** LINUX Kernel - number of per CPU caches */
+#define IFXOS_POOL_CPU_NUM()                          nr_cpu_ids
+/** LINUX Kernel - index of the current CPU (only within CACHE_ENTER / LEAVE) */
+#define IFXOS_POOL_CPU_ID()                           smp_processor_id()
+/** LINUX Kernel - lock the per CPU cache (no migration, no interrupt) */
+#define IFXOS_POOL_CPU_CACHE_ENTER(FLAGS)             local_irq_save(FLAGS)
+/** LINUX Kernel - unlock the per CPU cache */
+#define IFXOS_POOL_CPU_CACHE_LEAVE(FLAGS)             local_irq_restore(FLAGS)
+
+/* ============================================================================
+   IFX LINUX adaptation - atomic memory counter, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - atomic memory counter */
+typedef atomic_long_t   IFXOS_MemCounter_t;
+
+#define IFXOS_MEM_COUNTER_ADD(P_CNT, VAL)             atomic_long_add((long)(VAL), P_CNT)
+#define IFXOS_MEM_COUNTER_GET(P_CNT)                  ((IFX_long_t)atomic_long_read(P_CNT))
+#define IFXOS_MEM_COUNTER_SET(P_CNT, VAL)             atomic_long_set(P_CNT, (long)(VAL))
+/** LINUX Kernel - current CPU, selects the counter slot (migration allowed) */
+#define IFXOS_MEM_COUNTER_CPU_ID()                    ((IFX_uint_t)raw_smp_processor_id())
+
+/** LINUX Kernel - call site of the allocation (leak tracker) */
+#define IFXOS_MEM_TRACK_CALLER()                      ((IFX_void_t *)__builtin_return_address(0))
+/** LINUX Kernel - print format of a call site, resolved to symbol + offset */
+#define IFXOS_MEM_TRACK_CALLER_FMT                    "%pS"
+
+#else
+/* ============================================================================
+   IFX LINUX adaptation - memory allocation flags, User
+   ========================================================================= */
+
+/** LINUX User - allocation flags for IFXOS_MemAllocFlags (not used) */
+typedef IFX_uint32_t    IFXOS_MemAllocFlags_t;
+
+/** LINUX User - allocation flags, normal context */
+#define IFXOS_MEM_ALLOC_FLAGS_DEFAULT                 0
+/** LINUX User - allocation flags, atomic context */
+#define IFXOS_MEM_ALLOC_FLAGS_ATOMIC                  0
+
+/** LINUX User - huge page size for IFXOS_MemAllocLarge [byte] */
+#ifndef IFXOS_MEM_HUGE_PAGE_SIZE
+#  define IFXOS_MEM_HUGE_PAGE_SIZE                    (2 * 1024 * 1024)
 #endif
 
+/* ============================================================================
+   IFX LINUX adaptation - memory pool lock, User
+   ========================================================================= */
+
+/** LINUX User - cache line size for the memory pool alignment */
+#define IFXOS_MEM_CACHE_LINE_SIZE                     64
+
+/** LINUX User - memory pool lock, pthread mutex */
+typedef pthread_mutex_t IFXOS_PoolLock_t;
+/** LINUX User - memory pool lock, not used */
+typedef int             IFXOS_PoolLockFlags_t;
+
+#define IFXOS_POOL_LOCK_INIT(P_LOCK)                  pthread_mutex_init(P_LOCK, NULL)
+#define IFXOS_POOL_LOCK_DELETE(P_LOCK)                pthread_mutex_destroy(P_LOCK)
+#define IFXOS_POOL_LOCK_GET(P_LOCK, FLAGS)            do { (FLAGS) = 0; pthread_mutex_lock(P_LOCK); } while (0)
+#define IFXOS_POOL_LOCK_RELEASE(P_LOCK, FLAGS)        do { (void)(FLAGS); pthread_mutex_unlock(P_LOCK); } while (0)
+
+/* ============================================================================
+   IFX LINUX adaptation - atomic memory counter, User
+   ========================================================================= */
+
+/** LINUX User - atomic memory counter */
+typedef volatile long   IFXOS_MemCounter_t;
+
+#define IFXOS_MEM_COUNTER_ADD(P_CNT, VAL)             ((void)__sync_fetch_and_add(P_CNT, (long)(VAL)))
+#define IFXOS_MEM_COUNTER_GET(P_CNT)                  ((IFX_long_t)(*(P_CNT)))
+#define IFXOS_MEM_COUNTER_SET(P_CNT, VAL)             ((void)(*(P_CNT) = (long)(VAL)))
+/** LINUX User - current CPU, selects the counter slot
+    (sched_getcpu requires _GNU_SOURCE) */
+#define IFXOS_MEM_COUNTER_CPU_ID()                    ((IFX_uint_t)sched_getcpu())
+
+/** LINUX User - call site of the allocation (leak tracker) */
+#define IFXOS_MEM_TRACK_CALLER()                      ((IFX_void_t *)__builtin_return_address(0))
+/** LINUX User - print format of a call site (resolve via addr2line) */
+#define IFXOS_MEM_TRACK_CALLER_FMT                    "%p"
+
+#endif      /* #ifdef __KERNEL__ */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,139 @@
+/****************************************************************************
+
+         Copyright (c) 2021 MaxLinear, Inc.
+         Copyright (c) 2009 Lantiq Deutschland GmbH
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+*****************************************************************************/
+#ifndef _IFXOS_LINUX_MEMORY_MAP_H
+#define _IFXOS_LINUX_MEMORY_MAP_H
+
+#ifdef LINUX
+
+/** \file
+   This file contains LINUX definitions for Physical to Virtual Address
+   Mapping and the access to mapped registers.
+*/
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - Includes
+   ========================================================================= */
+#include "ifx_types.h"
+
+#ifdef __KERNEL__
+#include <asm/io.h>
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - supported features
+   ========================================================================= */
+#ifdef __KERNEL__
+
+   /** IFX LINUX adaptation - Kernel support "batched register access" */
+#  ifndef IFXOS_HAVE_REG_BATCH
+#     define IFXOS_HAVE_REG_BATCH                     1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "shared ring" */
+#  ifndef IFXOS_HAVE_SHM_RING
+#     define IFXOS_HAVE_SHM_RING                      1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel support "shared ring, mapped to user space" */
+#  ifndef IFXOS_HAVE_DRV_SHM_RING
+#     define IFXOS_HAVE_DRV_SHM_RING                  1
+#  endif
+
+#else
+
+   /** IFX LINUX adaptation - User support "batched register access" */
+#  ifndef IFXOS_HAVE_REG_BATCH
+#     define IFXOS_HAVE_REG_BATCH                     1
+#  endif
+
+   /** IFX LINUX adaptation - User support "shared ring" */
+#  ifndef IFXOS_HAVE_SHM_RING
+#     define IFXOS_HAVE_SHM_RING                      1
+#  endif
+
+   /** IFX LINUX adaptation - User support "memory map via device (/dev/mem, UIO)" */
+#  ifndef IFXOS_HAVE_MEMORY_MAP_DEVICE
+#     define IFXOS_HAVE_MEMORY_MAP_DEVICE             1
+#  endif
+
+#endif
+
+#ifdef __KERNEL__
+/* ============================================================================
+   IFX LINUX adaptation - register access, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - 32 bit register read, native byte order, no barrier */
+#define IFXOS_REG_RAW_READ32(P_ADDR)                  __raw_readl((const volatile void __iomem *)(P_ADDR))
+/** LINUX Kernel - 32 bit register write, native byte order, no barrier */
+#define IFXOS_REG_RAW_WRITE32(P_ADDR, VAL)            __raw_writel((VAL), (volatile void __iomem *)(P_ADDR))
+/** LINUX Kernel - register access barrier (orders all prior accesses) */
+#define IFXOS_REG_BARRIER()                           mb()
+
+/* ============================================================================
+   IFX LINUX adaptation - shared ring, Kernel
+   ========================================================================= */
+
+/** LINUX Kernel - shared ring, full barrier (orders loads and stores) */
+#define IFXOS_SHM_RING_MB()                           smp_mb()
+/** LINUX Kernel - shared ring, write barrier (record before the index) */
+#define IFXOS_SHM_RING_WMB()                          smp_wmb()
+/** LINUX Kernel - shared ring, read barrier (index before the record) */
+#define IFXOS_SHM_RING_RMB()                          smp_rmb()
+
+struct vm_area_struct;
+/** LINUX Kernel - mmap argument of the driver (virtual memory area) */
+typedef struct vm_area_struct                         IFXOS_drvMmapArg_t;
+
+#else
+/* ============================================================================
+   IFX LINUX adaptation - physical to virtual address mapping, User
+   ========================================================================= */
+
+/** LINUX User - default device for IFXOS_Phy2VirtMap, for example "/dev/mem".
+    IFX_NULL keeps the direct assignment of the physical address (simulation) */
+#ifndef IFXOS_PHY2VIRT_DEVICE_DEFAULT
+#  define IFXOS_PHY2VIRT_DEVICE_DEFAULT               IFX_NULL
+#endif
+
+/* ============================================================================
+   IFX LINUX adaptation - register access, User
+   ========================================================================= */
+
+/** LINUX User - 32 bit register read, native byte order, no barrier */
+#define IFXOS_REG_RAW_READ32(P_ADDR)                  (*(const volatile IFX_uint32_t *)(P_ADDR))
+/** LINUX User - 32 bit register write, native byte order, no barrier */
+#define IFXOS_REG_RAW_WRITE32(P_ADDR, VAL)            (*(volatile IFX_uint32_t *)(P_ADDR) = (VAL))
+/** LINUX User - register access barrier (orders all prior accesses) */
+#define IFXOS_REG_BARRIER()                           __sync_synchronize()
+
+/* ============================================================================
+   IFX LINUX adaptation - shared ring, User
+   ========================================================================= */
+
+/** LINUX User - shared ring, full barrier (orders loads and stores) */
+#define IFXOS_SHM_RING_MB()                           __sync_synchronize()
+/** LINUX User - shared ring, write barrier (record before the index) */
+#define IFXOS_SHM_RING_WMB()                          __sync_synchronize()
+/** LINUX User - shared ring, read barrier (index before the record) */
+#define IFXOS_SHM_RING_RMB()                          __sync_synchronize()
+
+#endif      /* #ifdef __KERNEL__ */
+
+#ifdef __cplusplus
+}
+#endif
+#endif      /* #ifdef LINUX */
+#endif      /* #ifndef _IFXOS_LINUX_MEMORY_MAP_H */
+
@@ -67,6 +67,21 @@
    /** IFX LINUX adaptation - Kernel Space, support "Thread/Task feature" */
 #  ifndef IFXOS_HAVE_THREAD
 #     define IFXOS_HAVE_THREAD                       1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel Space, support "Thread/Task delete all" */
+#  ifndef IFXOS_HAVE_THREAD_DELETE_ALL
+#     define IFXOS_HAVE_THREAD_DELETE_ALL            1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel Space, support "Thread/Task asynchronous start" */
+#  ifndef IFXOS_HAVE_THREAD_ASYNC_START
+#     define IFXOS_HAVE_THREAD_ASYNC_START           1
+#  endif
+
+   /** IFX LINUX adaptation - Kernel Space, support "Thread Local Storage" */
+#  ifndef IFXOS_HAVE_THREAD_TLS
+#     define IFXOS_HAVE_THREAD_TLS                   1
 #  endif
 
 #else
@@ -74,6 +89,21 @@
    /** IFX LINUX adaptation - User Space, support "Thread/Task feature" */
 #  ifndef IFXOS_HAVE_THREAD
 #     define IFXOS_HAVE_THREAD                       1
+#  endif
+
+   /** IFX LINUX adaptation - User Space, support "Thread/Task delete all" */
+#  ifndef IFXOS_HAVE_THREAD_DELETE_ALL
+#     define IFXOS_HAVE_THREAD_DELETE_ALL            1
+#  endif
+
+   /** IFX LINUX adaptation - User Space, support "Thread/Task asynchronous start" */
+#  ifndef IFXOS_HAVE_THREAD_ASYNC_START
+#     define IFXOS_HAVE_THREAD_ASYNC_START           1
+#  endif
+
+   /** IFX LINUX adaptation - User Space, support "Thread Local Storage" */
+#  ifndef IFXOS_HAVE_THREAD_TLS
+#     define IFXOS_HAVE_THREAD_TLS                   1
 #  endif
 
 #endif      /* #ifdef __KERNEL__ */
@@ -140,6 +170,16 @@ typedef int    IFXOS_process_t;
 */
 typedef int (*IFXOS_KERNEL_THREAD_StartRoutine)(void *);
 
+/** LINUX Kernel Thread - max number of TLS keys */
+#define IFXOS_TLS_KEYS_MAX                         16
+/** LINUX Kernel Thread - max number of concurrent IFXOS threads with TLS */
+#define IFXOS_TLS_THREADS_MAX                      128
+
+/**
+   LINUX Kernel Thread - TLS key (index into the per thread value table).
+*/
+typedef IFX_int_t    IFXOS_TlsKey_t;
+
 /**
    LINUX Kernel Thread - Control struct for thread handling.
 */
@@ -163,6 +203,9 @@ typedef struct
    /** LINUX specific internal data - completion handling */
    struct completion       thrCompletion;
 
+   /** thread local storage values */
+   IFX_void_t              *pTlsValue[IFXOS_TLS_KEYS_MAX];
+
    /** flag indicates that the structure is initialized */
    IFX_boolean_t           bValid;
 
@@ -211,6 +254,11 @@ typedef struct
 */
 typedef pthread_t    IFXOS_thread_t;
 
+/**
+   LINUX User Thread - map the TLS key.
+*/
+typedef pthread_key_t   IFXOS_TlsKey_t;
+
 /**
    LINUX Kernel Process - map the Process ID.
 */
@@ -241,9 +289,15 @@ typedef struct
    /** flag indicates that the structure is initialized */
    IFX_boolean_t           bValid;
 
+   /** startup handshake of an asynchronous created thread not yet received */
+   IFX_boolean_t           bStartPending;
+
    /** locking between root thread and new thread */
    sem_t                   thread_active;
 
+   /** signaled by the new thread after the user thread routine has returned */
+   sem_t                   thread_done;
+
 } IFXOS_ThreadCtrl_t;
 
 /** @} */
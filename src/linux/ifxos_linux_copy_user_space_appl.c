@@ -115,6 +115,98 @@ IFX_void_t *IFXOS_CpyToUser(
    return ((IFX_void_t *)memcpy((void *)pTo, (const void *)pFrom, size_byte));
 }
 
+#if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) )
+/**
+   Linux Appl - Copy a set of blocks between user and driver space.
+
+\par Implementation
+   All blocks are checked first, then copied via memcpy.
+*/
+static IFX_int32_t IFXOS_CpyUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec,
+               IFX_boolean_t              bToUser)
+{
+   IFX_uint32_t   i;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pVec, IFX_ERROR);
+
+   for (i = 0; i < numOfVec; i++)
+   {
+      if ( (pVec[i].size_byte != 0) &&
+           ((pVec[i].pDrv == IFX_NULL) || (pVec[i].pUser == IFX_NULL)) )
+      {
+         return IFX_ERROR;
+      }
+   }
+
+   for (i = 0; i < numOfVec; i++)
+   {
+      if (pVec[i].size_byte == 0)
+      {
+         continue;
+      }
+
+      if (bToUser == IFX_TRUE)
+      {
+         memcpy(pVec[i].pUser, pVec[i].pDrv, pVec[i].size_byte);
+      }
+      else
+      {
+         memcpy(pVec[i].pDrv, pVec[i].pUser, pVec[i].size_byte);
+      }
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Linux Appl - Copy a set of blocks FROM USER space (application) to
+   driver space (kernel).
+
+\par Implementation
+   A simple memcpy per block is used.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyFromUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec)
+{
+   return IFXOS_CpyUserVec(pVec, numOfVec, IFX_FALSE);
+}
+
+/**
+   Linux Appl - Copy a set of blocks from driver space (kernel) TO USER
+   space (application).
+
+\par Implementation
+   A simple memcpy per block is used.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyToUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec)
+{
+   return IFXOS_CpyUserVec(pVec, numOfVec, IFX_TRUE);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) ) */
+
 /** @} */
 
 #endif      /* #if defined(LINUX) && !defined(__KERNEL__) */
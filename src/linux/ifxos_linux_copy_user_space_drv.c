@@ -40,6 +40,104 @@
 #include "ifxos_rt_if_check.h"
 #include "ifxos_copy_user_space.h"
 
+#if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) )
+/* ============================================================================
+   IFX Linux adaptation - vectored copy, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+#if LINUX_VERSION_CODE < KERNEL_VERSION(5, 0, 0)
+#  define IFXOS_USER_ACCESS_OK(bToUser, pUser, size) \
+            access_ok(((bToUser) ? VERIFY_WRITE : VERIFY_READ), (pUser), (size))
+#else
+#  define IFXOS_USER_ACCESS_OK(bToUser, pUser, size) \
+            access_ok((pUser), (size))
+#endif
+
+/* ============================================================================
+   IFX Linux adaptation - vectored copy, local functions
+   ========================================================================= */
+
+/**
+   LINUX Kernel - copy a set of blocks from / to user space.
+
+\par Implementation
+   All user blocks are checked via "access_ok" first, then the blocks are
+   copied with "__copy_from_user" / "__copy_to_user" (no further check).
+   Subsequent blocks which are contiguous in user and driver space are
+   combined to a single copy.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_CpyUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec,
+               IFX_boolean_t              bToUser)
+{
+   IFX_uint32_t   i, j;
+   unsigned long  size, remainBytes;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pVec, IFX_ERROR);
+
+   for (i = 0; i < numOfVec; i++)
+   {
+      if (pVec[i].size_byte == 0)
+      {
+         continue;
+      }
+
+      if ( (pVec[i].pDrv == IFX_NULL) ||
+           (!IFXOS_USER_ACCESS_OK(bToUser, pVec[i].pUser, pVec[i].size_byte)) )
+      {
+         return IFX_ERROR;
+      }
+   }
+
+   for (i = 0; i < numOfVec; i = j)
+   {
+      size = pVec[i].size_byte;
+
+      for (j = i + 1; j < numOfVec; j++)
+      {
+         if ( ((IFX_uint8_t *)pVec[i].pDrv + size  != (IFX_uint8_t *)pVec[j].pDrv) ||
+              ((IFX_uint8_t *)pVec[i].pUser + size != (IFX_uint8_t *)pVec[j].pUser) )
+         {
+            break;
+         }
+         size += pVec[j].size_byte;
+      }
+
+      if (size == 0)
+      {
+         continue;
+      }
+
+      if (bToUser == IFX_TRUE)
+      {
+         remainBytes = __copy_to_user(pVec[i].pUser, pVec[i].pDrv, size);
+      }
+      else
+      {
+         remainBytes = __copy_from_user(pVec[i].pDrv, pVec[i].pUser, size);
+      }
+
+      if (remainBytes != 0)
+      {
+         return IFX_ERROR;
+      }
+   }
+
+   return IFX_SUCCESS;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) ) */
+
 /* ============================================================================
    IFX Linux adaptation - copy between user and kernel space
    ========================================================================= */
@@ -113,11 +211,171 @@ IFX_void_t *IFXOS_CpyToUser(
    return (remainBytes) ? IFX_NULL : pTo;
 }
 
+#if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) )
+/**
+   LINUX Kernel - Copy a set of blocks FROM USER space (application) to
+   driver space (kernel).
+
+\par Implementation
+   The user blocks are validated once ("access_ok"), then copied via
+   "__copy_from_user", contiguous blocks at once.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyFromUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec)
+{
+   return IFXOS_CpyUserVec(pVec, numOfVec, IFX_FALSE);
+}
+
+/**
+   LINUX Kernel - Copy a set of blocks from driver space (kernel) TO USER
+   space (application).
+
+\par Implementation
+   The user blocks are validated once ("access_ok"), then copied via
+   "__copy_to_user", contiguous blocks at once.
+
+\param
+   pVec        Points to the block array.
+\param
+   numOfVec    Number of blocks.
+
+\return
+   IFX_SUCCESS if all blocks have been copied, else
+   IFX_ERROR   (no block is copied if the validation fails).
+*/
+IFX_int32_t IFXOS_CpyToUserVec(
+               const IFXOS_CpyUserVec_t   *pVec,
+               IFX_uint32_t               numOfVec)
+{
+   return IFXOS_CpyUserVec(pVec, numOfVec, IFX_TRUE);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH_EXEC) && (IFXOS_HAVE_DEV_CTRL_BATCH_EXEC == 1) )
+/**
+   LINUX Kernel - Execute a device control batch.
+
+\par Implementation
+   The batch argument and the command array are copied with one
+   "copy_from_user" each, the results are returned with one
+   "copy_to_user". The command array and the results share one allocation.
+
+\param
+   arg         ioctl argument, points to the \ref IFXOS_DevCtrlBatch_t
+               (in user space).
+\param
+   pCtrlFct    driver control function.
+\param
+   pCtx        driver context, passed to the control function.
+
+\return
+   Number of executed commands, else
+   IFX_ERROR   in case of a copy or memory error.
+*/
+IFX_int32_t IFXOS_DevCtrlBatchExec(
+               IFX_ulong_t          arg,
+               IFXOS_DevCtrlFct_t   pCtrlFct,
+               IFX_void_t           *pCtx)
+{
+   IFXOS_DevCtrlBatch_t batch;
+   IFXOS_DevCtrlCmd_t   *pCmds;
+   IFX_int32_t          *pResults;
+   IFX_uint32_t         i;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pCtrlFct, IFX_ERROR);
+
+   if (IFXOS_CpyFromUserStruct(&batch, (const IFX_void_t *)arg) != IFX_SUCCESS)
+   {
+      return IFX_ERROR;
+   }
+
+   if ( (batch.nCmds == 0) || (batch.nCmds > IFXOS_DEV_CTRL_BATCH_MAX_CMDS) )
+   {
+      return IFX_ERROR;
+   }
+
+   pCmds = (IFXOS_DevCtrlCmd_t *)IFXOS_MemAlloc(
+               batch.nCmds * (sizeof(IFXOS_DevCtrlCmd_t) + sizeof(IFX_int32_t)));
+   if (pCmds == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   pResults = (IFX_int32_t *)&pCmds[batch.nCmds];
+
+   if (IFXOS_CpyFromUser(pCmds, batch.pCmds,
+                         batch.nCmds * sizeof(IFXOS_DevCtrlCmd_t)) == IFX_NULL)
+   {
+      IFXOS_MemFree(pCmds);
+      return IFX_ERROR;
+   }
+
+   for (i = 0; i < batch.nCmds; i++)
+   {
+      pResults[i] = pCtrlFct(pCtx, pCmds[i].devCmd, pCmds[i].param);
+      if (pResults[i] < 0)
+      {
+         i++;
+         break;
+      }
+   }
+
+   if (IFXOS_CpyToUser(batch.pResults, pResults, i * sizeof(IFX_int32_t)) == IFX_NULL)
+   {
+      IFXOS_MemFree(pCmds);
+      return IFX_ERROR;
+   }
+
+   IFXOS_MemFree(pCmds);
+
+   return (IFX_int32_t)i;
+}
+
+/**
+   LINUX Kernel - Answer the device control batch capability query.
+
+\param
+   arg         ioctl argument, points to the \ref IFXOS_DevCtrlBatchCaps_t
+               (in user space).
+
+\return
+   IFX_SUCCESS capabilities returned.
+   IFX_ERROR   in case of a copy error.
+*/
+IFX_int32_t IFXOS_DevCtrlBatchCaps(
+               IFX_ulong_t          arg)
+{
+   IFXOS_DevCtrlBatchCaps_t caps;
+
+   caps.id      = IFXOS_DEV_CTRL_BATCH_CAPS_ID;
+   caps.maxCmds = IFXOS_DEV_CTRL_BATCH_MAX_CMDS;
+
+   return IFXOS_CpyToUserStruct((IFX_void_t *)arg, &caps);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH_EXEC) && (IFXOS_HAVE_DEV_CTRL_BATCH_EXEC == 1) ) */
+
 /** @} */
 
 #ifdef MODULE
 EXPORT_SYMBOL(IFXOS_CpyFromUser);
 EXPORT_SYMBOL(IFXOS_CpyToUser);
+#if ( defined(IFXOS_HAVE_CPY_USER_VEC) && (IFXOS_HAVE_CPY_USER_VEC == 1) )
+EXPORT_SYMBOL(IFXOS_CpyFromUserVec);
+EXPORT_SYMBOL(IFXOS_CpyToUserVec);
+#endif
+#if ( defined(IFXOS_HAVE_DEV_CTRL_BATCH_EXEC) && (IFXOS_HAVE_DEV_CTRL_BATCH_EXEC == 1) )
+EXPORT_SYMBOL(IFXOS_DevCtrlBatchExec);
+EXPORT_SYMBOL(IFXOS_DevCtrlBatchCaps);
+#endif
 #endif
 
 #endif      /* #ifdef __KERNEL__ */
@@ -25,15 +25,20 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/ioctl.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <poll.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <string.h>
+#include <errno.h>
 
 #include "ifx_types.h"
 #include "ifxos_rt_if_check.h"
 #include "ifxos_time.h"
 #include "ifxos_device_access.h"
 #include "ifxos_common.h"
+#include "ifxos_memory_alloc.h"
 
 /* ============================================================================
    IFX Linux adaptation - Application Space, Device Access
@@ -56,9 +61,13 @@
 IFX_int32_t IFXOS_DeviceOpen(
                const IFX_char_t *pDevName)
 {
+   IFX_int32_t devFd;
+
    IFXOS_RETURN_IF_POINTER_NULL(pDevName, IFX_ERROR);
 
-   return open((const char*)pDevName, O_RDWR, 0644);
+   devFd = open((const char*)pDevName, O_RDWR, 0644);
+
+   return devFd;
 }
 
 /**
@@ -279,6 +288,507 @@ IFX_void_t IFXOS_DevFdZero(
 }
 #endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SELECT) && (IFXOS_HAVE_DEVICE_ACCESS_SELECT == 1) ) */
 
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) )
+/**
+   LINUX Application - Check if the driver supports the device control batch.
+
+\par Implementation
+   The driver is asked via IFXOS_DEV_CTRL_BATCH_CAPS_CMD, only a driver which
+   returns the identification IFXOS_DEV_CTRL_BATCH_CAPS_ID supports the batch.
+   The result is not cached, a descriptor number may be closed, reopened or
+   duplicated (dup2) to another device outside of IFXOS.
+
+\param
+   devFd       device file descriptor.
+
+\return
+   IFX_TRUE if the batch command is supported, else IFX_FALSE.
+*/
+static IFX_boolean_t IFXOS_DevCtrlBatchSupported(
+               const IFX_int32_t          devFd)
+{
+   IFXOS_DevCtrlBatchCaps_t caps;
+
+   memset(&caps, 0x00, sizeof(caps));
+   if ( (ioctl(devFd, IFXOS_DEV_CTRL_BATCH_CAPS_CMD, &caps) == 0) &&
+        (caps.id == IFXOS_DEV_CTRL_BATCH_CAPS_ID) )
+   {
+      return IFX_TRUE;
+   }
+
+   return IFX_FALSE;
+}
+
+/**
+   LINUX Application - Control a device with a set of commands.
+
+\par Implementation
+   The commands are passed via the multiplexed ioctl IFXOS_DEV_CTRL_BATCH_CMD
+   if the driver has answered the capability query, else they are executed
+   via single ioctl calls. If the driver rejects the batch command itself
+   (ENOTTY / EINVAL) the remaining commands are also executed via single
+   ioctl calls.
+
+\param
+   devFd       device file descriptor.
+\param
+   pCmds       commands to execute.
+\param
+   nCmds       number of commands.
+\param
+   pResults    returns the result of each executed command.
+
+\return
+   Number of successful commands (stops on the first negative result).
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DeviceControlBatch(
+               const IFX_int32_t          devFd,
+               const IFXOS_DevCtrlCmd_t   *pCmds,
+               const IFX_uint32_t         nCmds,
+               IFX_int32_t                *pResults)
+{
+   IFXOS_DevCtrlBatch_t batch;
+   IFX_uint32_t done = 0;
+   int nRet;
+
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pCmds, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pResults, -1);
+
+   if ((nCmds != 0) && (IFXOS_DevCtrlBatchSupported(devFd) == IFX_TRUE))
+   {
+      while (done < nCmds)
+      {
+         batch.pCmds    = &pCmds[done];
+         batch.pResults = &pResults[done];
+         batch.nCmds    = ((nCmds - done) < IFXOS_DEV_CTRL_BATCH_MAX_CMDS) ?
+                              (nCmds - done) : IFXOS_DEV_CTRL_BATCH_MAX_CMDS;
+
+         nRet = ioctl(devFd, IFXOS_DEV_CTRL_BATCH_CMD, &batch);
+         if ((nRet < 0) && ((errno == ENOTTY) || (errno == EINVAL)))
+         {
+            /* batch rejected - continue with single ioctl calls */
+            break;
+         }
+
+         if ((nRet <= 0) || (nRet > (int)batch.nCmds))
+         {
+            return -1;
+         }
+
+         done += (IFX_uint32_t)nRet;
+         if (pResults[done - 1] < 0)
+         {
+            return (IFX_int32_t)(done - 1);
+         }
+      }
+
+      if (done == nCmds)
+      {
+         return (IFX_int32_t)done;
+      }
+   }
+
+   for (; done < nCmds; done++)
+   {
+      pResults[done] = ioctl(devFd, pCmds[done].devCmd, pCmds[done].param);
+      if (pResults[done] < 0)
+      {
+         break;
+      }
+   }
+
+   return (IFX_int32_t)done;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_BATCH) && (IFXOS_HAVE_DEVICE_ACCESS_BATCH == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING) && (IFXOS_HAVE_DEVICE_ACCESS_SHM_RING == 1) )
+/**
+   LINUX Application - Map a shared ring of a driver.
+
+\par Implementation
+   The ring memory is mapped via "mmap" (shared, read / write) of the device.
+
+\param
+   devFd          device file descriptor.
+\param
+   offset         mmap offset, page aligned (driver specific ring selection).
+\param
+   memSize_byte   size of the ring memory (header and data area).
+\param
+   pRing          returns the ring handle.
+
+\return
+   IFX_SUCCESS ring mapped.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingMap(
+               const IFX_int32_t    devFd,
+               const IFX_ulong_t    offset,
+               const IFX_uint32_t   memSize_byte,
+               IFXOS_ShmRing_t      *pRing)
+{
+   IFX_void_t *pMem;
+
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, IFX_ERROR);
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, IFX_ERROR);
+
+   pRing->pHdr = IFX_NULL;
+
+   pMem = mmap(NULL, (size_t)memSize_byte, PROT_READ | PROT_WRITE, MAP_SHARED,
+               devFd, (off_t)offset);
+   if (pMem == MAP_FAILED)
+   {
+      return IFX_ERROR;
+   }
+
+   if (IFXOS_ShmRingInit(pRing, pMem, memSize_byte, IFX_FALSE) != IFX_SUCCESS)
+   {
+      (void)munmap(pMem, (size_t)memSize_byte);
+      return IFX_ERROR;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Unmap a shared ring.
+
+\param
+   pRing    ring handle, see \ref IFXOS_DeviceShmRingMap.
+
+\return
+   IFX_SUCCESS ring unmapped.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingUnmap(
+               IFXOS_ShmRing_t      *pRing)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, IFX_ERROR);
+
+   if (pRing->pHdr == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+
+   if (munmap((IFX_void_t *)pRing->pHdr, (size_t)pRing->memSize_byte) != 0)
+   {
+      return IFX_ERROR;
+   }
+   pRing->pHdr  = IFX_NULL;
+   pRing->pData = IFX_NULL;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Wait for a record of a shared ring (consumer).
+
+\par Implementation
+   The wait is announced within the ring (no wakeup from the producer without
+   a waiting consumer), then the device is polled for reading.
+
+\param
+   devFd       device file descriptor.
+\param
+   pRing       ring handle, see \ref IFXOS_DeviceShmRingMap.
+\param
+   timeout_ms  max time to wait [ms].
+
+\return
+   1  records available.
+   0  timeout.
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DeviceShmRingWait(
+               const IFX_int32_t    devFd,
+               IFXOS_ShmRing_t      *pRing,
+               const IFX_uint32_t   timeout_ms)
+{
+   struct pollfd pfd;
+   int nRet;
+
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, -1);
+
+   if (IFXOS_ShmRingWaitPrepare(pRing) == IFX_FALSE)
+   {
+      return (pRing->pHdr != IFX_NULL) ? 1 : -1;
+   }
+
+   pfd.fd      = devFd;
+   pfd.events  = POLLIN;
+   pfd.revents = 0;
+   nRet = poll(&pfd, 1, (timeout_ms != IFXOS_WAIT_FOREVER) ? (int)timeout_ms : -1);
+
+   IFXOS_ShmRingWaitDone(pRing);
+
+   if ((nRet < 0) && (errno != EINTR))
+   {
+      return -1;
+   }
+
+   return (IFXOS_ShmRingIsEmpty(pRing) == IFX_TRUE) ? 0 : 1;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_SHM_RING) && (IFXOS_HAVE_DEVICE_ACCESS_SHM_RING == 1) ) */
+
+#if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) && (IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) )
+
+/** max number of ready devices returned by a single epoll_wait call */
+#define IFXOS_DEVPOLL_EPOLL_MAX_EVENTS    64
+
+/**
+   LINUX Application - Create a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set created.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollCreate(
+               IFXOS_devPoll_t *pDevPoll)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+
+   memset(pDevPoll, 0x00, sizeof(IFXOS_devPoll_t));
+   pDevPoll->epFd = epoll_create(IFXOS_DEVPOLL_EPOLL_MAX_EVENTS);
+   if (pDevPoll->epFd < 0)
+   {
+      return IFX_ERROR;
+   }
+   if (IFXOS_MutexInit(&pDevPoll->mutex) != IFX_SUCCESS)
+   {
+      (void)close(pDevPoll->epFd);
+      return IFX_ERROR;
+   }
+   (void)fcntl(pDevPoll->epFd, F_SETFD, FD_CLOEXEC);
+   pDevPoll->bValid = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Delete a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+
+\return
+   IFX_SUCCESS poll set deleted.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollDelete(
+               IFXOS_devPoll_t *pDevPoll)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+
+   if (pDevPoll->bValid != IFX_TRUE)
+   {
+      return IFX_ERROR;
+   }
+   pDevPoll->bValid = IFX_FALSE;
+
+   if (pDevPoll->pEntries != IFX_NULL)
+   {
+      IFXOS_MemFree(pDevPoll->pEntries);
+      pDevPoll->pEntries = IFX_NULL;
+   }
+   pDevPoll->nEntries = 0;
+   IFXOS_MutexDelete(&pDevPoll->mutex);
+
+   return (close(pDevPoll->epFd) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   LINUX Application - Add a device to a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+\param
+   events      events to wait for (IFXOS_DEVPOLL_xxx).
+\param
+   pUser       user data, returned with the ready device.
+
+\return
+   IFX_SUCCESS device added.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollAdd(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd,
+               const IFX_uint32_t   events,
+               IFX_void_t           *pUser)
+{
+   struct epoll_event ev;
+   IFXOS_DevPollEvent_t *pEntries;
+   IFX_uint32_t nEntries;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, IFX_ERROR);
+
+   if ((pDevPoll->bValid != IFX_TRUE) || (devFd < 0))
+   {
+      return IFX_ERROR;
+   }
+
+   /* the user data is kept in a table indexed by the descriptor,
+      the table may be replaced while another thread waits */
+   IFXOS_MutexGet(&pDevPoll->mutex);
+   if ((IFX_uint32_t)devFd >= pDevPoll->nEntries)
+   {
+      nEntries = (pDevPoll->nEntries != 0) ? pDevPoll->nEntries : IFXOS_DEVPOLL_EPOLL_MAX_EVENTS;
+      while (nEntries <= (IFX_uint32_t)devFd)
+         nEntries *= 2;
+
+      pEntries = (IFXOS_DevPollEvent_t *)IFXOS_MemAlloc(
+                                 nEntries * sizeof(IFXOS_DevPollEvent_t));
+      if (pEntries == IFX_NULL)
+      {
+         IFXOS_MutexRelease(&pDevPoll->mutex);
+         return IFX_ERROR;
+      }
+      memset(pEntries, 0x00, nEntries * sizeof(IFXOS_DevPollEvent_t));
+      if (pDevPoll->pEntries != IFX_NULL)
+      {
+         memcpy(pEntries, pDevPoll->pEntries,
+                pDevPoll->nEntries * sizeof(IFXOS_DevPollEvent_t));
+         IFXOS_MemFree(pDevPoll->pEntries);
+      }
+      pDevPoll->pEntries = pEntries;
+      pDevPoll->nEntries = nEntries;
+   }
+
+   memset(&ev, 0x00, sizeof(ev));
+   ev.events  = ((events & IFXOS_DEVPOLL_IN)  ? EPOLLIN  : 0) |
+                ((events & IFXOS_DEVPOLL_OUT) ? EPOLLOUT : 0);
+   ev.data.fd = devFd;
+
+   if (epoll_ctl(pDevPoll->epFd, EPOLL_CTL_ADD, devFd, &ev) != 0)
+   {
+      IFXOS_MutexRelease(&pDevPoll->mutex);
+      return IFX_ERROR;
+   }
+
+   pEntries = (IFXOS_DevPollEvent_t *)pDevPoll->pEntries;
+   pEntries[devFd].devFd  = devFd;
+   pEntries[devFd].events = events;
+   pEntries[devFd].pUser  = pUser;
+   IFXOS_MutexRelease(&pDevPoll->mutex);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Remove a device from a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   devFd       device file descriptor.
+
+\return
+   IFX_SUCCESS device removed.
+   IFX_ERROR   in case of error.
+*/
+IFX_int32_t IFXOS_DevPollRemove(
+               IFXOS_devPoll_t      *pDevPoll,
+               const IFX_int32_t    devFd)
+{
+   struct epoll_event ev;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, IFX_ERROR);
+   IFXOS_RETURN_IF_DEVFD_INVALID(devFd, IFX_ERROR);
+
+   if ((pDevPoll->bValid != IFX_TRUE) || (devFd < 0))
+   {
+      return IFX_ERROR;
+   }
+
+   /* event argument required by kernels before 2.6.9 */
+   memset(&ev, 0x00, sizeof(ev));
+   if (epoll_ctl(pDevPoll->epFd, EPOLL_CTL_DEL, devFd, &ev) != 0)
+   {
+      return IFX_ERROR;
+   }
+
+   IFXOS_MutexGet(&pDevPoll->mutex);
+   if ((IFX_uint32_t)devFd < pDevPoll->nEntries)
+   {
+      memset(&((IFXOS_DevPollEvent_t *)pDevPoll->pEntries)[devFd], 0x00,
+             sizeof(IFXOS_DevPollEvent_t));
+   }
+   IFXOS_MutexRelease(&pDevPoll->mutex);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Wait for ready devices of a poll set.
+
+\param
+   pDevPoll    points to the poll set object.
+\param
+   pEvents     returns the ready devices.
+\param
+   maxEvents   max number of entries of pEvents.
+\param
+   timeout_ms  max time to wait [ms].
+
+\return
+   Number of ready devices (0: timeout).
+   -1 in case of error.
+*/
+IFX_int32_t IFXOS_DevPollWait(
+               IFXOS_devPoll_t      *pDevPoll,
+               IFXOS_DevPollEvent_t *pEvents,
+               const IFX_uint32_t   maxEvents,
+               const IFX_uint32_t   timeout_ms)
+{
+   struct epoll_event ev[IFXOS_DEVPOLL_EPOLL_MAX_EVENTS];
+   IFXOS_DevPollEvent_t *pEntries;
+   int i, nReady, nMax;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pDevPoll, -1);
+   IFXOS_RETURN_IF_POINTER_NULL(pEvents, -1);
+
+   if ((pDevPoll->bValid != IFX_TRUE) || (maxEvents == 0))
+   {
+      return -1;
+   }
+
+   nMax = (maxEvents < IFXOS_DEVPOLL_EPOLL_MAX_EVENTS) ?
+               (int)maxEvents : IFXOS_DEVPOLL_EPOLL_MAX_EVENTS;
+
+   nReady = epoll_wait(pDevPoll->epFd, ev, nMax,
+               (timeout_ms != IFXOS_WAIT_FOREVER) ? (int)timeout_ms : -1);
+   if (nReady < 0)
+   {
+      /* interrupted by a signal - handled like a timeout */
+      return (errno == EINTR) ? 0 : -1;
+   }
+
+   IFXOS_MutexGet(&pDevPoll->mutex);
+   pEntries = (IFXOS_DevPollEvent_t *)pDevPoll->pEntries;
+   for (i = 0; i < nReady; i++)
+   {
+      pEvents[i].devFd  = ev[i].data.fd;
+      pEvents[i].events = ((ev[i].events & EPOLLIN)  ? IFXOS_DEVPOLL_IN  : 0) |
+                          ((ev[i].events & EPOLLOUT) ? IFXOS_DEVPOLL_OUT : 0) |
+                          ((ev[i].events & (EPOLLERR | EPOLLHUP)) ? IFXOS_DEVPOLL_ERR : 0);
+      pEvents[i].pUser  = ((IFX_uint32_t)ev[i].data.fd < pDevPoll->nEntries) ?
+                              pEntries[ev[i].data.fd].pUser : IFX_NULL;
+   }
+   IFXOS_MutexRelease(&pDevPoll->mutex);
+
+   return nReady;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DEVICE_ACCESS_POLL) && (IFXOS_HAVE_DEVICE_ACCESS_POLL == 1) ) */
+
 /** @} */
 
 #endif      /* #ifdef LINUX && !defined(IFXOS_USE_DEV_IO) */
@@ -41,6 +41,19 @@
 
 #include "ifxos_sys_show.h"
 
+/* ============================================================================
+   Local macros and definition
+   ========================================================================= */
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
 /* ============================================================================
    IIFX LINUX User Space adaptation - EVENT handling
    ========================================================================= */
@@ -50,6 +63,48 @@
 
 #if ( defined(IFXOS_HAVE_EVENT) && (IFXOS_HAVE_EVENT == 1) )
 
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
+/**
+   Linux Appl - Get a monotonic time stamp in [us] for the wakeup latency
+   statistics (wraps around after ~71 minutes).
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_EventTimeUSecGet(void)
+{
+   struct timespec t;
+
+   clock_gettime(CLOCK_MONOTONIC, &t);
+
+   /* unsigned arithmetic - the wrap around is defined (no long overflow) */
+   return ((IFX_uint32_t)t.tv_sec * 1000000U) + (IFX_uint32_t)(t.tv_nsec / 1000);
+}
+
+/**
+   Linux Appl - Add the wakeup latency of the calling thread to the thread
+   statistics.
+
+\param
+   pEventId       Prointer to the Event Object.
+\param
+   waitStart_us   Time stamp [us] of the begin of the wait.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_EventWakeupLatencyAdd(
+               IFXOS_event_t  *pEventId,
+               IFX_uint32_t   waitStart_us)
+{
+   IFX_uint32_t wakeup_us = pEventId->wakeupTime_us;
+
+   if (IFXOS_SYS_THREAD_SELF_GET() == IFX_NULL)
+      return;
+
+   /* a wakeup before the begin of the wait does not count as latency */
+   if ((IFX_int32_t)(wakeup_us - waitStart_us) < 0)
+      wakeup_us = waitStart_us;
+
+   IFXOS_SYS_THREAD_WAKEUP_LATENCY_ADD(IFXOS_SYS_THREAD_SELF_GET(),
+      IFXOS_EventTimeUSecGet() - wakeup_us);
+}
+#endif
+
 /**
    Linux Appl - Initialize a Event Object for synchronisation.
 
@@ -206,6 +261,9 @@ IFX_int_t IFXOS_EventWakeUp(
    {
       if (IFXOS_EVENT_INIT_VALID(pEventId) == IFX_TRUE)
       {
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
+         pEventId->wakeupTime_us = IFXOS_EventTimeUSecGet();
+#endif
          if (sem_post(&pEventId->object) == 0)
          {
             return IFX_SUCCESS;
@@ -270,6 +328,9 @@ IFX_int_t IFXOS_EventWait(
 #if defined(USE_PHTREAD_SEM) && (USE_PHTREAD_SEM == 1)
    struct timespec t;
    int ret;
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
+   IFX_uint32_t waitStart_us = IFXOS_EventTimeUSecGet();
+#endif
 
    if(pEventId)
    {
@@ -323,6 +384,12 @@ IFX_int_t IFXOS_EventWait(
 
          if(ret == 0)
          {
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
+            if (waitTime_ms != 0)
+            {
+               IFXOS_EventWakeupLatencyAdd(pEventId, waitStart_us);
+            }
+#endif
             if (pRetCode) *pRetCode = 0;
             return IFX_SUCCESS;
          }
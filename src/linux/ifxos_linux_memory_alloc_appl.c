@@ -23,6 +23,8 @@
    IFX Linux adaptation - Global Includes
    ========================================================================= */
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include "ifx_types.h"
 #include "ifxos_debug.h"
@@ -40,20 +42,24 @@
 
 #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) )
 /**
-   LINUX Application - Allocate Memory Space from the OS
+   LINUX Application - Allocate Memory Space from the OS on behalf of the
+   given call site (internal, for allocation wrappers).
 
 \par Implementation
    Allocates a memory block with the standard function "malloc"
 
 \param
    memSize_byte   Size of the requested memory block [byte]
+\param
+   pCaller        Call site captured by the public entry point (leak tracker).
 
 \return
    IFX_NULL in case of error, else
    pointer to the allocated memory block.
 */
-IFX_void_t *IFXOS_MemAlloc(
-               IFX_size_t memSize_byte)
+IFX_void_t *IFXOS_MemAllocCaller(
+               IFX_size_t  memSize_byte,
+               IFX_void_t  *pCaller)
 {
    IFX_void_t *pMemBlock = IFX_NULL;
 
@@ -61,11 +67,58 @@ IFX_void_t *IFXOS_MemAlloc(
    {
       pMemBlock = malloc((size_t)memSize_byte);
       IFXOS_SYS_MEM_ALLOC_COUNT_INC(IFX_NULL);
+      IFXOS_MEM_TRACK_ADD_CALLER(pMemBlock, memSize_byte, pCaller);
    }
 
    return (pMemBlock);
 }
 
+/**
+   LINUX Application - Allocate Memory Space from the OS
+
+\par Implementation
+   Allocates a memory block with the standard function "malloc"
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAlloc(
+               IFX_size_t memSize_byte)
+{
+   return IFXOS_MemAllocCaller(memSize_byte, IFXOS_MEM_TRACK_CALLER());
+}
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_FLAGS) && (IFXOS_HAVE_MEM_ALLOC_FLAGS == 1) )
+/**
+   LINUX Application - Allocate Memory Space from the OS with the given flags
+
+\par Implementation
+   Allocates a memory block with the standard function "malloc",
+   the flags are not used.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   allocFlags     Allocation flags (not used).
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocFlags(
+               IFX_size_t              memSize_byte,
+               IFXOS_MemAllocFlags_t   allocFlags)
+{
+   (void)allocFlags;
+
+   return IFXOS_MemAllocCaller(memSize_byte, IFXOS_MEM_TRACK_CALLER());
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_FLAGS) && (IFXOS_HAVE_MEM_ALLOC_FLAGS == 1) ) */
+
 /**
    LINUX Application - Free Memory Space
 
@@ -81,6 +134,7 @@ IFX_void_t IFXOS_MemFree(
 
    if (pMemBlock)
    {
+      IFXOS_MEM_TRACK_REMOVE(pMemBlock);
       free(pMemBlock);
       IFXOS_SYS_MEM_FREE_COUNT_INC(IFX_NULL);
    }
@@ -114,6 +168,7 @@ IFX_void_t *IFXOS_BlockAlloc(
    {
       pMemBlock = malloc((size_t)memSize_byte);
       IFXOS_SYS_MEM_ALLOC_COUNT_INC(IFX_NULL);
+      IFXOS_MEM_TRACK_ADD(pMemBlock, memSize_byte);
    }
 
    return (pMemBlock);
@@ -134,6 +189,7 @@ IFX_void_t IFXOS_BlockFree(
 
    if (pMemBlock)
    {
+      IFXOS_MEM_TRACK_REMOVE(pMemBlock);
       free(pMemBlock);
       IFXOS_SYS_MEM_FREE_COUNT_INC(IFX_NULL);
    }
@@ -146,6 +202,267 @@ IFX_void_t IFXOS_BlockFree(
 }
 #endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) */
 
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) )
+/**
+   LINUX Application - Allocate an aligned Memory Space from the OS
+
+\par Implementation
+   Allocates a memory block with the standard function "posix_memalign"
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   align_byte     Alignment of the memory block [byte], power of 2
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocAligned(
+               IFX_size_t  memSize_byte,
+               IFX_size_t  align_byte)
+{
+   IFX_void_t *pMemBlock = IFX_NULL;
+
+   if ((memSize_byte == 0) || (align_byte == 0) || (align_byte & (align_byte - 1)))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Alloc Aligned, invalid size %lu / align %lu" IFXOS_CRLF,
+           (IFX_ulong_t)memSize_byte, (IFX_ulong_t)align_byte));
+
+      return IFX_NULL;
+   }
+
+   if (align_byte < sizeof(IFX_void_t *))
+      align_byte = sizeof(IFX_void_t *);
+
+   if (posix_memalign(&pMemBlock, (size_t)align_byte, (size_t)memSize_byte) != 0)
+   {
+      return IFX_NULL;
+   }
+   IFXOS_SYS_MEM_ALLOC_COUNT_INC(IFX_NULL);
+   IFXOS_MEM_TRACK_ADD(pMemBlock, memSize_byte);
+
+   return (pMemBlock);
+}
+
+/**
+   LINUX Application - Free an aligned Memory Space
+
+\par Implementation
+   Free a memory block with the standard function "free"
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeAligned(
+               IFX_void_t  *pMemBlock)
+{
+   IFXOS_MemFree(pMemBlock);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) ) */
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) )
+
+/**
+   Large memory block - mapping of a block, kept within a list for the free.
+*/
+typedef struct IFXOS_MemLargeDesc_s
+{
+   /** next mapping */
+   struct IFXOS_MemLargeDesc_s *pNext;
+   /** start of the mapping */
+   IFX_void_t     *pBlock;
+   /** size of the mapping [byte] */
+   IFX_size_t     mapSize;
+   /** IFX_TRUE: huge page backing (explicit or transparent) */
+   IFX_boolean_t  bHuge;
+} IFXOS_MemLargeDesc_t;
+
+/** list of the large memory mappings */
+static IFXOS_MemLargeDesc_t *pIFXOS_memLargeList = IFX_NULL;
+/** protects the list of the large memory mappings */
+static pthread_mutex_t IFXOS_memLargeLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** round up to a power of 2 */
+#define IFXOS_MEM_LARGE_ROUND_UP(val, align) \
+            (((val) + ((align) - 1)) & ~((IFX_size_t)(align) - 1))
+
+#if defined(MADV_HUGEPAGE)
+/**
+   LINUX Application - map anonymous memory aligned to the huge page size,
+   as precondition for transparent huge pages.
+*/
+static IFX_void_t *IFXOS_MemLargeMapHugeAligned(
+               IFX_size_t     mapSize)
+{
+   IFX_uint8_t *pMap, *pAligned;
+   IFX_size_t  headSize, tailSize;
+
+   pMap = (IFX_uint8_t *)mmap(NULL, mapSize + IFXOS_MEM_HUGE_PAGE_SIZE,
+                              PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if ((IFX_void_t *)pMap == MAP_FAILED)
+   {
+      return IFX_NULL;
+   }
+
+   /* release the unaligned head and the tail of the mapping */
+   pAligned = (IFX_uint8_t *)IFXOS_MEM_LARGE_ROUND_UP((IFX_uintptr_t)pMap, IFXOS_MEM_HUGE_PAGE_SIZE);
+   headSize = (IFX_size_t)(pAligned - pMap);
+   tailSize = IFXOS_MEM_HUGE_PAGE_SIZE - headSize;
+   if (headSize != 0)
+      (void)munmap(pMap, headSize);
+   if (tailSize != 0)
+      (void)munmap(pAligned + mapSize, tailSize);
+
+   if (madvise(pAligned, mapSize, MADV_HUGEPAGE) != 0)
+   {
+      (void)munmap(pAligned, mapSize);
+      return IFX_NULL;
+   }
+
+   return (IFX_void_t *)pAligned;
+}
+#endif
+
+/**
+   LINUX Application - Allocate a large, page aligned Memory Space
+
+\par Implementation
+   Maps anonymous memory via "mmap", the memory is always zeroed.
+   With IFXOS_MEM_LARGE_FLAG_HUGE_PAGE the mapping is tried with explicit
+   huge pages (MAP_HUGETLB, requires reserved huge pages), then aligned to
+   the huge page size with transparent huge pages (MADV_HUGEPAGE) and
+   finally with normal pages.
+   The flags IFXOS_MEM_LARGE_FLAG_CONTIGUOUS and IFXOS_MEM_LARGE_FLAG_DMA
+   are not used.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   flags          Large memory flags, see IFXOS_MEM_LARGE_FLAG_xxx.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocLarge(
+               IFX_size_t     memSize_byte,
+               IFX_uint32_t   flags)
+{
+   IFXOS_MemLargeDesc_t *pDesc;
+   IFX_void_t           *pBlock = IFX_NULL;
+   IFX_size_t           mapSize = 0;
+
+   if (memSize_byte == 0)
+   {
+      return IFX_NULL;
+   }
+
+   pDesc = (IFXOS_MemLargeDesc_t *)malloc(sizeof(IFXOS_MemLargeDesc_t));
+   if (pDesc == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+   pDesc->bHuge = IFX_FALSE;
+
+   if (flags & IFXOS_MEM_LARGE_FLAG_HUGE_PAGE)
+   {
+      mapSize = IFXOS_MEM_LARGE_ROUND_UP(memSize_byte, IFXOS_MEM_HUGE_PAGE_SIZE);
+
+#if defined(MAP_HUGETLB)
+      pBlock = mmap(NULL, mapSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (pBlock == MAP_FAILED)
+         pBlock = IFX_NULL;
+#endif
+#if defined(MADV_HUGEPAGE)
+      if (pBlock == IFX_NULL)
+         pBlock = IFXOS_MemLargeMapHugeAligned(mapSize);
+#endif
+      pDesc->bHuge = (pBlock != IFX_NULL) ? IFX_TRUE : IFX_FALSE;
+   }
+
+   if (pBlock == IFX_NULL)
+   {
+      mapSize = IFXOS_MEM_LARGE_ROUND_UP(memSize_byte, (IFX_size_t)sysconf(_SC_PAGESIZE));
+      pBlock  = mmap(NULL, mapSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (pBlock == MAP_FAILED)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Mem Alloc Large, mmap of %lu byte failed" IFXOS_CRLF,
+              (IFX_ulong_t)mapSize));
+
+         free(pDesc);
+         return IFX_NULL;
+      }
+   }
+
+   pDesc->pBlock  = pBlock;
+   pDesc->mapSize = mapSize;
+
+   pthread_mutex_lock(&IFXOS_memLargeLock);
+   pDesc->pNext = pIFXOS_memLargeList;
+   pIFXOS_memLargeList = pDesc;
+   pthread_mutex_unlock(&IFXOS_memLargeLock);
+
+   IFXOS_SYS_MEM_LARGE_ALLOC_ADD(IFX_NULL, mapSize, pDesc->bHuge);
+   IFXOS_MEM_TRACK_ADD(pBlock, mapSize);
+
+   return pBlock;
+}
+
+/**
+   LINUX Application - Free a large Memory Space
+
+\par Implementation
+   Unmaps the memory block via "munmap".
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeLarge(
+               IFX_void_t     *pMemBlock)
+{
+   IFXOS_MemLargeDesc_t *pDesc, **ppPrev;
+
+   if (pMemBlock == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("WARNING - Cannot <munmap> NULL pointer" IFXOS_CRLF));
+      return;
+   }
+
+   pthread_mutex_lock(&IFXOS_memLargeLock);
+   for (ppPrev = &pIFXOS_memLargeList, pDesc = pIFXOS_memLargeList;
+        pDesc != IFX_NULL;
+        ppPrev = &pDesc->pNext, pDesc = pDesc->pNext)
+   {
+      if (pDesc->pBlock == pMemBlock)
+      {
+         *ppPrev = pDesc->pNext;
+         break;
+      }
+   }
+   pthread_mutex_unlock(&IFXOS_memLargeLock);
+
+   if (pDesc == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Free Large, 0x%p is not a large block" IFXOS_CRLF,
+           pMemBlock));
+      return;
+   }
+
+   IFXOS_MEM_TRACK_REMOVE(pMemBlock);
+   (void)munmap(pMemBlock, pDesc->mapSize);
+   IFXOS_SYS_MEM_LARGE_FREE_ADD(IFX_NULL, pDesc->mapSize);
+
+   free(pDesc);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) ) */
+
 /** @} */
 
 #endif      /* #ifdef LINUX */
@@ -37,12 +37,23 @@
 #endif
 #include <linux/slab.h>
 #include <linux/vmalloc.h>
+#include <linux/mm.h>
+#include <linux/gfp.h>
+#include <linux/string.h>
 #include <linux/version.h>
 
 #include "ifx_types.h"
 #include "ifxos_linux_drv.h"
 #include "ifxos_debug.h"
 #include "ifxos_memory_alloc.h"
+#include "ifxos_sys_show.h"
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(4,4,0))
+   /** the given GFP flags allow to sleep (vmalloc fallback possible) */
+#  define IFXOS_MEM_GFP_MAY_SLEEP(gfpFlags)     gfpflags_allow_blocking(gfpFlags)
+#else
+#  define IFXOS_MEM_GFP_MAY_SLEEP(gfpFlags)     ((gfpFlags) & __GFP_WAIT)
+#endif
 
 #if (IFXOS_LOCAL_CHECK == 1)
 #  if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,0))
@@ -91,7 +102,10 @@ IFX_void_t *IFXOS_BlockAlloc(
 #endif
 
    if(memSize_byte)
+   {
       pMemBlock = (IFX_void_t *)kmalloc((unsigned int)memSize_byte, GFP_KERNEL);
+      IFXOS_MEM_TRACK_ADD(pMemBlock, memSize_byte);
+   }
 
    return (pMemBlock);
 }
@@ -110,6 +124,7 @@ IFX_void_t IFXOS_BlockFree(
 
    if (pMemBlock)
    {
+      IFXOS_MEM_TRACK_REMOVE(pMemBlock);
       kfree(pMemBlock);
    }
    else
@@ -124,33 +139,140 @@ IFX_void_t IFXOS_BlockFree(
 
 #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) )
 /**
-   LINUX Kernel - Allocate Memory Space from the OS
+   LINUX Kernel - Allocate Memory Space with the given GFP flags on behalf of
+   the given call site.
 
 \par Implementation
-   Allocates a memory block with the kernel function "vmalloc"
+   - Blocks up to IFXOS_MEM_ALLOC_SLAB_MAX_SIZE are allocated with the kernel
+     function "kmalloc" (no page mapping per block, no TLB pressure).
+   - Larger blocks and small blocks which can not be served by the slab
+     allocator are allocated with the kernel function "vmalloc", only if the
+     flags allow to sleep.
+   - Atomic flags (GFP_ATOMIC) always use "kmalloc".
+   The selected backing is counted within the memory sys object.
 
 \param
    memSize_byte   Size of the requested memory block [byte]
+\param
+   allocFlags     GFP flags.
+\param
+   pCaller        Call site captured by the public entry point (leak tracker).
 
 \return
    IFX_NULL in case of error, else
    pointer to the allocated memory block.
 */
-IFX_void_t *IFXOS_MemAlloc(
-               IFX_size_t memSize_byte)
+static IFX_void_t *IFXOS_MemAllocFlagsCaller(
+               IFX_size_t              memSize_byte,
+               IFXOS_MemAllocFlags_t   allocFlags,
+               IFX_void_t              *pCaller)
 {
-   IFX_void_t *pMemBlock = IFX_NULL;
+   IFX_void_t     *pMemBlock = IFX_NULL;
+   IFX_boolean_t  bMaySleep;
 
-   if(memSize_byte)
-      pMemBlock = (IFX_void_t*)vmalloc((unsigned long)memSize_byte);
+   if (memSize_byte == 0)
+      return IFX_NULL;
+
+   bMaySleep = IFXOS_MEM_GFP_MAY_SLEEP(allocFlags) ? IFX_TRUE : IFX_FALSE;
+
+   if ((memSize_byte <= IFXOS_MEM_ALLOC_SLAB_MAX_SIZE) || (bMaySleep == IFX_FALSE))
+   {
+      pMemBlock = (IFX_void_t *)kmalloc(memSize_byte,
+                     (bMaySleep == IFX_TRUE) ? (allocFlags | __GFP_NOWARN) : allocFlags);
+      if (pMemBlock != IFX_NULL)
+      {
+         IFXOS_SYS_MEM_BACKING_COUNT_INC(IFX_NULL, IFX_FALSE);
+      }
+   }
+
+   if ((pMemBlock == IFX_NULL) && (bMaySleep == IFX_TRUE))
+   {
+      pMemBlock = (IFX_void_t *)vmalloc((unsigned long)memSize_byte);
+      if (pMemBlock != IFX_NULL)
+      {
+         IFXOS_SYS_MEM_BACKING_COUNT_INC(IFX_NULL, IFX_TRUE);
+      }
+   }
+
+   if (pMemBlock != IFX_NULL)
+   {
+      IFXOS_SYS_MEM_ALLOC_COUNT_INC(IFX_NULL);
+      IFXOS_MEM_TRACK_ADD_CALLER(pMemBlock, memSize_byte, pCaller);
+   }
 
    return (pMemBlock);
 }
 
+/**
+   LINUX Kernel - Allocate Memory Space from the OS with the given GFP flags.
+
+\par Implementation
+   See \ref IFXOS_MemAllocFlagsCaller, the block is recorded for the caller.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   allocFlags     GFP flags.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocFlags(
+               IFX_size_t              memSize_byte,
+               IFXOS_MemAllocFlags_t   allocFlags)
+{
+   return IFXOS_MemAllocFlagsCaller(memSize_byte, allocFlags, IFXOS_MEM_TRACK_CALLER());
+}
+
+/**
+   LINUX Kernel - Allocate Memory Space from the OS on behalf of the given
+   call site (internal, for allocation wrappers).
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   pCaller        Call site captured by the public entry point (leak tracker).
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocCaller(
+               IFX_size_t  memSize_byte,
+               IFX_void_t  *pCaller)
+{
+   return IFXOS_MemAllocFlagsCaller(memSize_byte, GFP_KERNEL, pCaller);
+}
+
+/**
+   LINUX Kernel - Allocate Memory Space from the OS
+
+\par Implementation
+   Allocates a memory block with "kmalloc" (small blocks) or "vmalloc"
+   (large blocks), see \ref IFXOS_MemAllocFlags.
+   This implementation is not allowed on interrupt level (may sleep), use
+   \ref IFXOS_MemAllocAtomic instead.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAlloc(
+               IFX_size_t memSize_byte)
+{
+   return IFXOS_MemAllocFlagsCaller(memSize_byte, GFP_KERNEL, IFXOS_MEM_TRACK_CALLER());
+}
+
 /**
    LINUX Kernel - Free Memory Space
 \par Implementation
-   Free a memory block with the kernel function "vfree"
+   Free a memory block with the kernel function "vfree" or "kfree" dependent
+   on the backing of the block. Blocks from atomic allocations (kmalloc) can
+   also be freed within atomic context.
 
 \param
    pMemBlock   Points to the memory block to free.
@@ -161,7 +283,12 @@ IFX_void_t IFXOS_MemFree(
 
    if (pMemBlock)
    {
-      vfree(pMemBlock);
+      IFXOS_MEM_TRACK_REMOVE(pMemBlock);
+      if (is_vmalloc_addr(pMemBlock))
+         vfree(pMemBlock);
+      else
+         kfree(pMemBlock);
+      IFXOS_SYS_MEM_FREE_COUNT_INC(IFX_NULL);
    }
    else
    {
@@ -172,13 +299,257 @@ IFX_void_t IFXOS_MemFree(
 }
 #endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC) && (IFXOS_HAVE_MEM_ALLOC == 1) ) */
 
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) )
+/**
+   LINUX Kernel - Allocate an aligned Memory Space from the OS
+
+\par Implementation
+   Allocates a larger memory block via \ref IFXOS_MemAlloc (kmalloc / vmalloc)
+   and returns the aligned part. The start of the allocated block is kept in
+   front of the aligned part.
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   align_byte     Alignment of the memory block [byte], power of 2
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocAligned(
+               IFX_size_t  memSize_byte,
+               IFX_size_t  align_byte)
+{
+   IFX_void_t     *pRawBlock;
+   IFX_uintptr_t  alignedAddr;
+
+   if ((memSize_byte == 0) || (align_byte == 0) || (align_byte & (align_byte - 1)))
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Alloc Aligned, invalid size %lu / align %lu" IFXOS_CRLF,
+           (IFX_ulong_t)memSize_byte, (IFX_ulong_t)align_byte));
+
+      return IFX_NULL;
+   }
+
+   pRawBlock = IFXOS_MEM_ALLOC_CALLER(memSize_byte + align_byte - 1 + sizeof(IFX_void_t *));
+   if (pRawBlock == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+
+   alignedAddr = ((IFX_uintptr_t)pRawBlock + sizeof(IFX_void_t *) + align_byte - 1) &
+                 ~((IFX_uintptr_t)align_byte - 1);
+   ((IFX_void_t **)alignedAddr)[-1] = pRawBlock;
+
+   return (IFX_void_t *)alignedAddr;
+}
+
+/**
+   LINUX Kernel - Free an aligned Memory Space
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeAligned(
+               IFX_void_t  *pMemBlock)
+{
+   if (pMemBlock == IFX_NULL)
+   {
+      IFXOS_PRN_INT_ERR_NL(IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("WARNING - Cannot free NULL pointer" IFXOS_CRLF));
+      return;
+   }
+
+   IFXOS_MemFree(((IFX_void_t **)pMemBlock)[-1]);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_ALIGNED) && (IFXOS_HAVE_MEM_ALLOC_ALIGNED == 1) ) */
+
+#if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) )
+
+/**
+   Large memory block - backing of a block, kept within a list for the free.
+*/
+typedef struct IFXOS_MemLargeDesc_s
+{
+   /** next block */
+   struct IFXOS_MemLargeDesc_s *pNext;
+   /** start of the block */
+   IFX_void_t     *pBlock;
+   /** size of the block [byte], page aligned */
+   IFX_size_t     mapSize;
+   /** IFX_TRUE: pages from the page allocator (linear mapping),
+       IFX_FALSE: vmalloc */
+   IFX_boolean_t  bContiguous;
+} IFXOS_MemLargeDesc_t;
+
+/** list of the large memory blocks */
+static IFXOS_MemLargeDesc_t *pIFXOS_memLargeList = IFX_NULL;
+/** protects the list of the large memory blocks */
+static DEFINE_SPINLOCK(IFXOS_memLargeLock);
+
+/**
+   LINUX Kernel - Allocate a large, page aligned Memory Space
+
+\par Implementation
+   - Without flags the block is allocated with the kernel function "vmalloc".
+   - With IFXOS_MEM_LARGE_FLAG_CONTIGUOUS / IFXOS_MEM_LARGE_FLAG_DMA the block
+     is allocated with the kernel function "alloc_pages_exact" (physically
+     contiguous, DMA: from the DMA32 zone if available).
+     The cache coherency for a DMA transfer (dma_map_single / dma_sync_xxx)
+     is up to the driver which owns the device.
+   - IFXOS_MEM_LARGE_FLAG_HUGE_PAGE also selects "alloc_pages_exact", the
+     linear mapping of the kernel is mapped with large pages on most
+     architectures. If this fails "vmalloc" is used.
+   This implementation is not allowed on interrupt level (may sleep).
+
+\param
+   memSize_byte   Size of the requested memory block [byte]
+\param
+   flags          Large memory flags, see IFXOS_MEM_LARGE_FLAG_xxx.
+
+\return
+   IFX_NULL in case of error, else
+   pointer to the allocated memory block.
+*/
+IFX_void_t *IFXOS_MemAllocLarge(
+               IFX_size_t     memSize_byte,
+               IFX_uint32_t   flags)
+{
+   IFXOS_MemLargeDesc_t *pDesc;
+   IFX_void_t           *pBlock = IFX_NULL;
+   gfp_t                gfpFlags = GFP_KERNEL | __GFP_NOWARN;
+   unsigned long        lockFlags;
+
+   if (memSize_byte == 0)
+   {
+      return IFX_NULL;
+   }
+
+   pDesc = (IFXOS_MemLargeDesc_t *)kmalloc(sizeof(IFXOS_MemLargeDesc_t), GFP_KERNEL);
+   if (pDesc == IFX_NULL)
+   {
+      return IFX_NULL;
+   }
+   pDesc->mapSize     = PAGE_ALIGN(memSize_byte);
+   pDesc->bContiguous = IFX_FALSE;
+
+   if (flags & (IFXOS_MEM_LARGE_FLAG_CONTIGUOUS | IFXOS_MEM_LARGE_FLAG_DMA | IFXOS_MEM_LARGE_FLAG_HUGE_PAGE))
+   {
+      if (flags & IFXOS_MEM_LARGE_FLAG_DMA)
+         gfpFlags |= IFXOS_MEM_LARGE_GFP_DMA;
+      if (flags & IFXOS_MEM_LARGE_FLAG_ZERO)
+         gfpFlags |= __GFP_ZERO;
+
+      pBlock = alloc_pages_exact(pDesc->mapSize, gfpFlags);
+      if (pBlock != IFX_NULL)
+      {
+         pDesc->bContiguous = IFX_TRUE;
+      }
+      else if (flags & (IFXOS_MEM_LARGE_FLAG_CONTIGUOUS | IFXOS_MEM_LARGE_FLAG_DMA))
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Mem Alloc Large, no contiguous block of %lu byte" IFXOS_CRLF,
+              (IFX_ulong_t)pDesc->mapSize));
+
+         kfree(pDesc);
+         return IFX_NULL;
+      }
+   }
+
+   if (pBlock == IFX_NULL)
+   {
+      pBlock = vmalloc((unsigned long)pDesc->mapSize);
+      if (pBlock == IFX_NULL)
+      {
+         kfree(pDesc);
+         return IFX_NULL;
+      }
+      if (flags & IFXOS_MEM_LARGE_FLAG_ZERO)
+         memset(pBlock, 0x00, pDesc->mapSize);
+   }
+   pDesc->pBlock = pBlock;
+
+   spin_lock_irqsave(&IFXOS_memLargeLock, lockFlags);
+   pDesc->pNext = pIFXOS_memLargeList;
+   pIFXOS_memLargeList = pDesc;
+   spin_unlock_irqrestore(&IFXOS_memLargeLock, lockFlags);
+
+   IFXOS_SYS_MEM_LARGE_ALLOC_ADD(IFX_NULL, pDesc->mapSize, pDesc->bContiguous);
+   IFXOS_MEM_TRACK_ADD(pBlock, pDesc->mapSize);
+
+   return pBlock;
+}
+
+/**
+   LINUX Kernel - Free a large Memory Space
+
+\par Implementation
+   Free the block with the kernel function "free_pages_exact" or "vfree"
+   dependent on the backing.
+
+\param
+   pMemBlock   Points to the memory block to free.
+*/
+IFX_void_t IFXOS_MemFreeLarge(
+               IFX_void_t     *pMemBlock)
+{
+   IFXOS_MemLargeDesc_t *pDesc, **ppPrev;
+   unsigned long        lockFlags;
+
+   if (pMemBlock == IFX_NULL)
+   {
+      IFXOS_PRN_INT_ERR_NL(IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("WARNING - Cannot free NULL pointer" IFXOS_CRLF));
+      return;
+   }
+
+   spin_lock_irqsave(&IFXOS_memLargeLock, lockFlags);
+   for (ppPrev = &pIFXOS_memLargeList, pDesc = pIFXOS_memLargeList;
+        pDesc != IFX_NULL;
+        ppPrev = &pDesc->pNext, pDesc = pDesc->pNext)
+   {
+      if (pDesc->pBlock == pMemBlock)
+      {
+         *ppPrev = pDesc->pNext;
+         break;
+      }
+   }
+   spin_unlock_irqrestore(&IFXOS_memLargeLock, lockFlags);
+
+   if (pDesc == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Mem Free Large, 0x%p is not a large block" IFXOS_CRLF,
+           pMemBlock));
+      return;
+   }
+
+   IFXOS_MEM_TRACK_REMOVE(pMemBlock);
+   if (pDesc->bContiguous == IFX_TRUE)
+      free_pages_exact(pMemBlock, pDesc->mapSize);
+   else
+      vfree(pMemBlock);
+   IFXOS_SYS_MEM_LARGE_FREE_ADD(IFX_NULL, pDesc->mapSize);
+
+   kfree(pDesc);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_MEM_ALLOC_LARGE) && (IFXOS_HAVE_MEM_ALLOC_LARGE == 1) ) */
+
 /** @} */
 
 #ifdef MODULE
 EXPORT_SYMBOL(IFXOS_BlockAlloc);
 EXPORT_SYMBOL(IFXOS_BlockFree);
 EXPORT_SYMBOL(IFXOS_MemAlloc);
+EXPORT_SYMBOL(IFXOS_MemAllocFlags);
+EXPORT_SYMBOL(IFXOS_MemAllocCaller);
 EXPORT_SYMBOL(IFXOS_MemFree);
+EXPORT_SYMBOL(IFXOS_MemAllocAligned);
+EXPORT_SYMBOL(IFXOS_MemFreeAligned);
+EXPORT_SYMBOL(IFXOS_MemAllocLarge);
+EXPORT_SYMBOL(IFXOS_MemFreeLarge);
 #endif
 
 #endif      /* #ifdef __KERNEL__ */
@@ -18,32 +18,257 @@
    The intention of this layer is to allow a application / driver simulation
    within the LINUX user space
    The simulation is base on the IFXOS DevIo implementation.
+   For the access of a real HW from user space a mapping device ("/dev/mem"
+   or an UIO device) can be set, the physical address range is then mapped
+   via "mmap".
 
 */
 
 /* ============================================================================
    IFX LINUX User Space adaptation - Global Includes
    ========================================================================= */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 
 #include "ifx_types.h"
 #include "ifxos_debug.h"
 #include "ifxos_rt_if_check.h"
 #include "ifxos_memory_map.h"
 
+/* ============================================================================
+   IFX LINUX User Space adaptation - memory mapping, local defines
+   ========================================================================= */
+
+#ifdef IFXOS_STATIC
+#undef IFXOS_STATIC
+#endif
+
+#ifdef IFXOS_DEBUG
+#define IFXOS_STATIC
+#else
+#define IFXOS_STATIC   static
+#endif
+
+/** max length of the mapping device name */
+#define IFXOS_PHY2VIRT_DEV_NAME_LEN       64
+/** max number of maps of an UIO device */
+#define IFXOS_PHY2VIRT_UIO_MAPS_MAX       5
+/** name prefix of an UIO device */
+#define IFXOS_PHY2VIRT_UIO_PREFIX         "/dev/uio"
+
+/**
+   Mapped region - one mmap of the mapping device.
+*/
+typedef struct IFXOS_Phy2VirtRegion_s
+{
+   /** next region */
+   struct IFXOS_Phy2VirtRegion_s *pNext;
+   /** physical start address (page aligned) */
+   IFX_ulong_t    physStart;
+   /** size of the region [byte] (page aligned) */
+   IFX_ulong_t    size;
+   /** virtual start address */
+   IFX_uint8_t    *pVirtStart;
+   /** number of IFXOS_Phy2VirtMap calls which use this region */
+   IFX_uint_t     refCount;
+} IFXOS_Phy2VirtRegion_t;
+
+/* ============================================================================
+   IFX LINUX User Space adaptation - memory mapping, local variables
+   ========================================================================= */
+
+/** protects the mapping device and the region list */
+static pthread_mutex_t IFXOS_phy2VirtLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** mapping device, empty: direct assignment */
+static IFX_char_t IFXOS_phy2VirtDevName[IFXOS_PHY2VIRT_DEV_NAME_LEN] = {0};
+/** mapping device has been initialized with the default */
+static IFX_boolean_t IFXOS_phy2VirtDevInit = IFX_FALSE;
+/** mapping device file descriptor, open as long as a region is mapped */
+static int IFXOS_phy2VirtFd = -1;
+
+/** list of the mapped regions */
+static IFXOS_Phy2VirtRegion_t *IFXOS_pPhy2VirtRegions = IFX_NULL;
+
+/* ============================================================================
+   IFX LINUX User Space adaptation - memory mapping, local functions
+   ========================================================================= */
+
+/**
+   Set the mapping device name (lock taken).
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_Phy2VirtDevNameSet(
+               const IFX_char_t  *pDevName)
+{
+   if (pDevName == IFX_NULL)
+   {
+      IFXOS_phy2VirtDevName[0] = '\0';
+   }
+   else
+   {
+      if (strlen(pDevName) >= IFXOS_PHY2VIRT_DEV_NAME_LEN)
+      {
+         return IFX_ERROR;
+      }
+      strcpy(IFXOS_phy2VirtDevName, pDevName);
+   }
+   IFXOS_phy2VirtDevInit = IFX_TRUE;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   Read a hex value of the UIO sysfs map description.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_Phy2VirtUioValueGet(
+               const IFX_char_t  *pUioName,
+               IFX_int_t         mapIdx,
+               const IFX_char_t  *pAttr,
+               IFX_ulong_t       *pValue)
+{
+   IFX_char_t  path[128];
+   FILE        *pFile;
+   IFX_int_t   ret;
+
+   snprintf(path, sizeof(path), "/sys/class/uio/%s/maps/map%d/%s",
+            pUioName, mapIdx, pAttr);
+
+   pFile = fopen(path, "r");
+   if (pFile == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+   ret = fscanf(pFile, "%lx", pValue);
+   fclose(pFile);
+
+   return (ret == 1) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   Get the mmap parameters of the given physical range.
+
+\remark
+   /dev/mem (or a stand-in file): the page aligned physical address is the
+   file offset.
+   UIO device: the range must be part of a map of the device, the whole map
+   is mapped at the offset "map index * page size".
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_Phy2VirtParamsGet(
+               IFX_ulong_t    physicalAddr,
+               IFX_ulong_t    addrRangeSize_byte,
+               IFX_ulong_t    pageSize,
+               IFX_ulong_t    *pPhysStart,
+               IFX_ulong_t    *pSize,
+               off_t          *pOffset)
+{
+   const IFX_char_t  *pUioName;
+   IFX_ulong_t       mapAddr, mapSize;
+   IFX_int_t         mapIdx;
+
+   if (strncmp(IFXOS_phy2VirtDevName, IFXOS_PHY2VIRT_UIO_PREFIX,
+               strlen(IFXOS_PHY2VIRT_UIO_PREFIX)) != 0)
+   {
+      *pPhysStart = physicalAddr & ~(pageSize - 1);
+      *pSize      = (physicalAddr - *pPhysStart + addrRangeSize_byte + pageSize - 1)
+                     & ~(pageSize - 1);
+      *pOffset    = (off_t)*pPhysStart;
+
+      return IFX_SUCCESS;
+   }
+
+   pUioName = IFXOS_phy2VirtDevName + strlen("/dev/");
+   for (mapIdx = 0; mapIdx < IFXOS_PHY2VIRT_UIO_MAPS_MAX; mapIdx++)
+   {
+      if ( (IFXOS_Phy2VirtUioValueGet(pUioName, mapIdx, "addr", &mapAddr) != IFX_SUCCESS) ||
+           (IFXOS_Phy2VirtUioValueGet(pUioName, mapIdx, "size", &mapSize) != IFX_SUCCESS) )
+      {
+         break;
+      }
+
+      if ( (physicalAddr >= mapAddr) &&
+           (physicalAddr + addrRangeSize_byte <= mapAddr + mapSize) )
+      {
+         *pPhysStart = mapAddr & ~(pageSize - 1);
+         *pSize      = (mapAddr - *pPhysStart + mapSize + pageSize - 1)
+                        & ~(pageSize - 1);
+         *pOffset    = (off_t)mapIdx * (off_t)pageSize;
+
+         return IFX_SUCCESS;
+      }
+   }
+
+   IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+      ("IFXOS ERROR - Phy2Virt map, 0x%08lX (size 0x%lX) not within a map of %s" IFXOS_CRLF,
+        physicalAddr, addrRangeSize_byte, IFXOS_phy2VirtDevName));
+
+   return IFX_ERROR;
+}
+
 /* ============================================================================
    IFX LINUX User Space adaptation - memory mapping
    ========================================================================= */
 /** \addtogroup IFXOS_MEMORY_MAP_LINUX_APPL
 @{ */
 
+/**
+   Linux Appl - Set the device used for the physical to virtual address mapping.
+
+\param
+   pDevName    Name of the device, for example "/dev/mem" or "/dev/uio0".
+               A regular file can be used as stand-in of the physical memory.
+               IFX_NULL selects the direct assignment of the physical address.
+
+\return
+   IFX_SUCCESS if the device has been set, else
+   IFX_ERROR   if a mapping is still active or the name is too long.
+*/
+IFX_int32_t IFXOS_Phy2VirtDeviceSet(
+               const IFX_char_t  *pDevName)
+{
+   IFX_int32_t retVal;
+
+   pthread_mutex_lock(&IFXOS_phy2VirtLock);
+
+   if (IFXOS_pPhy2VirtRegions != IFX_NULL)
+   {
+      pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Phy2Virt device set, mapping of %s still active" IFXOS_CRLF,
+           IFXOS_phy2VirtDevName));
+
+      return IFX_ERROR;
+   }
+
+   retVal = IFXOS_Phy2VirtDevNameSet(pDevName);
+
+   pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+   if (retVal != IFX_SUCCESS)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Phy2Virt device set, invalid name" IFXOS_CRLF));
+   }
+
+   return retVal;
+}
+
 /**
    Linux Appl - Map the physical address to a virtual memory space.
    For virtual memory management this is required.
 
 \par Implementation
-   Under LINUX User Space there is no virtal memory management required.
-   This function is introduced for compatibility agains the LINUX concept.
-   A simple asignment of the physical address is done.
+   Without a mapping device (default, see \ref IFXOS_PHY2VIRT_DEVICE_DEFAULT)
+   a simple asignment of the physical address is done (simulation).
+   With a mapping device the page aligned range is mapped via "mmap".
+   A range which is within an already mapped region reuses this region
+   (reference counted), else a new region is mapped - also if the range
+   overlaps an existing region only partly.
 
 \param
    physicalAddr         The physical address for mapping [I]
@@ -67,15 +292,107 @@ IFX_int32_t IFXOS_Phy2VirtMap(
                IFX_char_t     *pName,
                IFX_uint8_t    **ppVirtAddr)
 {
-   IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_LOW,
-      ("IFXOS: Phy2Virt map - phy 0x%08lX --> virt 0x%08X, size = 0x%X" IFXOS_CRLF,
-        physicalAddr, physicalAddr, addrRangeSize_byte ));
+   IFXOS_Phy2VirtRegion_t  *pRegion;
+   IFX_ulong_t             pageSize, physStart, size;
+   off_t                   offset;
+   IFX_void_t              *pMap;
 
    IFXOS_RETURN_IF_POINTER_NULL(ppVirtAddr, IFX_ERROR);
    IFXOS_RETURN_IF_POINTER_NOT_NULL(*ppVirtAddr, IFX_ERROR);
    IFXOS_RETURN_IF_ARG_LE_ZERO(addrRangeSize_byte, IFX_ERROR);
 
-   *ppVirtAddr = (IFX_uint8_t *)physicalAddr;
+   pthread_mutex_lock(&IFXOS_phy2VirtLock);
+
+   if (IFXOS_phy2VirtDevInit == IFX_FALSE)
+   {
+      (void)IFXOS_Phy2VirtDevNameSet(IFXOS_PHY2VIRT_DEVICE_DEFAULT);
+   }
+
+   if (IFXOS_phy2VirtDevName[0] == '\0')
+   {
+      pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+      IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_LOW,
+         ("IFXOS: Phy2Virt map - phy 0x%08lX --> virt 0x%08lX, size = 0x%lX" IFXOS_CRLF,
+           physicalAddr, physicalAddr, addrRangeSize_byte ));
+
+      *ppVirtAddr = (IFX_uint8_t *)physicalAddr;
+
+      return IFX_SUCCESS;
+   }
+
+   /* reuse a region which contains the whole range */
+   for (pRegion = IFXOS_pPhy2VirtRegions; pRegion != IFX_NULL; pRegion = pRegion->pNext)
+   {
+      if ( (physicalAddr >= pRegion->physStart) &&
+           (physicalAddr + addrRangeSize_byte <= pRegion->physStart + pRegion->size) )
+      {
+         break;
+      }
+   }
+
+   if (pRegion == IFX_NULL)
+   {
+      pageSize = (IFX_ulong_t)sysconf(_SC_PAGESIZE);
+      if (IFXOS_Phy2VirtParamsGet(physicalAddr, addrRangeSize_byte, pageSize,
+                                  &physStart, &size, &offset) != IFX_SUCCESS)
+      {
+         pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+         return IFX_ERROR;
+      }
+
+      if (IFXOS_phy2VirtFd < 0)
+      {
+         IFXOS_phy2VirtFd = open(IFXOS_phy2VirtDevName, O_RDWR | O_SYNC);
+         if (IFXOS_phy2VirtFd < 0)
+         {
+            pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+               ("IFXOS ERROR - Phy2Virt map, open %s failed" IFXOS_CRLF,
+                 IFXOS_phy2VirtDevName));
+
+            return IFX_ERROR;
+         }
+      }
+
+      pRegion = (IFXOS_Phy2VirtRegion_t *)malloc(sizeof(IFXOS_Phy2VirtRegion_t));
+      pMap = (pRegion != IFX_NULL) ?
+               mmap(IFX_NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    IFXOS_phy2VirtFd, offset) : MAP_FAILED;
+      if (pMap == MAP_FAILED)
+      {
+         free(pRegion);
+         if (IFXOS_pPhy2VirtRegions == IFX_NULL)
+         {
+            close(IFXOS_phy2VirtFd);
+            IFXOS_phy2VirtFd = -1;
+         }
+         pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - Phy2Virt map, mmap %s 0x%08lX (size 0x%lX) failed" IFXOS_CRLF,
+              IFXOS_phy2VirtDevName, physStart, size));
+
+         return IFX_ERROR;
+      }
+
+      pRegion->physStart  = physStart;
+      pRegion->size       = size;
+      pRegion->pVirtStart = (IFX_uint8_t *)pMap;
+      pRegion->refCount   = 0;
+      pRegion->pNext      = IFXOS_pPhy2VirtRegions;
+      IFXOS_pPhy2VirtRegions = pRegion;
+   }
+
+   pRegion->refCount++;
+   *ppVirtAddr = pRegion->pVirtStart + (physicalAddr - pRegion->physStart);
+
+   pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+   IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_LOW,
+      ("IFXOS: Phy2Virt map %s - phy 0x%08lX --> virt 0x%p, size = 0x%lX" IFXOS_CRLF,
+        (pName != IFX_NULL) ? pName : "", physicalAddr, *ppVirtAddr, addrRangeSize_byte ));
 
    return IFX_SUCCESS;
 }
@@ -85,9 +402,10 @@ IFX_int32_t IFXOS_Phy2VirtMap(
    For virtual memory management this is required.
 
 \par Implementation
-   Under LINUX User Space there is no virtal memory management required.
-   This function is introduced for compatibility agains the LINUX concept.
-   The simple asignment of the physical address is cleared.
+   Without a mapping device the simple asignment of the physical address is
+   cleared.
+   With a mapping device the reference of the region is released, the region
+   is unmapped with the last reference.
 
 \param
    pPhysicalAddr        Points to the physical address for release mapping [IO]
@@ -108,13 +426,56 @@ IFX_int32_t IFXOS_Phy2VirtUnmap(
                IFX_ulong_t    addrRangeSize_byte,
                IFX_uint8_t    **ppVirtAddr)
 {
+   IFXOS_Phy2VirtRegion_t  *pRegion, **ppPrev;
 
    /* unmap the virtual address */
-   if (ppVirtAddr != IFX_NULL)
+   if ((ppVirtAddr != IFX_NULL) && (*ppVirtAddr != IFX_NULL))
    {
       IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_LOW,
-         ("IFXOS: Phy2Virt Unmap - unmap virt 0x%08lX, size = 0x%X" IFXOS_CRLF,
-                         (*ppVirtAddr), addrRangeSize_byte ));
+         ("IFXOS: Phy2Virt Unmap - unmap virt 0x%p, size = 0x%lX" IFXOS_CRLF,
+           (*ppVirtAddr), addrRangeSize_byte ));
+
+      pthread_mutex_lock(&IFXOS_phy2VirtLock);
+
+      if (IFXOS_phy2VirtDevName[0] != '\0')
+      {
+         for (ppPrev = &IFXOS_pPhy2VirtRegions; *ppPrev != IFX_NULL; ppPrev = &(*ppPrev)->pNext)
+         {
+            pRegion = *ppPrev;
+            if ( (*ppVirtAddr >= pRegion->pVirtStart) &&
+                 (*ppVirtAddr <  pRegion->pVirtStart + pRegion->size) )
+            {
+               break;
+            }
+         }
+
+         if (*ppPrev == IFX_NULL)
+         {
+            pthread_mutex_unlock(&IFXOS_phy2VirtLock);
+
+            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+               ("IFXOS ERROR - Phy2Virt unmap, virt 0x%p not mapped" IFXOS_CRLF,
+                 *ppVirtAddr));
+
+            return IFX_ERROR;
+         }
+
+         pRegion = *ppPrev;
+         if (--pRegion->refCount == 0)
+         {
+            *ppPrev = pRegion->pNext;
+            munmap(pRegion->pVirtStart, (size_t)pRegion->size);
+            free(pRegion);
+
+            if (IFXOS_pPhy2VirtRegions == IFX_NULL)
+            {
+               close(IFXOS_phy2VirtFd);
+               IFXOS_phy2VirtFd = -1;
+            }
+         }
+      }
+
+      pthread_mutex_unlock(&IFXOS_phy2VirtLock);
 
       *ppVirtAddr = IFX_NULL;
    }
@@ -123,8 +484,8 @@ IFX_int32_t IFXOS_Phy2VirtUnmap(
    if (pPhysicalAddr != IFX_NULL)
    {
       IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_LOW,
-         ("IFXOS: Phy2Virt Unmap - release region 0x%08X size = 0x%X" IFXOS_CRLF,
-           (unsigned int)(*pPhysicalAddr), addrRangeSize_byte ));
+         ("IFXOS: Phy2Virt Unmap - release region 0x%08lX size = 0x%lX" IFXOS_CRLF,
+           (*pPhysicalAddr), addrRangeSize_byte ));
 
       *pPhysicalAddr = 0;
    }
@@ -29,6 +29,8 @@
    #include <linux/module.h>
 #endif
 #include <linux/ioport.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
 #include <asm/io.h>
 
 #include "ifx_types.h"
@@ -174,11 +176,134 @@ IFX_int32_t IFXOS_Phy2VirtUnmap(
    return IFX_SUCCESS;
 }
 
+#if ( defined(IFXOS_HAVE_DRV_SHM_RING) && (IFXOS_HAVE_DRV_SHM_RING == 1) )
+/**
+   LINUX Kernel - Allocate and format a ring which can be mapped to user space.
+
+\par Implementation
+   The ring (header and data area) is allocated page aligned and zeroed with
+   "vmalloc_user", so it can be mapped via "remap_vmalloc_range".
+
+\param
+   pRing          Points to the ring handle [O]
+\param
+   dataSize_byte  Size of the data area, power of 2 [I]
+
+\return
+   IFX_SUCCESS if the ring has been created, else
+   IFX_ERROR   invalid size or no memory.
+*/
+IFX_int32_t IFXOS_DrvShmRingCreate(
+               IFXOS_ShmRing_t   *pRing,
+               IFX_uint32_t      dataSize_byte)
+{
+   IFX_uint32_t   memSize_byte;
+   IFX_void_t     *pMem;
+
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, IFX_ERROR);
+
+   if ( (dataSize_byte < 4 * IFXOS_SHM_RING_REC_ALIGN) ||
+        ((dataSize_byte & (dataSize_byte - 1)) != 0) )
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Drv Shm Ring Create, invalid size %u" IFXOS_CRLF,
+           (unsigned int)dataSize_byte));
+
+      return IFX_ERROR;
+   }
+
+   memSize_byte = (IFX_uint32_t)PAGE_ALIGN(sizeof(IFXOS_ShmRingHdr_t) + dataSize_byte);
+   pMem = vmalloc_user((unsigned long)memSize_byte);
+   if (pMem == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Drv Shm Ring Create, no memory (%u byte)" IFXOS_CRLF,
+           (unsigned int)memSize_byte));
+
+      return IFX_ERROR;
+   }
+
+   if (IFXOS_ShmRingInit(pRing, pMem, memSize_byte, IFX_TRUE) != IFX_SUCCESS)
+   {
+      vfree(pMem);
+      pRing->pHdr = IFX_NULL;
+
+      return IFX_ERROR;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Kernel - Free a ring created by IFXOS_DrvShmRingCreate.
+
+\param
+   pRing       Points to the ring handle [I]
+
+\return
+   IFX_SUCCESS if the ring has been freed, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_DrvShmRingDelete(
+               IFXOS_ShmRing_t   *pRing)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, IFX_ERROR);
+
+   if (pRing->pHdr == IFX_NULL)
+   {
+      return IFX_ERROR;
+   }
+
+   vfree(pRing->pHdr);
+   pRing->pHdr  = IFX_NULL;
+   pRing->pData = IFX_NULL;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Kernel - Map the ring into the user address space.
+
+\par Implementation
+   The ring is mapped from its start via "remap_vmalloc_range", the mmap
+   offset is not evaluated (can be used by the driver to select a ring).
+
+\param
+   pRing       Points to the ring handle [I]
+\param
+   pMmapArg    Virtual memory area, comes from the mmap call [I]
+
+\return
+   IFX_SUCCESS if the ring has been mapped, else
+   IFX_ERROR.
+*/
+IFX_int32_t IFXOS_DrvShmRingMmap(
+               IFXOS_ShmRing_t      *pRing,
+               IFXOS_drvMmapArg_t   *pMmapArg)
+{
+   IFXOS_RETURN_IF_POINTER_NULL(pRing, IFX_ERROR);
+   IFXOS_RETURN_IF_POINTER_NULL(pMmapArg, IFX_ERROR);
+
+   if ( (pRing->pHdr == IFX_NULL) ||
+        ((pMmapArg->vm_end - pMmapArg->vm_start) > pRing->memSize_byte) )
+   {
+      return IFX_ERROR;
+   }
+
+   return (remap_vmalloc_range(pMmapArg, pRing->pHdr, 0) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_DRV_SHM_RING) && (IFXOS_HAVE_DRV_SHM_RING == 1) ) */
+
 /** @} */
 
 #ifdef MODULE
 EXPORT_SYMBOL(IFXOS_Phy2VirtMap);
 EXPORT_SYMBOL(IFXOS_Phy2VirtUnmap);
+#if ( defined(IFXOS_HAVE_DRV_SHM_RING) && (IFXOS_HAVE_DRV_SHM_RING == 1) )
+EXPORT_SYMBOL(IFXOS_DrvShmRingCreate);
+EXPORT_SYMBOL(IFXOS_DrvShmRingDelete);
+EXPORT_SYMBOL(IFXOS_DrvShmRingMmap);
+#endif
 #endif
 
 #endif      /* #ifdef __KERNEL__ */
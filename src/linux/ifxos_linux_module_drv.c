@@ -42,6 +42,7 @@
 #include <linux/init.h>
 
 #include "ifxos_debug.h"
+#include "ifxos_memory_alloc.h"
 
 #if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
 #  include "ifxos_sys_show.h"
@@ -116,6 +117,10 @@ IFXOS_STATIC void __exit IFXOS_ModuleExit (void)
       If required do the basic cleanup here
    */
 
+#if ( defined(IFXOS_HAVE_MEM_TRACK) && (IFXOS_HAVE_MEM_TRACK == 1) )
+   (void)IFXOS_MemTrackRelease();
+#endif
+
 #if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
    IFXOS_SYS_OBJECT_CLEANUP(0);
 #endif
@@ -31,7 +31,11 @@
 #include <errno.h>
 #include <sys/prctl.h>
 #include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <unistd.h>
+#include <time.h>
 
 #include "ifx_types.h"
 #include "ifxos_rt_if_check.h"
@@ -68,11 +72,59 @@
 IFXOS_STATIC IFX_int32_t IFXOS_UserThreadStartup(
                               IFXOS_ThreadCtrl_t *pThrCntrl);
 
+IFXOS_STATIC IFX_void_t IFXOS_UserThreadUsageUpdate(
+                              IFXOS_ThreadCtrl_t *pThrCntrl);
+
+IFXOS_STATIC IFX_int32_t IFXOS_UserThreadSemWait(
+                              sem_t              *pSem,
+                              IFX_uint32_t       waitTime_ms);
+
+IFXOS_STATIC IFX_int32_t IFXOS_UserThreadCreate(
+                              IFXOS_ThreadCtrl_t *pThrCntrl,
+                              const IFX_char_t   *pName,
+                              IFXOS_ThreadFunction_t pThreadFunction,
+                              IFX_uint32_t       nPriority,
+                              IFX_ulong_t        nArg1,
+                              IFX_ulong_t        nArg2,
+                              IFX_boolean_t      bStartWait);
+
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1)
+/** points to the sys object of the current IFXOS user thread */
+__thread IFX_void_t *IFXOS_pSysObjectThreadSelf = IFX_NULL;
+#endif
 
 /* ============================================================================
    IFX Linux adaptation - Application Thread handling
    ========================================================================= */
 
+/**
+   LINUX Application - Sample the resource usage of the calling thread into
+   the thread sys object.
+
+\par Implementation
+   The CPU times and context switches are taken from "getrusage(RUSAGE_THREAD)".
+
+\param
+   pThrCntrl   Thread control data of the calling thread.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_UserThreadUsageUpdate(
+                              IFXOS_ThreadCtrl_t *pThrCntrl)
+{
+#if defined(HAVE_IFXOS_SYSOBJ_SUPPORT) && (HAVE_IFXOS_SYSOBJ_SUPPORT == 1) && defined(RUSAGE_THREAD)
+   struct rusage usage;
+
+   if (getrusage(RUSAGE_THREAD, &usage) == 0)
+   {
+      IFXOS_SYS_THREAD_USAGE_SET(pThrCntrl->thrParams.pSysObject,
+         ((IFX_uint_t)usage.ru_utime.tv_sec * 1000U) + (IFX_uint_t)(usage.ru_utime.tv_usec / 1000),
+         ((IFX_uint_t)usage.ru_stime.tv_sec * 1000U) + (IFX_uint_t)(usage.ru_stime.tv_usec / 1000),
+         usage.ru_nvcsw, usage.ru_nivcsw);
+   }
+#endif
+
+   return;
+}
+
 /**
    LINUX Application - Thread stub function. The stub function will be called
    before calling the user defined thread routine. This gives
@@ -111,9 +163,11 @@ IFXOS_STATIC IFX_int32_t IFXOS_UserThreadStartup(
             IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
                ("IFXOS - User Thread Startup <%s> - sem_post = %d" IFXOS_CRLF,
                  pThrCntrl->thrParams.pName, err ));
-            return IFX_ERROR;
          }
 
+         /* wakeup the deleter - the control struct must not be accessed after this */
+         sem_post(&pThrCntrl->thread_done);
+
          return IFX_ERROR;
       }
 
@@ -125,20 +179,35 @@ IFXOS_STATIC IFX_int32_t IFXOS_UserThreadStartup(
       prctl(PR_SET_NAME, pThrCntrl->thrParams.pName, 0, 0, 0);
 #endif
 
+#ifdef SYS_gettid
+      IFXOS_SYS_THREAD_TASK_ID_SET(pThrCntrl->thrParams.pSysObject, syscall(SYS_gettid));
+#endif
+      IFXOS_SYS_THREAD_SELF_SET(pThrCntrl->thrParams.pSysObject);
+
       pThrCntrl->thrParams.bRunning = IFX_TRUE;
       err = sem_post(&pThrCntrl->thread_active);
       if (err) {
          IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
             ("IFXOS - User Thread Startup <%s> - sem_post = %d" IFXOS_CRLF,
               pThrCntrl->thrParams.pName, err ));
-         return IFX_ERROR;
       }
-      retVal = pThrCntrl->pThrFct(&pThrCntrl->thrParams);
-      pThrCntrl->thrParams.bRunning = IFX_FALSE;
+      else
+      {
+         retVal = pThrCntrl->pThrFct(&pThrCntrl->thrParams);
+
+         /* keep the final resource usage until the thread is deleted */
+         IFXOS_UserThreadUsageUpdate(pThrCntrl);
+      }
+      IFXOS_SYS_THREAD_SELF_SET(IFX_NULL);
 
       IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_NORMAL,
          ("IFXOS - User Thread Startup <%s>, TID %ld (PID %d) - EXIT" IFXOS_CRLF,
            pThrCntrl->thrParams.pName, (IFX_long_t)pthread_self(), (IFX_int_t)getpid()));
+
+      pThrCntrl->thrParams.bRunning = IFX_FALSE;
+
+      /* wakeup the deleter - the control struct must not be accessed after this */
+      sem_post(&pThrCntrl->thread_done);
    }
    else
    {
@@ -150,13 +219,112 @@ IFXOS_STATIC IFX_int32_t IFXOS_UserThreadStartup(
    return retVal;
 }
 
+/**
+   LINUX Application - Wait for a signal of the thread stub.
+
+\par Implementation
+   The thread stub signals the "thread_active" semaphore after the thread
+   startup and the "thread_done" semaphore on each exit of the thread stub
+   (user thread routine returned or startup error). So the caller is woken
+   up immediately instead of polling the run state.
+
+\param
+   pSem        Points to the thread control semaphore to wait for.
+\param
+   waitTime_ms Time [ms] to wait for the signal.
+
+\return
+   - IFX_SUCCESS the signal has been received.
+   - IFX_ERROR timeout or error.
+*/
+IFXOS_STATIC IFX_int32_t IFXOS_UserThreadSemWait(
+                              sem_t              *pSem,
+                              IFX_uint32_t       waitTime_ms)
+{
+   struct timespec t;
+   int ret;
+
+   if (waitTime_ms == IFXOS_THREAD_DELETE_WAIT_FOREVER)
+   {
+      do
+      {
+         ret = sem_wait(pSem);
+      } while ((ret != 0) && (errno == EINTR));
+   }
+   else
+   {
+      clock_gettime(CLOCK_REALTIME, &t);
+      t.tv_sec +=  (waitTime_ms / 1000);
+      t.tv_nsec += (waitTime_ms % 1000) * 1000 * 1000;
+      /* recalculate if tv_nsec exceeds 1 sec */
+      if (t.tv_nsec >= 1000000000)
+      {
+         t.tv_sec++;
+         t.tv_nsec -= 1000000000;
+      }
+
+      do
+      {
+         ret = sem_timedwait(pSem, &t);
+      } while ((ret != 0) && (errno == EINTR));
+   }
+
+   return (ret == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   LINUX Application - Pass a pending startup handshake before a delete or
+   shutdown of an asynchronous created thread.
+
+\par Implementation
+   The wait for the startup handshake is part of the given wait time, the
+   remaining time is returned for the wait for the thread end.
+
+\param
+   pThrCntrl   Thread control struct.
+\param
+   waitTime_ms Time [ms] to wait for the startup and the thread end.
+
+\return
+   Remaining wait time [ms].
+*/
+IFXOS_STATIC IFX_uint32_t IFXOS_UserThreadStartPass(
+                              IFXOS_ThreadCtrl_t *pThrCntrl,
+                              IFX_uint32_t       waitTime_ms)
+{
+   IFX_time_t startTime_ms, elapsedTime_ms;
+
+   if (pThrCntrl->bStartPending == IFX_FALSE)
+   {
+      return waitTime_ms;
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+   if (IFXOS_UserThreadSemWait(&pThrCntrl->thread_active, waitTime_ms) != IFX_SUCCESS)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("IFXOS WRN - User Thread <%s> - startup pending" IFXOS_CRLF,
+           pThrCntrl->thrParams.pName));
+   }
+   pThrCntrl->bStartPending = IFX_FALSE;
+
+   if (waitTime_ms == IFXOS_THREAD_DELETE_WAIT_FOREVER)
+   {
+      return waitTime_ms;
+   }
+
+   elapsedTime_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+
+   return (elapsedTime_ms < waitTime_ms) ? (waitTime_ms - elapsedTime_ms) : 0;
+}
+
 /**
    LINUX Application - Creates a new thread / task.
 
 \par Implementation
-   - Allocate and setup the internal thread control structure.
-   - setup the LINUX specific thread parameter (see "init_completion").
-   - start the LINUX Kernel thread with the internal stub function (see "kernel_thread")
+   - setup the thread control structure and the control semaphores.
+   - start the LINUX User thread with the internal stub function (see "pthread_create")
+   - optional wait for the startup handshake of the new thread.
 
 \param
    pThrCntrl         Pointer to thread control structure. This structure has to
@@ -165,27 +333,28 @@ IFXOS_STATIC IFX_int32_t IFXOS_UserThreadStartup(
    pName             specifies the 8-char thread / task name.
 \param
    pThreadFunction   specifies the user entry function of the thread / task.
-\param
-   nStackSize        specifies the size of the thread stack - not used.
 \param
    nPriority         specifies the thread priority, 0 will be ignored
 \param
    nArg1             first argument passed to thread / task entry function.
 \param
    nArg2             second argument passed to thread / task entry function.
+\param
+   bStartWait        IFX_TRUE: wait until the new thread has been started,
+                     IFX_FALSE: the startup handshake is kept pending.
 
 \return
    - IFX_SUCCESS thread was successful started.
    - IFX_ERROR thread was not started
 */
-IFX_int32_t IFXOS_ThreadInit(
-               IFXOS_ThreadCtrl_t *pThrCntrl,
-               const IFX_char_t   *pName,
-               IFXOS_ThreadFunction_t pThreadFunction,
-               IFX_uint32_t   nStackSize,
-               IFX_uint32_t   nPriority,
-               IFX_ulong_t    nArg1,
-               IFX_ulong_t    nArg2)
+IFXOS_STATIC IFX_int32_t IFXOS_UserThreadCreate(
+                              IFXOS_ThreadCtrl_t *pThrCntrl,
+                              const IFX_char_t   *pName,
+                              IFXOS_ThreadFunction_t pThreadFunction,
+                              IFX_uint32_t       nPriority,
+                              IFX_ulong_t        nArg1,
+                              IFX_ulong_t        nArg2,
+                              IFX_boolean_t      bStartWait)
 {
    IFX_int32_t          retVal=0;
    pthread_t            tid;
@@ -220,6 +389,15 @@ IFX_int32_t IFXOS_ThreadInit(
             return IFX_ERROR;
          }
 
+         err = sem_init(&pThrCntrl->thread_done, 0, 0);
+         if (err) {
+            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+               ("IFXOS ERROR - User Thread create <%s> - sem_init = %d" IFXOS_CRLF,
+                 (pName ? (pName) : "noname"), err ));
+            sem_destroy(&pThrCntrl->thread_active);
+            return IFX_ERROR;
+         }
+
          /* set thread control settings */
          pThrCntrl->pThrFct = pThreadFunction;
 
@@ -248,21 +426,29 @@ IFX_int32_t IFXOS_ThreadInit(
                ("IFXOS ERROR - User Thread create <%s> - pthread_create = %d" IFXOS_CRLF,
                  (pName ? (pName) : "noname"), retVal ));
 
+            sem_destroy(&pThrCntrl->thread_done);
+            sem_destroy(&pThrCntrl->thread_active);
+            IFXOS_SYS_OBJECT_RELEASE(pThrCntrl->thrParams.pSysObject);
+
             return IFX_ERROR;
          }
 
-         err = sem_wait(&pThrCntrl->thread_active);
-         if (err) {
-            IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
-               ("IFXOS ERROR - User Thread create <%s> - sem_wait = %d" IFXOS_CRLF,
-                 (pName ? (pName) : "noname"), err ));
-            return IFX_ERROR;
+         if (bStartWait == IFX_TRUE)
+         {
+            err = sem_wait(&pThrCntrl->thread_active);
+            if (err) {
+               IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+                  ("IFXOS ERROR - User Thread create <%s> - sem_wait = %d" IFXOS_CRLF,
+                    (pName ? (pName) : "noname"), err ));
+               return IFX_ERROR;
+            }
          }
 
          /* use pthread_detach() so all resources are released upon thread termination  */
          pthread_detach(tid);
 
          pThrCntrl->tid = tid;
+         pThrCntrl->bStartPending = (bStartWait == IFX_TRUE) ? IFX_FALSE : IFX_TRUE;
          pThrCntrl->bValid = IFX_TRUE;
 
          return IFX_SUCCESS;
@@ -280,6 +466,230 @@ IFX_int32_t IFXOS_ThreadInit(
 }
 
 
+/**
+   LINUX Application - Creates a new thread / task.
+
+\par Implementation
+   - create the thread and wait for the startup (see "IFXOS_UserThreadCreate").
+
+\param
+   pThrCntrl         Pointer to thread control structure. This structure has to
+                     be allocated outside and will be initialized.
+\param
+   pName             specifies the 8-char thread / task name.
+\param
+   pThreadFunction   specifies the user entry function of the thread / task.
+\param
+   nStackSize        specifies the size of the thread stack - not used.
+\param
+   nPriority         specifies the thread priority, 0 will be ignored
+\param
+   nArg1             first argument passed to thread / task entry function.
+\param
+   nArg2             second argument passed to thread / task entry function.
+
+\return
+   - IFX_SUCCESS thread was successful started.
+   - IFX_ERROR thread was not started
+*/
+IFX_int32_t IFXOS_ThreadInit(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               const IFX_char_t   *pName,
+               IFXOS_ThreadFunction_t pThreadFunction,
+               IFX_uint32_t   nStackSize,
+               IFX_uint32_t   nPriority,
+               IFX_ulong_t    nArg1,
+               IFX_ulong_t    nArg2)
+{
+   return IFXOS_UserThreadCreate(
+            pThrCntrl, pName, pThreadFunction, nPriority, nArg1, nArg2, IFX_TRUE);
+}
+
+#if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) )
+/**
+   LINUX Application - Creates a new thread / task without waiting for the
+   startup of the new thread.
+
+\par Implementation
+   - create the thread, the startup handshake is kept pending
+     (see "IFXOS_UserThreadCreate").
+
+\param
+   pThrCntrl         Pointer to thread control structure. This structure has to
+                     be allocated outside and will be initialized.
+\param
+   pName             specifies the 8-char thread / task name.
+\param
+   pThreadFunction   specifies the user entry function of the thread / task.
+\param
+   nStackSize        specifies the size of the thread stack - not used.
+\param
+   nPriority         specifies the thread priority, 0 will be ignored
+\param
+   nArg1             first argument passed to thread / task entry function.
+\param
+   nArg2             second argument passed to thread / task entry function.
+
+\return
+   - IFX_SUCCESS thread was successful created.
+   - IFX_ERROR thread was not created
+*/
+IFX_int32_t IFXOS_ThreadInitAsync(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               const IFX_char_t   *pName,
+               IFXOS_ThreadFunction_t pThreadFunction,
+               IFX_uint32_t   nStackSize,
+               IFX_uint32_t   nPriority,
+               IFX_ulong_t    nArg1,
+               IFX_ulong_t    nArg2)
+{
+   return IFXOS_UserThreadCreate(
+            pThrCntrl, pName, pThreadFunction, nPriority, nArg1, nArg2, IFX_FALSE);
+}
+
+/**
+   LINUX Application - Wait for the startup of an asynchronous created thread.
+
+\par Implementation
+   - wait for the pending startup handshake (see "IFXOS_UserThreadSemWait").
+
+\param
+   pThrCntrl   Thread control struct.
+\param
+   waitTime_ms Time [ms] to wait for the thread startup.
+
+\return
+   - IFX_SUCCESS the thread has been started.
+   - IFX_ERROR invalid thread or startup timeout.
+*/
+IFX_int32_t IFXOS_ThreadStartWait(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               IFX_uint32_t       waitTime_ms)
+{
+   if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_FALSE)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - ThreadStartWait, invalid object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   if (pThrCntrl->bStartPending == IFX_TRUE)
+   {
+      if (IFXOS_UserThreadSemWait(&pThrCntrl->thread_active, waitTime_ms) != IFX_SUCCESS)
+      {
+         IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+            ("IFXOS ERROR - User Thread <%s> - startup timeout" IFXOS_CRLF,
+              pThrCntrl->thrParams.pName));
+         return IFX_ERROR;
+      }
+      pThrCntrl->bStartPending = IFX_FALSE;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Creates a set of threads and waits once for the
+   startup of all of them.
+
+\par Implementation
+   - create all threads without startup wait (see "IFXOS_ThreadInitAsync").
+   - wait for the startup of all threads, each with the remaining part of the
+     overall wait time (see "IFXOS_ThreadStartWait").
+   - on a failure force a shutdown of all created threads and delete them,
+     each with the remaining part of the overall wait time (see
+     "IFXOS_ThreadDelete").
+
+\param
+   pParams     Array of thread start parameters.
+\param
+   nThreads    Number of entries within the array.
+\param
+   waitTime_ms Overall time [ms] to wait for the startup of the threads.
+
+\return
+   - IFX_SUCCESS all threads were successful started.
+   - IFX_ERROR at least one thread was not started, the other threads are
+     deleted.
+*/
+IFX_int32_t IFXOS_ThreadInitBatch(
+               const IFXOS_ThreadStartParams_t *pParams,
+               IFX_uint32_t                    nThreads,
+               IFX_uint32_t                    waitTime_ms)
+{
+   IFX_int32_t    retVal = IFX_SUCCESS;
+   IFX_uint32_t   i, nStarted, remainTime_ms = waitTime_ms;
+   IFX_time_t     startTime_ms, elapsedTime_ms;
+
+   if (pParams == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - ThreadInitBatch, missing object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   /* launch all threads, stop on the first failure */
+   for (nStarted = 0; nStarted < nThreads; nStarted++)
+   {
+      if (IFXOS_ThreadInitAsync(
+               pParams[nStarted].pThrCntrl, pParams[nStarted].pName,
+               pParams[nStarted].pThreadFunction, pParams[nStarted].nStackSize,
+               pParams[nStarted].nPriority,
+               pParams[nStarted].nArg1, pParams[nStarted].nArg2) != IFX_SUCCESS)
+      {
+         retVal = IFX_ERROR;
+         break;
+      }
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+   /* collect the startup handshakes */
+   for (i = 0; (i < nStarted) && (retVal == IFX_SUCCESS); i++)
+   {
+      if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+      {
+         elapsedTime_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+         remainTime_ms  = (elapsedTime_ms < waitTime_ms) ?
+                              (waitTime_ms - elapsedTime_ms) : 0;
+      }
+
+      if (IFXOS_ThreadStartWait(pParams[i].pThrCntrl, remainTime_ms) != IFX_SUCCESS)
+      {
+         retVal = IFX_ERROR;
+      }
+   }
+
+   if (retVal == IFX_SUCCESS)
+   {
+      return IFX_SUCCESS;
+   }
+
+   /* partial failure - shutdown and delete the created threads */
+   for (i = 0; i < nStarted; i++)
+   {
+      pParams[i].pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+   }
+
+   startTime_ms  = IFXOS_ElapsedTimeMSecGet(0);
+   remainTime_ms = waitTime_ms;
+   for (i = 0; i < nStarted; i++)
+   {
+      if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+      {
+         elapsedTime_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+         remainTime_ms  = (elapsedTime_ms < waitTime_ms) ?
+                              (waitTime_ms - elapsedTime_ms) : 0;
+      }
+
+      (void)IFXOS_ThreadDelete(pParams[i].pThrCntrl, remainTime_ms);
+   }
+
+   return IFX_ERROR;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) ) */
+
+
 /**
    LINUX Application - Shutdown and terminate a given thread.
    Therefore the thread delete functions triggers the user thread function
@@ -287,7 +697,8 @@ IFX_int32_t IFXOS_ThreadInit(
 
 \par Implementation
    - force a shutdown via the shutdown flag.
-   - wait for completion (see "wait_for_completion").
+   - wait for the end of the user thread routine (see "IFXOS_UserThreadSemWait").
+   - cancel the thread if it does not respond within the given time.
    - free previous allocated internal data.
 
 \param
@@ -303,39 +714,26 @@ IFX_int32_t IFXOS_ThreadDelete(
                IFXOS_ThreadCtrl_t *pThrCntrl,
                IFX_uint32_t       waitTime_ms)
 {
-   IFX_uint32_t   waitCnt = 1;
    int err;
 
    if(pThrCntrl)
    {
       if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_TRUE)
       {
-         if (pThrCntrl->thrParams.bRunning == 1)
-         {
-            /* trigger user thread routine to shutdown */
-            pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+         /* the startup of an asynchronous created thread has to be passed first */
+         waitTime_ms = IFXOS_UserThreadStartPass(pThrCntrl, waitTime_ms);
 
-            if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-            {
-               waitCnt = waitTime_ms / IFXOS_THREAD_DOWN_WAIT_POLL_MS;
-            }
-
-            while (waitCnt && (pThrCntrl->thrParams.bRunning == 1) )
-            {
-               IFXOS_MSecSleep(IFXOS_THREAD_DOWN_WAIT_POLL_MS);
-
-               if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-                  waitCnt--;
-            }
-         }
-         else
+         if (pThrCntrl->thrParams.bRunning == 0)
          {
             IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
                ("IFXOS WRN - User Thread Delete <%s> - not running" IFXOS_CRLF,
                  pThrCntrl->thrParams.pName));
          }
 
-         if (pThrCntrl->thrParams.bRunning == 1)
+         /* trigger user thread routine to shutdown */
+         pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+
+         if (IFXOS_UserThreadSemWait(&pThrCntrl->thread_done, waitTime_ms) != IFX_SUCCESS)
          {
             IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
                ("IFXOS WRN - User Thread Delete <%s> TID %d - kill, no shutdown response" IFXOS_CRLF,
@@ -362,6 +760,7 @@ IFX_int32_t IFXOS_ThreadDelete(
                        pThrCntrl->thrParams.pName, pThrCntrl->tid));
 
                   pThrCntrl->bValid = IFX_FALSE;
+                  sem_destroy(&pThrCntrl->thread_done);
                   err = sem_destroy(&pThrCntrl->thread_active);
                   if (err) {
                      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
@@ -376,6 +775,7 @@ IFX_int32_t IFXOS_ThreadDelete(
          }
 
          pThrCntrl->bValid = IFX_FALSE;
+         sem_destroy(&pThrCntrl->thread_done);
          err = sem_destroy(&pThrCntrl->thread_active);
          if (err) {
             IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
@@ -408,7 +808,7 @@ IFX_int32_t IFXOS_ThreadDelete(
 
 \par Implementation
    - force a shutdown via the shutdown flag.
-   - wait for completion (see "wait_for_completion").
+   - wait for the end of the user thread routine (see "IFXOS_UserThreadSemWait").
    - free previous allocated internal data.
 
 \param
@@ -424,41 +824,29 @@ IFX_int32_t IFXOS_ThreadShutdown(
                IFXOS_ThreadCtrl_t *pThrCntrl,
                IFX_uint32_t       waitTime_ms)
 {
-   IFX_uint32_t   waitCnt = 1;
    int err;
 
    if(pThrCntrl)
    {
       if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_TRUE)
       {
-         if (pThrCntrl->thrParams.bRunning == 1)
-         {
-            /* trigger user thread routine to shutdown */
-            pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+         /* the startup of an asynchronous created thread has to be passed first */
+         waitTime_ms = IFXOS_UserThreadStartPass(pThrCntrl, waitTime_ms);
 
-            if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-            {
-               waitCnt = waitTime_ms / IFXOS_THREAD_DOWN_WAIT_POLL_MS;
-            }
-
-            while (waitCnt && (pThrCntrl->thrParams.bRunning == 1) )
-            {
-               IFXOS_MSecSleep(IFXOS_THREAD_DOWN_WAIT_POLL_MS);
-
-               if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-                  waitCnt--;
-            }
-         }
-         else
+         if (pThrCntrl->thrParams.bRunning == 0)
          {
             IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
                ("IFXOS WRN - User Thread Shutdown <%s> - not running" IFXOS_CRLF,
                  pThrCntrl->thrParams.pName));
          }
 
-         if (pThrCntrl->thrParams.bRunning == 0)
+         /* trigger user thread routine to shutdown */
+         pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+
+         if (IFXOS_UserThreadSemWait(&pThrCntrl->thread_done, waitTime_ms) == IFX_SUCCESS)
          {
             pThrCntrl->bValid = IFX_FALSE;
+            sem_destroy(&pThrCntrl->thread_done);
             err = sem_destroy(&pThrCntrl->thread_active);
             if (err) {
                IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
@@ -490,6 +878,75 @@ IFX_int32_t IFXOS_ThreadShutdown(
    return IFX_ERROR;
 }
 
+#if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) )
+/**
+   LINUX Application - Shutdown and terminate a set of threads.
+
+\par Implementation
+   - force a shutdown of all threads via the shutdown flag.
+   - delete the threads one by one, each with the remaining part of the
+     overall wait time (see "IFXOS_ThreadDelete").
+
+\param
+   pThrCntrl   Array of pointers to the thread control structs.
+\param
+   nThreads    Number of entries within the array.
+\param
+   waitTime_ms Overall time [ms] to wait for "self-shutdown" of the threads.
+
+\return
+   - IFX_SUCCESS all threads were successful deleted.
+   - IFX_ERROR at least one thread was not deleted.
+*/
+IFX_int32_t IFXOS_ThreadDeleteAll(
+               IFXOS_ThreadCtrl_t *pThrCntrl[],
+               IFX_uint32_t       nThreads,
+               IFX_uint32_t       waitTime_ms)
+{
+   IFX_int32_t    retVal = IFX_SUCCESS;
+   IFX_uint32_t   i, remainTime_ms = waitTime_ms;
+   IFX_time_t     startTime_ms, elapsedTime_ms;
+
+   if (pThrCntrl == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - ThreadDeleteAll, missing object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   /* trigger all user thread routines to shutdown */
+   for (i = 0; i < nThreads; i++)
+   {
+      if (IFXOS_THREAD_INIT_VALID(pThrCntrl[i]) == IFX_TRUE)
+      {
+         pThrCntrl[i]->thrParams.bShutDown = IFX_TRUE;
+      }
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+   for (i = 0; i < nThreads; i++)
+   {
+      if (IFXOS_THREAD_INIT_VALID(pThrCntrl[i]) == IFX_FALSE)
+         continue;
+
+      if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+      {
+         elapsedTime_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+         remainTime_ms  = (elapsedTime_ms < waitTime_ms) ?
+                              (waitTime_ms - elapsedTime_ms) : 0;
+      }
+
+      if (IFXOS_ThreadDelete(pThrCntrl[i], remainTime_ms) != IFX_SUCCESS)
+      {
+         retVal = IFX_ERROR;
+      }
+   }
+
+   return retVal;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) ) */
+
 /**
    LINUX Application - Modify own thread priority.
 
@@ -633,6 +1090,100 @@ IFXOS_process_t IFXOS_ProcessIdGet(void)
    return getpid();
 }
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+/**
+   LINUX Application - Create a thread local storage key.
+
+\par Implementation
+   Based on the POSIX thread specific data (see "pthread_key_create").
+
+\param
+   pKey           Returns the new key.
+\param
+   pDestructor    Destructor for the thread values on thread end, optional.
+
+\return
+   - IFX_SUCCESS key created.
+   - IFX_ERROR no more keys available.
+*/
+IFX_int32_t IFXOS_TlsKeyCreate(
+               IFXOS_TlsKey_t          *pKey,
+               IFXOS_TlsDestructor_t   pDestructor)
+{
+   IFX_int_t err;
+
+   if (pKey == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - User TlsKeyCreate, missing key object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   err = pthread_key_create(pKey, pDestructor);
+   if (err != 0)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - User TlsKeyCreate, pthread_key_create = %d" IFXOS_CRLF,
+           err));
+
+      return IFX_ERROR;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Application - Delete a thread local storage key.
+
+\param
+   key            Key to delete.
+
+\return
+   - IFX_SUCCESS key deleted.
+   - IFX_ERROR invalid key.
+*/
+IFX_int32_t IFXOS_TlsKeyDelete(
+               IFXOS_TlsKey_t          key)
+{
+   return (pthread_key_delete(key) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/**
+   LINUX Application - Get the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+
+\return
+   The value of the thread, IFX_NULL if not set.
+*/
+IFX_void_t *IFXOS_TlsGet(
+               IFXOS_TlsKey_t          key)
+{
+   return pthread_getspecific(key);
+}
+
+/**
+   LINUX Application - Set the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+\param
+   pValue         Value to set.
+
+\return
+   - IFX_SUCCESS value set.
+   - IFX_ERROR invalid key or no memory.
+*/
+IFX_int32_t IFXOS_TlsSet(
+               IFXOS_TlsKey_t          key,
+               IFX_void_t              *pValue)
+{
+   return (pthread_setspecific(key, pValue) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) ) */
+
 
 #endif      /* #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) ) */
 
@@ -33,11 +33,14 @@
 #include <linux/sched.h>
 #include <linux/version.h>
 #include <linux/completion.h>
+#include <linux/jiffies.h>
 #if (LINUX_VERSION_CODE < KERNEL_VERSION(2,6,33))
 #include <linux/smp_lock.h>
 #endif
 #include <linux/signal.h>
 #include <linux/kthread.h>
+#include <linux/string.h>
+#include <linux/spinlock.h>
 
 #include "ifx_types.h"
 #include "ifxos_rt_if_check.h"
@@ -68,6 +71,138 @@
 
 #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) )
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+/* ============================================================================
+   IFX Linux adaptation - Kernel Thread Local Storage
+   ========================================================================= */
+
+/** marks a released entry of the TLS thread table (keeps the probe chain) */
+#define IFXOS_TLS_TASK_REMOVED   ((struct task_struct *)1)
+
+/** start index of a task within the TLS thread table */
+#define IFXOS_TLS_TASK_HASH(P_TASK) \
+   ((IFX_uint_t)(((IFX_ulong_t)(P_TASK) >> 8) % IFXOS_TLS_THREADS_MAX))
+
+/**
+   TLS thread table entry - maps a kernel task to its IFXOS thread control.
+*/
+typedef struct
+{
+   /** kernel task, IFX_NULL for an unused entry */
+   struct task_struct   *pTask;
+   /** IFXOS thread control of the task, holds the TLS values */
+   IFXOS_ThreadCtrl_t   *pThrCntrl;
+} IFXOS_TlsThread_t;
+
+/** TLS thread table (open addressing) */
+IFXOS_STATIC IFXOS_TlsThread_t IFXOS_TlsThreadTable[IFXOS_TLS_THREADS_MAX];
+/** TLS key allocation */
+IFXOS_STATIC IFX_boolean_t IFXOS_TlsKeyUsed[IFXOS_TLS_KEYS_MAX];
+/** TLS key destructors */
+IFXOS_STATIC IFXOS_TlsDestructor_t IFXOS_TlsKeyDestructor[IFXOS_TLS_KEYS_MAX];
+/** protects the TLS key allocation and the TLS thread table updates */
+IFXOS_STATIC DEFINE_SPINLOCK(IFXOS_TlsSpinLock);
+
+/**
+   LINUX Kernel - Get the IFXOS thread control of the current task.
+
+\remarks
+   The table entry of the current task is only changed by the task itself,
+   so the lookup does not require the lock.
+*/
+IFXOS_STATIC IFXOS_ThreadCtrl_t *IFXOS_TlsThreadGet(void)
+{
+   IFX_uint_t i, idx = IFXOS_TLS_TASK_HASH(current);
+
+   for (i = 0; i < IFXOS_TLS_THREADS_MAX; i++)
+   {
+      if (IFXOS_TlsThreadTable[idx].pTask == current)
+         return IFXOS_TlsThreadTable[idx].pThrCntrl;
+
+      if (IFXOS_TlsThreadTable[idx].pTask == IFX_NULL)
+         break;
+
+      idx = (idx + 1) % IFXOS_TLS_THREADS_MAX;
+   }
+
+   return IFX_NULL;
+}
+
+/**
+   LINUX Kernel - Register the current task for thread local storage.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TlsThreadRegister(
+               IFXOS_ThreadCtrl_t *pThrCntrl)
+{
+   IFX_uint_t     i, idx = IFXOS_TLS_TASK_HASH(current);
+   unsigned long  flags;
+
+   spin_lock_irqsave(&IFXOS_TlsSpinLock, flags);
+   for (i = 0; i < IFXOS_TLS_THREADS_MAX; i++)
+   {
+      if ( (IFXOS_TlsThreadTable[idx].pTask == IFX_NULL) ||
+           (IFXOS_TlsThreadTable[idx].pTask == IFXOS_TLS_TASK_REMOVED) )
+      {
+         IFXOS_TlsThreadTable[idx].pThrCntrl = pThrCntrl;
+         smp_wmb();
+         IFXOS_TlsThreadTable[idx].pTask = current;
+         break;
+      }
+      idx = (idx + 1) % IFXOS_TLS_THREADS_MAX;
+   }
+   spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+
+   if (i == IFXOS_TLS_THREADS_MAX)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+         ("IFXOS WARNING - Kernel Thread <%s>, no TLS entry available" IFXOS_CRLF,
+           pThrCntrl->thrParams.pName));
+   }
+}
+
+/**
+   LINUX Kernel - Call the TLS destructors and release the TLS entry of the
+   current task.
+*/
+IFXOS_STATIC IFX_void_t IFXOS_TlsThreadUnregister(
+               IFXOS_ThreadCtrl_t *pThrCntrl)
+{
+   IFX_uint_t              i, idx;
+   unsigned long           flags;
+   IFX_void_t              *pValue;
+   IFXOS_TlsDestructor_t   pDestructor;
+
+   for (i = 0; i < IFXOS_TLS_KEYS_MAX; i++)
+   {
+      spin_lock_irqsave(&IFXOS_TlsSpinLock, flags);
+      pValue      = pThrCntrl->pTlsValue[i];
+      pDestructor = (IFXOS_TlsKeyUsed[i] == IFX_TRUE) ? IFXOS_TlsKeyDestructor[i] : IFX_NULL;
+      pThrCntrl->pTlsValue[i] = IFX_NULL;
+      spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+
+      if ((pValue != IFX_NULL) && (pDestructor != IFX_NULL))
+         pDestructor(pValue);
+   }
+
+   idx = IFXOS_TLS_TASK_HASH(current);
+   spin_lock_irqsave(&IFXOS_TlsSpinLock, flags);
+   for (i = 0; i < IFXOS_TLS_THREADS_MAX; i++)
+   {
+      if (IFXOS_TlsThreadTable[idx].pTask == current)
+      {
+         IFXOS_TlsThreadTable[idx].pTask     = IFXOS_TLS_TASK_REMOVED;
+         IFXOS_TlsThreadTable[idx].pThrCntrl = IFX_NULL;
+         break;
+      }
+      if (IFXOS_TlsThreadTable[idx].pTask == IFX_NULL)
+         break;
+
+      idx = (idx + 1) % IFXOS_TLS_THREADS_MAX;
+   }
+   spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) ) */
+
 
 /* ============================================================================
    IFX Linux adaptation - Kernel Thread handling
@@ -149,10 +284,18 @@ IFXOS_STATIC int IFXOS_KernelThreadStartup(void *data)
    if (pThrCntrl->nPriority)
       IFXOS_ThreadPriorityModify(pThrCntrl->nPriority);
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+   IFXOS_TlsThreadRegister(pThrCntrl);
+#endif
+
    pThrCntrl->thrParams.bRunning = IFX_TRUE;
    retVal = pThrCntrl->pThrFct(&pThrCntrl->thrParams);
    pThrCntrl->thrParams.bRunning = IFX_FALSE;
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+   IFXOS_TlsThreadUnregister(pThrCntrl);
+#endif
+
    complete_and_exit(&pThrCntrl->thrCompletion, (long)retVal);
 
    IFXOS_PRN_USR_DBG_NL( IFXOS, IFXOS_PRN_LEVEL_NORMAL,
@@ -216,6 +359,7 @@ IFX_int32_t IFXOS_ThreadInit(
          /* set thread control settings */
          pThrCntrl->pThrFct = pThreadFunction;
          init_completion(&pThrCntrl->thrCompletion);
+         memset(pThrCntrl->pTlsValue, 0x00, sizeof(pThrCntrl->pTlsValue));
 
          /* start kernel thread via the wrapper function */
 #if (LINUX_VERSION_CODE < KERNEL_VERSION(3,8,0))
@@ -241,14 +385,153 @@ IFX_int32_t IFXOS_ThreadInit(
    return IFX_ERROR;
 }
 
+#if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) )
+/**
+   LINUX Kernel - Creates a new thread / task without waiting for the
+   startup of the new thread.
+
+\par Implementation
+   The kernel thread creation does not wait for the thread startup,
+   so this is the same as "IFXOS_ThreadInit".
+
+\param
+   pThrCntrl         Pointer to thread control structure. This structure has to
+                     be allocated outside and will be initialized.
+\param
+   pName             specifies the 8-char thread / task name.
+\param
+   pThreadFunction   specifies the user entry function of the thread / task.
+\param
+   nStackSize        specifies the size of the thread stack - not used.
+\param
+   nPriority         specifies the thread priority, 0 will be ignored
+\param
+   nArg1             first argument passed to thread / task entry function.
+\param
+   nArg2             second argument passed to thread / task entry function.
+
+\return
+   - IFX_SUCCESS thread was successful created.
+   - IFX_ERROR thread was not created
+*/
+IFX_int32_t IFXOS_ThreadInitAsync(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               const IFX_char_t   *pName,
+               IFXOS_ThreadFunction_t pThreadFunction,
+               IFX_uint32_t   nStackSize,
+               IFX_uint32_t   nPriority,
+               IFX_ulong_t    nArg1,
+               IFX_ulong_t    nArg2)
+{
+   return IFXOS_ThreadInit(
+            pThrCntrl, pName, pThreadFunction, nStackSize, nPriority, nArg1, nArg2);
+}
+
+/**
+   LINUX Kernel - Wait for the startup of an asynchronous created thread.
+
+\par Implementation
+   There is no startup handshake for kernel threads, only the thread
+   control struct is checked.
+
+\param
+   pThrCntrl   Thread control struct.
+\param
+   waitTime_ms Time [ms] to wait for the thread startup - not used.
+
+\return
+   - IFX_SUCCESS the thread has been created.
+   - IFX_ERROR invalid thread.
+*/
+IFX_int32_t IFXOS_ThreadStartWait(
+               IFXOS_ThreadCtrl_t *pThrCntrl,
+               IFX_uint32_t       waitTime_ms)
+{
+   if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_FALSE)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel ThreadStartWait, invalid object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Kernel - Creates a set of threads.
+
+\par Implementation
+   - create all threads (see "IFXOS_ThreadInitAsync").
+   - on a failure delete the already created threads (see "IFXOS_ThreadDelete").
+
+\param
+   pParams     Array of thread start parameters.
+\param
+   nThreads    Number of entries within the array.
+\param
+   waitTime_ms Time [ms] to wait for the shutdown of each created thread
+               on a failure.
+
+\return
+   - IFX_SUCCESS all threads were successful created.
+   - IFX_ERROR at least one thread was not created, the other threads are
+     deleted.
+*/
+IFX_int32_t IFXOS_ThreadInitBatch(
+               const IFXOS_ThreadStartParams_t *pParams,
+               IFX_uint32_t                    nThreads,
+               IFX_uint32_t                    waitTime_ms)
+{
+   IFX_uint32_t   i, nStarted;
+
+   if (pParams == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel ThreadInitBatch, missing object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   for (nStarted = 0; nStarted < nThreads; nStarted++)
+   {
+      if (IFXOS_ThreadInitAsync(
+               pParams[nStarted].pThrCntrl, pParams[nStarted].pName,
+               pParams[nStarted].pThreadFunction, pParams[nStarted].nStackSize,
+               pParams[nStarted].nPriority,
+               pParams[nStarted].nArg1, pParams[nStarted].nArg2) != IFX_SUCCESS)
+      {
+         break;
+      }
+   }
+
+   if (nStarted == nThreads)
+   {
+      return IFX_SUCCESS;
+   }
+
+   /* partial failure - shutdown and delete the created threads */
+   for (i = 0; i < nStarted; i++)
+   {
+      pParams[i].pThrCntrl->thrParams.bShutDown = IFX_TRUE;
+   }
+   for (i = 0; i < nStarted; i++)
+   {
+      (void)IFXOS_ThreadDelete(pParams[i].pThrCntrl, waitTime_ms);
+   }
+
+   return IFX_ERROR;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) ) */
+
 /**
    LINUX Kernel - Shutdown and terminate a given thread.
    Therefore the thread delete functions triggers the user thread function
    to shutdown. In case of not response (timeout) the thread will be canceled.
 
 \par Implementation
-   - force a shutdown via the shutdown flag and wait.
-   - wait for completion (see "wait_for_completion").
+   - force a shutdown via the shutdown flag.
+   - wait for completion (see "wait_for_completion_timeout").
+   - a kernel thread can not be canceled, so after a timeout wait for the end
+     of the thread (see "wait_for_completion").
    - free previous allocated internal data.
 
 \param
@@ -264,8 +547,6 @@ IFX_int32_t IFXOS_ThreadDelete(
                IFXOS_ThreadCtrl_t *pThrCntrl,
                IFX_uint32_t       waitTime_ms)
 {
-   IFX_uint32_t   waitCnt = 1;
-
    if(pThrCntrl)
    {
       if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_TRUE)
@@ -275,21 +556,24 @@ IFX_int32_t IFXOS_ThreadDelete(
             /* trigger user thread routine to shutdown */
             pThrCntrl->thrParams.bShutDown = IFX_TRUE;
 
-            if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+            if ( (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER) &&
+                 (wait_for_completion_timeout(&pThrCntrl->thrCompletion,
+                                              msecs_to_jiffies(waitTime_ms)) != 0) )
             {
-               waitCnt = waitTime_ms / IFXOS_THREAD_DOWN_WAIT_POLL_MS;
+               /* thread end signaled within the wait time */
             }
-
-            while (waitCnt && (pThrCntrl->thrParams.bRunning == 1) )
+            else
             {
-               IFXOS_MSecSleep(IFXOS_THREAD_DOWN_WAIT_POLL_MS);
-
                if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-                  waitCnt--;
-            }
+               {
+                  IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_WRN,
+                     ("IFXOS WRN - Kernel Thread Delete <%s> - no shutdown response, wait for end" IFXOS_CRLF,
+                       pThrCntrl->thrParams.pName));
+               }
 
-            /* wait for thread end */
-            wait_for_completion (&pThrCntrl->thrCompletion);
+               /* wait for thread end */
+               wait_for_completion (&pThrCntrl->thrCompletion);
+            }
          }
          else
          {
@@ -330,7 +614,7 @@ IFX_int32_t IFXOS_ThreadDelete(
 
 \par Implementation
    - force a shutdown via the shutdown flag.
-   - wait for completion only if the thread down (see "wait_for_completion").
+   - wait for completion within the given time (see "wait_for_completion_timeout").
    - free previous allocated internal data.
 
 \param
@@ -346,8 +630,6 @@ IFX_int32_t IFXOS_ThreadShutdown(
                IFXOS_ThreadCtrl_t *pThrCntrl,
                IFX_uint32_t       waitTime_ms)
 {
-   IFX_uint32_t   waitCnt = 1;
-
    if(pThrCntrl)
    {
       if (IFXOS_THREAD_INIT_VALID(pThrCntrl) == IFX_TRUE)
@@ -357,22 +639,18 @@ IFX_int32_t IFXOS_ThreadShutdown(
             /* trigger user thread routine to shutdown */
             pThrCntrl->thrParams.bShutDown = IFX_TRUE;
 
-            if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+            if (waitTime_ms == IFXOS_THREAD_DELETE_WAIT_FOREVER)
             {
-               waitCnt = waitTime_ms / IFXOS_THREAD_DOWN_WAIT_POLL_MS;
+               wait_for_completion (&pThrCntrl->thrCompletion);
             }
-
-            while (waitCnt && (pThrCntrl->thrParams.bRunning == 1) )
+            else if (wait_for_completion_timeout(&pThrCntrl->thrCompletion,
+                                                 msecs_to_jiffies(waitTime_ms)) == 0)
             {
-               IFXOS_MSecSleep(IFXOS_THREAD_DOWN_WAIT_POLL_MS);
-
-               if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
-                  waitCnt--;
-            }
+               IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+                  ("ERROR - Kernel Thread Shutdown <%s> no response" IFXOS_CRLF,
+                    pThrCntrl->thrParams.pName));
 
-            if (pThrCntrl->thrParams.bRunning == 0)
-            {
-               wait_for_completion (&pThrCntrl->thrCompletion);
+               return IFX_ERROR;
             }
          }
          else
@@ -408,6 +686,75 @@ IFX_int32_t IFXOS_ThreadShutdown(
 }
 
 
+#if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) )
+/**
+   LINUX Kernel - Shutdown and terminate a set of threads.
+
+\par Implementation
+   - force a shutdown of all threads via the shutdown flag.
+   - delete the threads one by one, each with the remaining part of the
+     overall wait time (see "IFXOS_ThreadDelete").
+
+\param
+   pThrCntrl   Array of pointers to the thread control structs.
+\param
+   nThreads    Number of entries within the array.
+\param
+   waitTime_ms Overall time [ms] to wait for "self-shutdown" of the threads.
+
+\return
+   - IFX_SUCCESS all threads were successful deleted.
+   - IFX_ERROR at least one thread was not deleted.
+*/
+IFX_int32_t IFXOS_ThreadDeleteAll(
+               IFXOS_ThreadCtrl_t *pThrCntrl[],
+               IFX_uint32_t       nThreads,
+               IFX_uint32_t       waitTime_ms)
+{
+   IFX_int32_t    retVal = IFX_SUCCESS;
+   IFX_uint32_t   i, remainTime_ms = waitTime_ms;
+   IFX_time_t     startTime_ms, elapsedTime_ms;
+
+   if (pThrCntrl == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel ThreadDeleteAll, missing object" IFXOS_CRLF));
+      return IFX_ERROR;
+   }
+
+   /* trigger all user thread routines to shutdown */
+   for (i = 0; i < nThreads; i++)
+   {
+      if (IFXOS_THREAD_INIT_VALID(pThrCntrl[i]) == IFX_TRUE)
+      {
+         pThrCntrl[i]->thrParams.bShutDown = IFX_TRUE;
+      }
+   }
+
+   startTime_ms = IFXOS_ElapsedTimeMSecGet(0);
+
+   for (i = 0; i < nThreads; i++)
+   {
+      if (IFXOS_THREAD_INIT_VALID(pThrCntrl[i]) == IFX_FALSE)
+         continue;
+
+      if (waitTime_ms != IFXOS_THREAD_DELETE_WAIT_FOREVER)
+      {
+         elapsedTime_ms = IFXOS_ElapsedTimeMSecGet(startTime_ms);
+         remainTime_ms  = (elapsedTime_ms < waitTime_ms) ?
+                              (waitTime_ms - elapsedTime_ms) : 0;
+      }
+
+      if (IFXOS_ThreadDelete(pThrCntrl[i], remainTime_ms) != IFX_SUCCESS)
+      {
+         retVal = IFX_ERROR;
+      }
+   }
+
+   return retVal;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) ) */
+
 /**
    LINUX Kernel - Modify own thread priority.
 
@@ -476,15 +823,186 @@ IFXOS_process_t IFXOS_ProcessIdGet(void)
 }
 
 
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+/**
+   LINUX Kernel - Create a thread local storage key.
+
+\par Implementation
+   The key is an index into the TLS value table of the IFXOS thread control.
+
+\param
+   pKey           Returns the new key.
+\param
+   pDestructor    Destructor for the thread values on thread end, optional.
+
+\return
+   - IFX_SUCCESS key created.
+   - IFX_ERROR no more keys available.
+*/
+IFX_int32_t IFXOS_TlsKeyCreate(
+               IFXOS_TlsKey_t          *pKey,
+               IFXOS_TlsDestructor_t   pDestructor)
+{
+   IFX_int_t      i;
+   unsigned long  flags;
+
+   if (pKey == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel TlsKeyCreate, missing key object" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   spin_lock_irqsave(&IFXOS_TlsSpinLock, flags);
+   for (i = 0; i < IFXOS_TLS_KEYS_MAX; i++)
+   {
+      if (IFXOS_TlsKeyUsed[i] == IFX_FALSE)
+      {
+         IFXOS_TlsKeyUsed[i]       = IFX_TRUE;
+         IFXOS_TlsKeyDestructor[i] = pDestructor;
+         break;
+      }
+   }
+   spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+
+   if (i == IFXOS_TLS_KEYS_MAX)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel TlsKeyCreate, no more keys (max %d)" IFXOS_CRLF,
+           IFXOS_TLS_KEYS_MAX));
+
+      return IFX_ERROR;
+   }
+
+   *pKey = i;
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Kernel - Delete a thread local storage key.
+
+\param
+   key            Key to delete.
+
+\return
+   - IFX_SUCCESS key deleted.
+   - IFX_ERROR invalid key.
+
+\remarks
+   The values of the key are cleared for all threads.
+*/
+IFX_int32_t IFXOS_TlsKeyDelete(
+               IFXOS_TlsKey_t          key)
+{
+   IFX_int_t      i;
+   unsigned long  flags;
+
+   if ((key < 0) || (key >= IFXOS_TLS_KEYS_MAX))
+      return IFX_ERROR;
+
+   spin_lock_irqsave(&IFXOS_TlsSpinLock, flags);
+   if (IFXOS_TlsKeyUsed[key] == IFX_FALSE)
+   {
+      spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+      return IFX_ERROR;
+   }
+
+   IFXOS_TlsKeyUsed[key]       = IFX_FALSE;
+   IFXOS_TlsKeyDestructor[key] = IFX_NULL;
+   for (i = 0; i < IFXOS_TLS_THREADS_MAX; i++)
+   {
+      if (IFXOS_TlsThreadTable[i].pThrCntrl != IFX_NULL)
+         IFXOS_TlsThreadTable[i].pThrCntrl->pTlsValue[key] = IFX_NULL;
+   }
+   spin_unlock_irqrestore(&IFXOS_TlsSpinLock, flags);
+
+   return IFX_SUCCESS;
+}
+
+/**
+   LINUX Kernel - Get the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+
+\return
+   The value of the thread, IFX_NULL if not set or if the calling thread
+   has not been created via IFXOS.
+*/
+IFX_void_t *IFXOS_TlsGet(
+               IFXOS_TlsKey_t          key)
+{
+   IFXOS_ThreadCtrl_t *pThrCntrl;
+
+   if ((key < 0) || (key >= IFXOS_TLS_KEYS_MAX))
+      return IFX_NULL;
+
+   pThrCntrl = IFXOS_TlsThreadGet();
+
+   return (pThrCntrl != IFX_NULL) ? pThrCntrl->pTlsValue[key] : IFX_NULL;
+}
+
+/**
+   LINUX Kernel - Set the value of the calling thread for the given key.
+
+\param
+   key            Thread local storage key.
+\param
+   pValue         Value to set.
+
+\return
+   - IFX_SUCCESS value set.
+   - IFX_ERROR invalid key or the calling thread has not been created via IFXOS.
+*/
+IFX_int32_t IFXOS_TlsSet(
+               IFXOS_TlsKey_t          key,
+               IFX_void_t              *pValue)
+{
+   IFXOS_ThreadCtrl_t *pThrCntrl;
+
+   if ((key < 0) || (key >= IFXOS_TLS_KEYS_MAX))
+      return IFX_ERROR;
+
+   pThrCntrl = IFXOS_TlsThreadGet();
+   if (pThrCntrl == IFX_NULL)
+   {
+      IFXOS_PRN_USR_ERR_NL( IFXOS, IFXOS_PRN_LEVEL_ERR,
+         ("IFXOS ERROR - Kernel TlsSet, no IFXOS thread" IFXOS_CRLF));
+
+      return IFX_ERROR;
+   }
+
+   pThrCntrl->pTlsValue[key] = pValue;
+
+   return IFX_SUCCESS;
+}
+#endif      /* #if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) ) */
+
 #endif      /* #if ( defined(IFXOS_HAVE_THREAD) && (IFXOS_HAVE_THREAD == 1) ) */
 
 /** @} */
 
 #ifdef MODULE
 EXPORT_SYMBOL(IFXOS_ThreadInit);
+#if ( defined(IFXOS_HAVE_THREAD_ASYNC_START) && (IFXOS_HAVE_THREAD_ASYNC_START == 1) )
+EXPORT_SYMBOL(IFXOS_ThreadInitAsync);
+EXPORT_SYMBOL(IFXOS_ThreadStartWait);
+EXPORT_SYMBOL(IFXOS_ThreadInitBatch);
+#endif
 EXPORT_SYMBOL(IFXOS_ThreadDelete);
 EXPORT_SYMBOL(IFXOS_ThreadShutdown);
+#if ( defined(IFXOS_HAVE_THREAD_DELETE_ALL) && (IFXOS_HAVE_THREAD_DELETE_ALL == 1) )
+EXPORT_SYMBOL(IFXOS_ThreadDeleteAll);
+#endif
 EXPORT_SYMBOL(IFXOS_ThreadPriorityModify);
+#if ( defined(IFXOS_HAVE_THREAD_TLS) && (IFXOS_HAVE_THREAD_TLS == 1) )
+EXPORT_SYMBOL(IFXOS_TlsKeyCreate);
+EXPORT_SYMBOL(IFXOS_TlsKeyDelete);
+EXPORT_SYMBOL(IFXOS_TlsGet);
+EXPORT_SYMBOL(IFXOS_TlsSet);
+#endif
 #endif
 
 #endif      /* #ifdef __KERNEL__ */